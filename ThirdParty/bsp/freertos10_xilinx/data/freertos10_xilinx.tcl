@@ -407,7 +407,12 @@ proc generate {os_handle} {
 	file copy -force [file join src Source list.c] ./src
 	file copy -force [file join src Source timers.c] ./src
 	file copy -force [file join src Source event_groups.c] ./src
-	file copy -force [file join src Source portable MemMang heap_4.c] ./src
+	set size_class_heap [common::get_property CONFIG.use_size_class_heap $os_handle]
+	if {$size_class_heap == "true"} {
+		file copy -force [file join src Source portable MemMang heap_6.c] ./src
+	} else {
+		file copy -force [file join src Source portable MemMang heap_4.c] ./src
+	}
         set stream_buffer_enabled [common::get_property CONFIG.stream_buffer $os_handle]
         set message_buffer_enabled [common::get_property CONFIG.message_buffer $os_handle]
         if {$stream_buffer_enabled == "true" || $message_buffer_enabled == "true"} {
@@ -746,6 +751,13 @@ proc generate {os_handle} {
 	set total_heap_size [common::get_property CONFIG.total_heap_size $os_handle]
 	xput_define $config_file "configTOTAL_HEAP_SIZE"  "( ( size_t ) ( $total_heap_size ) )"
 
+	set val [common::get_property CONFIG.application_defined_heap_regions $os_handle]
+	if {$val == "true"} {
+		xput_define $config_file "configAPPLICATION_DEFINED_HEAP_REGIONS"  "1"
+	} else {
+		xput_define $config_file "configAPPLICATION_DEFINED_HEAP_REGIONS"  "0"
+	}
+
 	set max_task_name_len [common::get_property CONFIG.max_task_name_len $os_handle]
 	xput_define $config_file "configMAX_TASK_NAME_LEN"  $max_task_name_len
 
@@ -876,7 +888,17 @@ proc generate {os_handle} {
 		xput_define $config_file "configUSE_PORT_OPTIMISED_TASK_SELECTION"  "1"
 	}
 
-	puts $config_file "#define configUSE_TICKLESS_IDLE	0"
+	# Tickless idle is implemented only by the A53/A72 and R5 ports
+	set val [common::get_property CONFIG.use_tickless_idle $os_handle]
+	set tickless_procs [list "psu_cortexa53" "psv_cortexa72" "psu_cortexr5" "psv_cortexr5"]
+	if {$val == "true" && [lsearch -exact $tickless_procs $proctype] >= 0} {
+		puts $config_file "#define configUSE_TICKLESS_IDLE	1"
+	} else {
+		if {$val == "true"} {
+			puts "WARNING: use_tickless_idle is not supported for $proctype, the tick runs continuously."
+		}
+		puts $config_file "#define configUSE_TICKLESS_IDLE	0"
+	}
 	puts $config_file "#define configTASK_RETURN_ADDRESS    prvTaskExitError"
 	puts $config_file "#define INCLUDE_vTaskPrioritySet             1"
 	puts $config_file "#define INCLUDE_uxTaskPriorityGet            1"
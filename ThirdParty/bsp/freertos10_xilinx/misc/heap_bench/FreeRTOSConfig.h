@@ -0,0 +1,37 @@
+/*
+ * Copyright (C) 2026 Xilinx, Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*
+ * Kernel configuration of the heap_bench host harness. Only what the heap
+ * implementations and the kernel headers they include need is defined.
+ */
+#ifndef FREERTOS_CONFIG_H
+#define FREERTOS_CONFIG_H
+
+#include <assert.h>
+
+#define configUSE_PREEMPTION                    1
+#define configUSE_IDLE_HOOK                     0
+#define configUSE_TICK_HOOK                     0
+#define configUSE_16_BIT_TICKS                  0
+#define configMINIMAL_STACK_SIZE                ( ( unsigned short ) 200 )
+#define configMAX_PRIORITIES                    8
+#define configMAX_TASK_NAME_LEN                 10
+#define configSUPPORT_DYNAMIC_ALLOCATION        1
+#define configSUPPORT_STATIC_ALLOCATION         0
+#define configUSE_MALLOC_FAILED_HOOK            0
+
+/* Default heap of heap_4.c, and of heap_6.c when no regions are defined */
+#ifndef configTOTAL_HEAP_SIZE
+#define configTOTAL_HEAP_SIZE                   ( ( size_t ) ( 4 * 1024 * 1024 ) )
+#endif
+#ifndef configAPPLICATION_DEFINED_HEAP_REGIONS
+#define configAPPLICATION_DEFINED_HEAP_REGIONS	0
+#endif
+
+#define configASSERT( x )                       assert( x )
+
+#endif /* FREERTOS_CONFIG_H */
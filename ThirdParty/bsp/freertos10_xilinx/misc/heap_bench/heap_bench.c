@@ -0,0 +1,456 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file heap_bench.c
+*
+* Host stress test and benchmark of the FreeRTOS heaps, built from the
+* unmodified heap_6.c (heap6_bench) and heap_4.c (heap4_bench) against a
+* single threaded host port.
+*
+* - stress: random allocations and frees over a table of live blocks, with
+*   sizes spread over the heap_6 size classes and beyond. Every block is
+*   filled with a pattern derived from its sequence number and checked when
+*   freed and at every full scan, along with its alignment and, for heap_6
+*   regions, its bounds. The free heap size must return to its initial value
+*   once all blocks are freed, and a block of three quarters of the largest
+*   region must then be allocatable, which checks coalescing (and for
+*   heap_6 the give back of the size class caches).
+* - small: allocation and free of a fixed size block, in batches.
+* - mixed: steady state random allocations and frees.
+*
+* heap6_bench defines two heap regions with vPortDefineHeapRegions() unless
+* -d is given. Results are printed as lines of
+*
+*	heap,<heap>,<test>,<metric>,<value>
+*
+* and the exit status is non zero if an integrity check failed.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -----------------------------------------------
+* 1.00  ant  10/18/26 Initial release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+#include "FreeRTOS.h"
+#include "task.h"
+
+/************************** Constant Definitions *****************************/
+#define DEFAULT_OPS		(2000000U)
+#define DEFAULT_SLOTS		(2048U)
+#define DEFAULT_SEED		(1U)
+#define SCAN_INTERVAL		(65536U)
+#define SMALL_SIZE		(64U)
+#define SMALL_BATCH		(256U)
+#define SMALL_ROUNDS		(4000U)
+#define REGION0_SIZE		(3U * 1024U * 1024U)
+#define REGION1_SIZE		(1U * 1024U * 1024U)
+
+#if defined (HEAP_BENCH_HEAP6)
+#define HEAP_NAME		"heap_6"
+#else
+#define HEAP_NAME		"heap_4"
+#endif
+
+/**************************** Type Definitions *******************************/
+typedef struct {
+	uint8_t *Ptr;
+	size_t Size;
+	uint32_t Seq;
+} Slot;
+
+/************************** Function Prototypes ******************************/
+static uint32_t Rand(void);
+static size_t RandSize(void);
+static uint64_t NowNs(void);
+static uint8_t PatternByte(uint32_t Seq);
+static int SlotAlloc(Slot *S, size_t Size);
+static int SlotCheck(const Slot *S);
+static void SlotFree(Slot *S);
+static int Stress(uint32_t Ops, uint32_t Slots);
+static void BenchSmall(void);
+static void BenchMixed(uint32_t Ops, uint32_t Slots);
+static void Usage(const char *Prog);
+
+/************************** Variable Definitions *****************************/
+unsigned long ulHostCriticalSections;
+static unsigned long SuspendCount;
+static uint32_t RandState = DEFAULT_SEED;
+static uint32_t NextSeq = 1U;
+static Slot *SlotTable;
+static uint64_t Errors;
+
+#if defined (HEAP_BENCH_HEAP6)
+static uint8_t Region0[REGION0_SIZE] __attribute__((aligned(64)));
+static uint8_t Region1[REGION1_SIZE] __attribute__((aligned(64)));
+static int UseRegions = 1;
+#endif
+
+/*
+ * Kernel functions used by the heaps. The harness is single threaded, so
+ * suspending the scheduler is only counted.
+ */
+void vTaskSuspendAll(void)
+{
+	SuspendCount++;
+}
+
+BaseType_t xTaskResumeAll(void)
+{
+	return pdFALSE;
+}
+
+static uint32_t Rand(void)
+{
+	/* xorshift32 */
+	RandState ^= RandState << 13;
+	RandState ^= RandState >> 17;
+	RandState ^= RandState << 5;
+	return RandState;
+}
+
+/*
+ * 70% up to 64 bytes, 20% up to 512 bytes (the heap_6 size classes) and
+ * 10% up to 16 KB.
+ */
+static size_t RandSize(void)
+{
+	uint32_t R = Rand();
+	uint32_t Pick = R % 10U;
+
+	R >>= 8U;
+	if (Pick < 7U) {
+		return 1U + (R % 64U);
+	}
+	if (Pick < 9U) {
+		return 65U + (R % 448U);
+	}
+	return 513U + (R % (16384U - 512U));
+}
+
+static uint64_t NowNs(void)
+{
+	struct timespec Ts;
+
+	(void)clock_gettime(CLOCK_MONOTONIC, &Ts);
+	return ((uint64_t)Ts.tv_sec * 1000000000ULL) + (uint64_t)Ts.tv_nsec;
+}
+
+static uint8_t PatternByte(uint32_t Seq)
+{
+	return (uint8_t)((Seq * 0x9DU) ^ (Seq >> 8U));
+}
+
+static int SlotAlloc(Slot *S, size_t Size)
+{
+	uintptr_t Addr;
+
+	S->Ptr = pvPortMalloc(Size);
+	if (S->Ptr == NULL) {
+		return -1;
+	}
+	S->Size = Size;
+	S->Seq = NextSeq++;
+	Addr = (uintptr_t)S->Ptr;
+
+	if ((Addr & (uintptr_t)portBYTE_ALIGNMENT_MASK) != 0U) {
+		fprintf(stderr, "stress: block %p of %zu bytes misaligned\n",
+			(void *)S->Ptr, Size);
+		Errors++;
+	}
+#if defined (HEAP_BENCH_HEAP6)
+	if (UseRegions != 0) {
+		uintptr_t R0 = (uintptr_t)Region0;
+		uintptr_t R1 = (uintptr_t)Region1;
+
+		if (!(((Addr >= R0) && ((Addr + Size) <= (R0 + REGION0_SIZE))) ||
+		      ((Addr >= R1) && ((Addr + Size) <= (R1 + REGION1_SIZE))))) {
+			fprintf(stderr, "stress: block %p of %zu bytes outside "
+				"the heap regions\n", (void *)S->Ptr, Size);
+			Errors++;
+		}
+	}
+#endif
+	memset(S->Ptr, PatternByte(S->Seq), Size);
+
+	return 0;
+}
+
+static int SlotCheck(const Slot *S)
+{
+	uint8_t Expected = PatternByte(S->Seq);
+	size_t Index;
+
+	for (Index = 0U; Index < S->Size; Index++) {
+		if (S->Ptr[Index] != Expected) {
+			fprintf(stderr, "stress: block %p of %zu bytes corrupted "
+				"at offset %zu\n", (void *)S->Ptr, S->Size,
+				Index);
+			Errors++;
+			return -1;
+		}
+	}
+
+	return 0;
+}
+
+static void SlotFree(Slot *S)
+{
+	vPortFree(S->Ptr);
+	S->Ptr = NULL;
+	S->Size = 0U;
+}
+
+static int Stress(uint32_t Ops, uint32_t Slots)
+{
+	size_t InitialFree;
+	size_t Largest;
+	size_t LiveBytes = 0U;
+	uint64_t Failed = 0U;
+	uint32_t Op;
+	uint32_t Index;
+	void *Big;
+
+	/* Initialise the heap, then take the reference free size */
+	vPortFree(pvPortMalloc(1U));
+	InitialFree = xPortGetFreeHeapSize();
+
+	for (Op = 1U; Op <= Ops; Op++) {
+		Slot *S = &SlotTable[Rand() % Slots];
+
+		if (S->Ptr != NULL) {
+			(void)SlotCheck(S);
+			LiveBytes -= S->Size;
+			SlotFree(S);
+		} else if (SlotAlloc(S, RandSize()) == 0) {
+			LiveBytes += S->Size;
+		} else {
+			Failed++;
+		}
+
+		if ((Op % SCAN_INTERVAL) == 0U) {
+			for (Index = 0U; Index < Slots; Index++) {
+				if (SlotTable[Index].Ptr != NULL) {
+					(void)SlotCheck(&SlotTable[Index]);
+				}
+			}
+			if ((xPortGetFreeHeapSize() + LiveBytes) > InitialFree) {
+				fprintf(stderr, "stress: free size %zu plus live "
+					"%zu exceeds the heap %zu\n",
+					xPortGetFreeHeapSize(), LiveBytes,
+					InitialFree);
+				Errors++;
+			}
+		}
+	}
+
+	for (Index = 0U; Index < Slots; Index++) {
+		if (SlotTable[Index].Ptr != NULL) {
+			(void)SlotCheck(&SlotTable[Index]);
+			SlotFree(&SlotTable[Index]);
+		}
+	}
+	if (xPortGetFreeHeapSize() != InitialFree) {
+		fprintf(stderr, "stress: %zu bytes free after freeing all "
+			"blocks, %zu expected\n", xPortGetFreeHeapSize(),
+			InitialFree);
+		Errors++;
+	}
+
+	/* Everything freed, the largest region must coalesce again */
+#if defined (HEAP_BENCH_HEAP6)
+	Largest = (UseRegions != 0) ? REGION0_SIZE : configTOTAL_HEAP_SIZE;
+#else
+	Largest = configTOTAL_HEAP_SIZE;
+#endif
+	Big = pvPortMalloc((Largest / 4U) * 3U);
+	if (Big == NULL) {
+		fprintf(stderr, "stress: %zu bytes not allocatable after "
+			"freeing all blocks\n", (Largest / 4U) * 3U);
+		Errors++;
+	}
+	vPortFree(Big);
+
+	printf("heap,%s,stress,ops,%u\n", HEAP_NAME, Ops);
+	printf("heap,%s,stress,failed_allocs,%llu\n", HEAP_NAME,
+	       (unsigned long long)Failed);
+	printf("heap,%s,stress,min_ever_free,%zu\n", HEAP_NAME,
+	       xPortGetMinimumEverFreeHeapSize());
+	printf("heap,%s,stress,errors,%llu\n", HEAP_NAME,
+	       (unsigned long long)Errors);
+
+	return (Errors == 0U) ? 0 : -1;
+}
+
+static void BenchSmall(void)
+{
+	void *Ptrs[SMALL_BATCH];
+	uint64_t AllocNs = 0U;
+	uint64_t FreeNs = 0U;
+	uint64_t T0;
+	uint32_t Round;
+	uint32_t Index;
+	unsigned long Crit0 = ulHostCriticalSections;
+	unsigned long Susp0 = SuspendCount;
+	double Ops = (double)SMALL_ROUNDS * SMALL_BATCH;
+
+	for (Round = 0U; Round < SMALL_ROUNDS; Round++) {
+		T0 = NowNs();
+		for (Index = 0U; Index < SMALL_BATCH; Index++) {
+			Ptrs[Index] = pvPortMalloc(SMALL_SIZE);
+		}
+		AllocNs += NowNs() - T0;
+		T0 = NowNs();
+		for (Index = 0U; Index < SMALL_BATCH; Index++) {
+			vPortFree(Ptrs[Index]);
+		}
+		FreeNs += NowNs() - T0;
+	}
+
+	printf("heap,%s,small,malloc_ns,%.1f\n", HEAP_NAME,
+	       (double)AllocNs / Ops);
+	printf("heap,%s,small,free_ns,%.1f\n", HEAP_NAME,
+	       (double)FreeNs / Ops);
+	printf("heap,%s,small,critical_per_op,%.2f\n", HEAP_NAME,
+	       (double)(ulHostCriticalSections - Crit0) / (2.0 * Ops));
+	printf("heap,%s,small,suspend_per_op,%.2f\n", HEAP_NAME,
+	       (double)(SuspendCount - Susp0) / (2.0 * Ops));
+}
+
+static void BenchMixed(uint32_t Ops, uint32_t Slots)
+{
+	uint64_t T0;
+	uint32_t Op;
+	uint32_t Index;
+
+	/* Fill half the table to reach a fragmented steady state */
+	for (Index = 0U; Index < Slots; Index += 2U) {
+		SlotTable[Index].Ptr = pvPortMalloc(RandSize());
+	}
+
+	T0 = NowNs();
+	for (Op = 0U; Op < Ops; Op++) {
+		Slot *S = &SlotTable[Rand() % Slots];
+
+		if (S->Ptr != NULL) {
+			vPortFree(S->Ptr);
+			S->Ptr = NULL;
+		} else {
+			S->Ptr = pvPortMalloc(RandSize());
+		}
+	}
+	printf("heap,%s,mixed,ns_per_op,%.1f\n", HEAP_NAME,
+	       (double)(NowNs() - T0) / (double)Ops);
+
+	for (Index = 0U; Index < Slots; Index++) {
+		vPortFree(SlotTable[Index].Ptr);
+		SlotTable[Index].Ptr = NULL;
+	}
+
+#if defined (HEAP_BENCH_HEAP6)
+	{
+		HeapClassStats_t Stats[heapNUM_SIZE_CLASSES];
+
+		vPortGetHeapClassStats(Stats);
+		for (Index = 0U; Index < heapNUM_SIZE_CLASSES; Index++) {
+			printf("heap,%s,class_%zu,hits,%zu\n", HEAP_NAME,
+			       Stats[Index].xClassSizeInBytes,
+			       Stats[Index].xHits);
+			printf("heap,%s,class_%zu,misses,%zu\n", HEAP_NAME,
+			       Stats[Index].xClassSizeInBytes,
+			       Stats[Index].xMisses);
+		}
+	}
+#endif
+}
+
+static void Usage(const char *Prog)
+{
+	fprintf(stderr, "usage: %s [-n ops] [-l live_slots] [-s seed]"
+#if defined (HEAP_BENCH_HEAP6)
+		" [-d]"
+#endif
+		"\n", Prog);
+}
+
+int main(int argc, char **argv)
+{
+	uint32_t Ops = DEFAULT_OPS;
+	uint32_t Slots = DEFAULT_SLOTS;
+	int Opt;
+
+	while ((Opt = getopt(argc, argv, "n:l:s:d")) != -1) {
+		switch (Opt) {
+		case 'n':
+			Ops = (uint32_t)strtoul(optarg, NULL, 0);
+			break;
+		case 'l':
+			Slots = (uint32_t)strtoul(optarg, NULL, 0);
+			break;
+		case 's':
+			RandState = (uint32_t)strtoul(optarg, NULL, 0);
+			break;
+#if defined (HEAP_BENCH_HEAP6)
+		case 'd':
+			UseRegions = 0;
+			break;
+#endif
+		default:
+			Usage(argv[0]);
+			return 2;
+		}
+	}
+	if ((Ops == 0U) || (Slots == 0U) || (RandState == 0U)) {
+		Usage(argv[0]);
+		return 2;
+	}
+
+	SlotTable = calloc(Slots, sizeof(Slot));
+	if (SlotTable == NULL) {
+		fprintf(stderr, "out of memory\n");
+		return 1;
+	}
+
+#if defined (HEAP_BENCH_HEAP6)
+	if (UseRegions != 0) {
+		/* Regions must be passed in increasing address order */
+		HeapRegion_t Regions[3] = {
+			{ Region0, REGION0_SIZE },
+			{ Region1, REGION1_SIZE },
+			{ NULL, 0 },
+		};
+
+		if ((uintptr_t)Region1 < (uintptr_t)Region0) {
+			Regions[0].pucStartAddress = Region1;
+			Regions[0].xSizeInBytes = REGION1_SIZE;
+			Regions[1].pucStartAddress = Region0;
+			Regions[1].xSizeInBytes = REGION0_SIZE;
+		}
+		vPortDefineHeapRegions(Regions);
+	}
+#endif
+
+	if (Stress(Ops, Slots) != 0) {
+		free(SlotTable);
+		return 1;
+	}
+	BenchSmall();
+	BenchMixed(Ops, Slots);
+	free(SlotTable);
+
+	return 0;
+}
@@ -0,0 +1,49 @@
+/*
+ * Copyright (C) 2026 Xilinx, Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*
+ * Host port of the heap_bench harness. The harness is single threaded, so
+ * critical sections and scheduler suspension are only counted, which shows
+ * how often each heap enters them.
+ */
+#ifndef PORTMACRO_H
+#define PORTMACRO_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define portCHAR                char
+#define portFLOAT               float
+#define portDOUBLE              double
+#define portLONG                long
+#define portSHORT               short
+#define portSTACK_TYPE          size_t
+#define portBASE_TYPE           long
+
+typedef portSTACK_TYPE StackType_t;
+typedef portBASE_TYPE BaseType_t;
+typedef unsigned long UBaseType_t;
+typedef uint32_t TickType_t;
+#define portMAX_DELAY           ( ( TickType_t ) 0xffffffffUL )
+#define portTICK_TYPE_IS_ATOMIC 1
+
+#define portSTACK_GROWTH        ( -1 )
+#define portBYTE_ALIGNMENT      16
+#define portINLINE              __inline
+
+extern unsigned long ulHostCriticalSections;
+
+#define portENTER_CRITICAL()    ( ulHostCriticalSections++ )
+#define portEXIT_CRITICAL()
+#define portDISABLE_INTERRUPTS()
+#define portENABLE_INTERRUPTS()
+#define portYIELD()
+#define portNOP()
+
+#define portTASK_FUNCTION_PROTO( vFunction, pvParameters )    void vFunction( void * pvParameters )
+#define portTASK_FUNCTION( vFunction, pvParameters )          void vFunction( void * pvParameters )
+
+#endif /* PORTMACRO_H */
@@ -150,8 +150,22 @@ typedef struct xHeapStats
     size_t xNumberOfSuccessfulFrees;        /* The number of calls to vPortFree() that has successfully freed a block of memory. */
 } HeapStats_t;
 
+/* Number of size classes cached by heap_6.c. */
+#define heapNUM_SIZE_CLASSES    6
+
+/* Used to pass information about the heap_6.c size classes out of
+ * vPortGetHeapClassStats(). */
+typedef struct xHeapClassStats
+{
+    size_t xClassSizeInBytes; /* The largest request, in bytes, served by the size class. */
+    size_t xCachedBlocks;     /* The number of free blocks held by the size class. */
+    size_t xCachedBytes;      /* The heap space, in bytes, held by the free blocks of the size class. */
+    size_t xHits;             /* The number of allocations served from the size class free blocks. */
+    size_t xMisses;           /* The number of allocations of the size class that had to search the heap. */
+} HeapClassStats_t;
+
 /*
- * Used to define multiple heap regions for use by heap_5.c.  This function
+ * Used to define multiple heap regions for use by heap_5.c and heap_6.c.  This function
  * must be called before any calls to pvPortMalloc() - not creating a task,
  * queue, semaphore, mutex, software timer, event group, etc. will result in
  * pvPortMalloc being called.
@@ -169,6 +183,12 @@ void vPortDefineHeapRegions( const HeapRegion_t * const pxHeapRegions ) PRIVILEG
  */
 void vPortGetHeapStats( HeapStats_t * pxHeapStats );
 
+/*
+ * Fills pxClassStats, an array of heapNUM_SIZE_CLASSES entries, with the
+ * state of each heap_6.c size class.
+ */
+void vPortGetHeapClassStats( HeapClassStats_t * pxClassStats );
+
 /*
  * Map to the memory management routines required for the port.
  */
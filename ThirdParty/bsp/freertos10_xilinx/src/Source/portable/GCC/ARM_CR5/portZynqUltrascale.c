@@ -76,6 +76,20 @@ XScuGic xInterruptController;
 #else
 extern uintptr_t IntrControllerAddr;
 #endif
+
+#if( configUSE_TICKLESS_IDLE == 1 )
+#if defined( XPAR_XILTIMER_ENABLED ) || ( configGENERATE_RUN_TIME_STATS == 1 )
+	#error configUSE_TICKLESS_IDLE requires the TTC tick timer with configGENERATE_RUN_TIME_STATS set to 0
+#endif
+
+/* Number of TTC counts in one tick period, and the maximum number of tick
+periods the TTC interval register can hold. */
+static uint32_t ulTimerCountsForOneTick = 0;
+static TickType_t xMaximumPossibleSuppressedTicks = 0;
+
+/* pdTRUE while the TTC interval is longer than one tick period. */
+static volatile uint32_t ulTickIntervalStretched = pdFALSE;
+#endif
 /*-----------------------------------------------------------*/
 
 #ifndef XPAR_XILTIMER_ENABLED
@@ -132,6 +146,10 @@ XScuGic_Config *pxInterruptControllerConfig;
 	XTtcPs_CalcIntervalFromFreq( &xTimerInstance, configTICK_RATE_HZ*10, &usInterval, &ucPrescaler );
 #else
 	XTtcPs_CalcIntervalFromFreq( &xTimerInstance, configTICK_RATE_HZ, &usInterval, &ucPrescaler );
+#endif
+#if( configUSE_TICKLESS_IDLE == 1 )
+	ulTimerCountsForOneTick = ( uint32_t ) usInterval + 1UL;
+	xMaximumPossibleSuppressedTicks = ( TickType_t ) ( XTTCPS_MAX_INTERVAL_COUNT / ulTimerCountsForOneTick );
 #endif
 	XTtcPs_SetInterval( &xTimerInstance, usInterval );
 	XTtcPs_SetPrescaler( &xTimerInstance, ucPrescaler );
@@ -178,12 +196,105 @@ void FreeRTOS_ClearTickInterrupt( void )
 {
 #ifndef XPAR_XILTIMER_ENABLED
 	XTtcPs_ClearInterruptStatus( &xTimerInstance, XTtcPs_GetInterruptStatus( &xTimerInstance ) );
+#if( configUSE_TICKLESS_IDLE == 1 )
+	if( ulTickIntervalStretched != pdFALSE )
+	{
+		/* The counter wrapped at the end of a suppressed tick period, go
+		back to one interrupt per tick. */
+		XTtcPs_SetInterval( &xTimerInstance, ( XInterval ) ( ulTimerCountsForOneTick - 1UL ) );
+		ulTickIntervalStretched = pdFALSE;
+	}
+#endif
 #else
 	XTimer_ClearTickInterrupt();
 #endif
 }
 /*-----------------------------------------------------------*/
 
+#if( configUSE_TICKLESS_IDLE == 1 )
+static BaseType_t prvIsTickInterruptPending( void )
+{
+uint32_t ulPending;
+
+	ulPending = XScuGic_DistReadReg( &xInterruptController,
+			XSCUGIC_PENDING_SET_OFFSET + ( ( configTIMER_INTERRUPT_ID / 32UL ) * 4UL ) );
+
+	return ( ( ulPending & ( 1UL << ( configTIMER_INTERRUPT_ID % 32UL ) ) ) != 0UL ) ? pdTRUE : pdFALSE;
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * Stretch the TTC interval over xExpectedIdleTime tick periods and sleep
+ * until the tick interrupt or any other interrupt wakes the core.  The
+ * counter is left running from its current value so that the next tick
+ * interrupt stays on the original tick boundary; only the few counts spent
+ * with the timer stopped while it is reprogrammed are lost.
+ */
+void vPortSuppressTicksAndSleep( TickType_t xExpectedIdleTime )
+{
+uint32_t ulCountAtWake, ulCompleteTickPeriods;
+
+	if( xExpectedIdleTime > xMaximumPossibleSuppressedTicks )
+	{
+		xExpectedIdleTime = xMaximumPossibleSuppressedTicks;
+	}
+
+	/* Mask IRQs in the CPU rather than through the GIC priority mask, a
+	masked priority would also keep the tick interrupt from waking the core
+	out of WFI. */
+	__asm volatile( "cpsid i" ::: "memory" );
+
+	/* A pending tick, a task made ready by an interrupt or a pended
+	context switch means the core cannot sleep. */
+	if( ( eTaskConfirmSleepModeStatus() == eAbortSleep ) ||
+		( prvIsTickInterruptPending() != pdFALSE ) )
+	{
+		__asm volatile( "cpsie i" ::: "memory" );
+		return;
+	}
+
+	XTtcPs_Stop( &xTimerInstance );
+	XTtcPs_SetInterval( &xTimerInstance,
+			( XInterval ) ( ( ulTimerCountsForOneTick * ( uint32_t ) xExpectedIdleTime ) - 1UL ) );
+	ulTickIntervalStretched = pdTRUE;
+	XTtcPs_Start( &xTimerInstance );
+
+	configPRE_SLEEP_PROCESSING( xExpectedIdleTime );
+	if( xExpectedIdleTime > 0 )
+	{
+		__asm volatile( "dsb" ::: "memory" );
+		__asm volatile( "wfi" );
+		__asm volatile( "isb" );
+	}
+	configPOST_SLEEP_PROCESSING( xExpectedIdleTime );
+
+	XTtcPs_Stop( &xTimerInstance );
+
+	if( prvIsTickInterruptPending() != pdFALSE )
+	{
+		/* The tick interrupt ended the sleep.  Its handler accounts for the
+		last tick period and restores the one tick interval. */
+		ulCompleteTickPeriods = ( uint32_t ) xExpectedIdleTime - 1UL;
+	}
+	else
+	{
+		/* Another interrupt ended the sleep.  Move the interval end to the
+		next tick boundary after the current count. */
+		ulCountAtWake = XTtcPs_GetCounterValue( &xTimerInstance );
+		ulCompleteTickPeriods = ulCountAtWake / ulTimerCountsForOneTick;
+		XTtcPs_SetInterval( &xTimerInstance,
+				( XInterval ) ( ( ( ulCompleteTickPeriods + 1UL ) * ulTimerCountsForOneTick ) - 1UL ) );
+		ulTickIntervalStretched = ( ulCompleteTickPeriods != 0UL ) ? pdTRUE : pdFALSE;
+	}
+
+	XTtcPs_Start( &xTimerInstance );
+	vTaskStepTick( ( TickType_t ) ulCompleteTickPeriods );
+
+	__asm volatile( "cpsie i" ::: "memory" );
+}
+#endif /* configUSE_TICKLESS_IDLE */
+/*-----------------------------------------------------------*/
+
 void vApplicationIRQHandler( uint32_t ulICCIAR )
 {
 extern XScuGic_Config XScuGic_ConfigTable[];
@@ -0,0 +1,806 @@
+/*
+ * FreeRTOS Kernel V10.4.6
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ * Copyright (C) 2026 Xilinx, Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*
+ * An implementation of pvPortMalloc() and vPortFree() that puts a set of
+ * fixed size class caches in front of the heap_5 style coalescing heap.
+ *
+ * Requests up to heapSIZE_CLASS_MAX bytes are rounded up to a power of two
+ * size class.  Freed blocks of a size class are kept on a per class free list
+ * instead of being coalesced, so allocating and freeing a small object is a
+ * constant time list push/pop done inside a short critical section.  Larger
+ * requests, and small requests whose class list is empty, fall back to a first
+ * fit search of the address ordered free list under vTaskSuspendAll(), exactly
+ * as heap_5.c does.  If the first fit search fails, the class caches are given
+ * back to the coalescing heap and the search is retried, so cached blocks
+ * cannot starve large allocations.
+ *
+ * The heap is made of one or more regions.  vPortDefineHeapRegions() can be
+ * called before the first pvPortMalloc() to define them, with the same rules
+ * as heap_5.c.  If it is not called, a single region of configTOTAL_HEAP_SIZE
+ * bytes is used, as in heap_4.c, so this file is a drop in replacement for
+ * both.  Set configAPPLICATION_DEFINED_HEAP_REGIONS to 1 when the application
+ * always defines the regions: the default heap array is then not allocated,
+ * and vPortDefineHeapRegions() must be called before the first allocation,
+ * exactly as with heap_5.c.
+ *
+ * vPortGetHeapStats() reports the state of the coalescing heap, and
+ * vPortGetHeapClassStats() reports the hit/miss counters and cached bytes of
+ * each size class, which together show how fragmented the heap is.
+ */
+#include <stdlib.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers.  That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#if ( configSUPPORT_DYNAMIC_ALLOCATION == 0 )
+    #error This file must not be used if configSUPPORT_DYNAMIC_ALLOCATION is 0
+#endif
+
+/* Not every port defines portINLINE. */
+#ifndef portINLINE
+    #define portINLINE    __inline
+#endif
+
+/* Block sizes must not get too small. */
+#define heapMINIMUM_BLOCK_SIZE    ( ( size_t ) ( xHeapStructSize << 1 ) )
+
+/* Assumes 8bit bytes! */
+#define heapBITS_PER_BYTE         ( ( size_t ) 8 )
+
+/* Size classes are powers of two from heapSIZE_CLASS_MIN to
+ * heapSIZE_CLASS_MAX bytes of payload. */
+#define heapSIZE_CLASS_MIN        ( ( size_t ) 16 )
+#define heapSIZE_CLASS_MAX        ( heapSIZE_CLASS_MIN << ( heapNUM_SIZE_CLASSES - 1 ) )
+
+#ifndef configAPPLICATION_DEFINED_HEAP_REGIONS
+    #define configAPPLICATION_DEFINED_HEAP_REGIONS    0
+#endif
+
+/* Allocate the memory for the heap, only used if vPortDefineHeapRegions() is
+ * not called before the first allocation. */
+#if ( configAPPLICATION_DEFINED_HEAP_REGIONS == 0 )
+    #if ( configAPPLICATION_ALLOCATED_HEAP == 1 )
+
+/* The application writer has already defined the array used for the RTOS
+* heap - probably so it can be placed in a special segment or address. */
+        extern uint8_t ucHeap[ configTOTAL_HEAP_SIZE ];
+    #else
+        PRIVILEGED_DATA static uint8_t ucHeap[ configTOTAL_HEAP_SIZE ];
+    #endif /* configAPPLICATION_ALLOCATED_HEAP */
+#endif /* configAPPLICATION_DEFINED_HEAP_REGIONS */
+
+/* Define the linked list structure.  This is used to link free blocks in order
+ * of their memory address, and free blocks of the same size class. */
+typedef struct A_BLOCK_LINK
+{
+    struct A_BLOCK_LINK * pxNextFreeBlock; /*<< The next free block in the list. */
+    size_t xBlockSize;                     /*<< The size of the free block. */
+} BlockLink_t;
+
+/* Per size class state. */
+typedef struct A_SIZE_CLASS
+{
+    BlockLink_t * pxFreeList; /*<< Cached free blocks of this class. */
+    size_t xCachedBlocks;     /*<< Number of blocks on pxFreeList. */
+    size_t xHits;             /*<< Allocations served from pxFreeList. */
+    size_t xMisses;           /*<< Allocations that fell back to the first fit search. */
+} SizeClass_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Inserts a block of memory that is being freed into the correct position in
+ * the list of free memory blocks.  The block being freed will be merged with
+ * the block in front it and/or the block behind it if the memory blocks are
+ * adjacent to each other.
+ */
+static void prvInsertBlockIntoFreeList( BlockLink_t * pxBlockToInsert ) PRIVILEGED_FUNCTION;
+
+/*
+ * First fit search of the coalescing heap.  Must be called with the scheduler
+ * suspended.
+ */
+static BlockLink_t * prvAllocateFromFreeList( size_t xWantedSize ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns every cached size class block to the coalescing heap.  Must be
+ * called with the scheduler suspended.
+ */
+static void prvReclaimSizeClasses( void ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+/* The size of the structure placed at the beginning of each allocated memory
+ * block must by correctly byte aligned. */
+static const size_t xHeapStructSize = ( sizeof( BlockLink_t ) + ( ( size_t ) ( portBYTE_ALIGNMENT - 1 ) ) ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+
+/* Create a couple of list links to mark the start and end of the list. */
+PRIVILEGED_DATA static BlockLink_t xStart, * pxEnd = NULL;
+
+/* The size class caches. */
+PRIVILEGED_DATA static SizeClass_t xSizeClasses[ heapNUM_SIZE_CLASSES ];
+
+/* Keeps track of the number of calls to allocate and free memory as well as the
+ * number of free bytes remaining.  Bytes cached in the size classes are
+ * counted as free. */
+PRIVILEGED_DATA static size_t xFreeBytesRemaining = 0U;
+PRIVILEGED_DATA static size_t xMinimumEverFreeBytesRemaining = 0U;
+PRIVILEGED_DATA static size_t xNumberOfSuccessfulAllocations = 0;
+PRIVILEGED_DATA static size_t xNumberOfSuccessfulFrees = 0;
+
+/* Gets set to the top bit of an size_t type.  When this bit in the xBlockSize
+ * member of an BlockLink_t structure is set then the block belongs to the
+ * application.  When the bit is free the block is still part of the free heap
+ * space. */
+PRIVILEGED_DATA static size_t xBlockAllocatedBit = 0;
+
+/*-----------------------------------------------------------*/
+
+static portINLINE BaseType_t prvSizeClassIndex( size_t xPayloadSize )
+{
+    BaseType_t xClass = 0;
+    size_t xClassSize = heapSIZE_CLASS_MIN;
+
+    /* Bounded by heapNUM_SIZE_CLASSES, so constant time. */
+    while( ( xClassSize < xPayloadSize ) && ( xClass < heapNUM_SIZE_CLASSES ) )
+    {
+        xClassSize <<= 1;
+        xClass++;
+    }
+
+    return xClass;
+}
+/*-----------------------------------------------------------*/
+
+static portINLINE size_t prvSizeClassBlockSize( BaseType_t xClass )
+{
+    return ( heapSIZE_CLASS_MIN << xClass ) + xHeapStructSize;
+}
+/*-----------------------------------------------------------*/
+
+#if ( configAPPLICATION_DEFINED_HEAP_REGIONS == 0 )
+    static void prvHeapInit( void )
+    {
+        HeapRegion_t xDefaultRegions[ 2 ];
+
+        xDefaultRegions[ 0 ].pucStartAddress = ucHeap;
+        xDefaultRegions[ 0 ].xSizeInBytes = configTOTAL_HEAP_SIZE;
+        xDefaultRegions[ 1 ].pucStartAddress = NULL;
+        xDefaultRegions[ 1 ].xSizeInBytes = 0;
+
+        vPortDefineHeapRegions( xDefaultRegions );
+    }
+#endif /* configAPPLICATION_DEFINED_HEAP_REGIONS */
+/*-----------------------------------------------------------*/
+
+void * pvPortMalloc( size_t xWantedSize )
+{
+    BlockLink_t * pxBlock = NULL;
+    SizeClass_t * pxClass = NULL;
+    BaseType_t xClass;
+    void * pvReturn = NULL;
+
+    /* Check the requested block size is not so large that the top bit is
+     * set.  The top bit of the block size member of the BlockLink_t structure
+     * is used to determine who owns the block - the application or the
+     * kernel, so it must be free. */
+    if( ( xWantedSize == 0 ) || ( ( xWantedSize & xBlockAllocatedBit ) != 0 ) )
+    {
+        xWantedSize = 0;
+    }
+    else if( xWantedSize <= heapSIZE_CLASS_MAX )
+    {
+        /* Small request, try the size class cache first.  This is the fast
+         * path, a list pop in a short critical section. */
+        xClass = prvSizeClassIndex( xWantedSize );
+        pxClass = &( xSizeClasses[ xClass ] );
+        xWantedSize = prvSizeClassBlockSize( xClass );
+
+        taskENTER_CRITICAL();
+        {
+            pxBlock = pxClass->pxFreeList;
+
+            if( pxBlock != NULL )
+            {
+                pxClass->pxFreeList = pxBlock->pxNextFreeBlock;
+                pxClass->xCachedBlocks--;
+                pxClass->xHits++;
+                xFreeBytesRemaining -= xWantedSize;
+
+                if( xFreeBytesRemaining < xMinimumEverFreeBytesRemaining )
+                {
+                    xMinimumEverFreeBytesRemaining = xFreeBytesRemaining;
+                }
+
+                pxBlock->xBlockSize = xWantedSize | xBlockAllocatedBit;
+                pxBlock->pxNextFreeBlock = NULL;
+                xNumberOfSuccessfulAllocations++;
+            }
+            else
+            {
+                pxClass->xMisses++;
+            }
+        }
+        taskEXIT_CRITICAL();
+    }
+    else
+    {
+        /* The wanted size is increased so it can contain a BlockLink_t
+         * structure in addition to the requested amount of bytes. */
+        if( ( xWantedSize + xHeapStructSize ) > xWantedSize ) /* Overflow check */
+        {
+            xWantedSize += xHeapStructSize;
+
+            /* Ensure that blocks are always aligned */
+            if( ( xWantedSize & portBYTE_ALIGNMENT_MASK ) != 0x00 )
+            {
+                /* Byte alignment required. Check for overflow */
+                if( ( xWantedSize + ( portBYTE_ALIGNMENT - ( xWantedSize & portBYTE_ALIGNMENT_MASK ) ) ) >
+                    xWantedSize )
+                {
+                    xWantedSize += ( portBYTE_ALIGNMENT - ( xWantedSize & portBYTE_ALIGNMENT_MASK ) );
+                }
+                else
+                {
+                    xWantedSize = 0;
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            xWantedSize = 0;
+        }
+    }
+
+    if( ( pxBlock == NULL ) && ( xWantedSize > 0 ) )
+    {
+        vTaskSuspendAll();
+        {
+            #if ( configAPPLICATION_DEFINED_HEAP_REGIONS == 0 )
+                {
+                    /* If this is the first call to malloc and no regions
+                     * were defined, use the default heap array. */
+                    if( pxEnd == NULL )
+                    {
+                        prvHeapInit();
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+            #else
+                {
+                    /* The heap must be initialised before the first call to
+                     * pvPortMalloc(). */
+                    configASSERT( pxEnd );
+                }
+            #endif /* configAPPLICATION_DEFINED_HEAP_REGIONS */
+
+            pxBlock = prvAllocateFromFreeList( xWantedSize );
+
+            if( pxBlock == NULL )
+            {
+                /* The coalescing heap is too fragmented or too small, give
+                 * the cached blocks back to it and try again. */
+                prvReclaimSizeClasses();
+                pxBlock = prvAllocateFromFreeList( xWantedSize );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        ( void ) xTaskResumeAll();
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    if( pxBlock != NULL )
+    {
+        /* Return the memory space pointed to - jumping over the BlockLink_t
+         * structure at its start. */
+        pvReturn = ( void * ) ( ( ( uint8_t * ) pxBlock ) + xHeapStructSize );
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    traceMALLOC( pvReturn, xWantedSize );
+
+    #if ( configUSE_MALLOC_FAILED_HOOK == 1 )
+        {
+            if( pvReturn == NULL )
+            {
+                extern void vApplicationMallocFailedHook( void );
+                vApplicationMallocFailedHook();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+    #endif /* if ( configUSE_MALLOC_FAILED_HOOK == 1 ) */
+
+    configASSERT( ( ( ( size_t ) pvReturn ) & ( size_t ) portBYTE_ALIGNMENT_MASK ) == 0 );
+    return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vPortFree( void * pv )
+{
+    uint8_t * puc = ( uint8_t * ) pv;
+    BlockLink_t * pxLink;
+    SizeClass_t * pxClass;
+    BaseType_t xClass;
+    size_t xBlockSize;
+
+    if( pv != NULL )
+    {
+        /* The memory being freed will have an BlockLink_t structure immediately
+         * before it. */
+        puc -= xHeapStructSize;
+
+        /* This casting is to keep the compiler from issuing warnings. */
+        pxLink = ( void * ) puc;
+
+        /* Check the block is actually allocated. */
+        configASSERT( ( pxLink->xBlockSize & xBlockAllocatedBit ) != 0 );
+        configASSERT( pxLink->pxNextFreeBlock == NULL );
+
+        if( ( ( pxLink->xBlockSize & xBlockAllocatedBit ) != 0 ) &&
+            ( pxLink->pxNextFreeBlock == NULL ) )
+        {
+            /* The block is being returned to the heap - it is no longer
+             * allocated. */
+            pxLink->xBlockSize &= ~xBlockAllocatedBit;
+            xBlockSize = pxLink->xBlockSize;
+            traceFREE( pv, xBlockSize );
+
+            xClass = prvSizeClassIndex( xBlockSize - xHeapStructSize );
+
+            if( ( xClass < heapNUM_SIZE_CLASSES ) &&
+                ( prvSizeClassBlockSize( xClass ) == xBlockSize ) )
+            {
+                /* Size class block, push it on its class list. */
+                pxClass = &( xSizeClasses[ xClass ] );
+
+                taskENTER_CRITICAL();
+                {
+                    pxLink->pxNextFreeBlock = pxClass->pxFreeList;
+                    pxClass->pxFreeList = pxLink;
+                    pxClass->xCachedBlocks++;
+                    xFreeBytesRemaining += xBlockSize;
+                    xNumberOfSuccessfulFrees++;
+                }
+                taskEXIT_CRITICAL();
+            }
+            else
+            {
+                vTaskSuspendAll();
+                {
+                    /* Add this block to the list of free blocks. */
+                    prvInsertBlockIntoFreeList( pxLink );
+
+                    taskENTER_CRITICAL();
+                    {
+                        xFreeBytesRemaining += xBlockSize;
+                        xNumberOfSuccessfulFrees++;
+                    }
+                    taskEXIT_CRITICAL();
+                }
+                ( void ) xTaskResumeAll();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetFreeHeapSize( void )
+{
+    return xFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetMinimumEverFreeHeapSize( void )
+{
+    return xMinimumEverFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+void vPortInitialiseBlocks( void )
+{
+    /* This just exists to keep the linker quiet. */
+}
+/*-----------------------------------------------------------*/
+
+static BlockLink_t * prvAllocateFromFreeList( size_t xWantedSize )
+{
+    BlockLink_t * pxBlock, * pxPreviousBlock, * pxNewBlockLink;
+
+    if( xWantedSize > xFreeBytesRemaining )
+    {
+        return NULL;
+    }
+
+    /* Traverse the list from the start (lowest address) block until
+     * one of adequate size is found. */
+    pxPreviousBlock = &xStart;
+    pxBlock = xStart.pxNextFreeBlock;
+
+    while( ( pxBlock->xBlockSize < xWantedSize ) && ( pxBlock->pxNextFreeBlock != NULL ) )
+    {
+        pxPreviousBlock = pxBlock;
+        pxBlock = pxBlock->pxNextFreeBlock;
+    }
+
+    /* If the end marker was reached then a block of adequate size
+     * was not found. */
+    if( pxBlock == pxEnd )
+    {
+        return NULL;
+    }
+
+    /* This block is being returned for use so must be taken out
+     * of the list of free blocks. */
+    pxPreviousBlock->pxNextFreeBlock = pxBlock->pxNextFreeBlock;
+
+    /* If the block is larger than required it can be split into
+     * two. */
+    if( ( pxBlock->xBlockSize - xWantedSize ) > heapMINIMUM_BLOCK_SIZE )
+    {
+        /* This block is to be split into two.  Create a new
+         * block following the number of bytes requested. The void
+         * cast is used to prevent byte alignment warnings from the
+         * compiler. */
+        pxNewBlockLink = ( void * ) ( ( ( uint8_t * ) pxBlock ) + xWantedSize );
+
+        /* Calculate the sizes of two blocks split from the
+         * single block. */
+        pxNewBlockLink->xBlockSize = pxBlock->xBlockSize - xWantedSize;
+        pxBlock->xBlockSize = xWantedSize;
+
+        /* Insert the new block into the list of free blocks. */
+        prvInsertBlockIntoFreeList( ( pxNewBlockLink ) );
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    taskENTER_CRITICAL();
+    {
+        xFreeBytesRemaining -= pxBlock->xBlockSize;
+
+        if( xFreeBytesRemaining < xMinimumEverFreeBytesRemaining )
+        {
+            xMinimumEverFreeBytesRemaining = xFreeBytesRemaining;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        xNumberOfSuccessfulAllocations++;
+    }
+    taskEXIT_CRITICAL();
+
+    /* The block is being returned - it is allocated and owned
+     * by the application and has no "next" block. */
+    pxBlock->xBlockSize |= xBlockAllocatedBit;
+    pxBlock->pxNextFreeBlock = NULL;
+
+    return pxBlock;
+}
+/*-----------------------------------------------------------*/
+
+static void prvReclaimSizeClasses( void )
+{
+    BlockLink_t * pxCached[ heapNUM_SIZE_CLASSES ];
+    BlockLink_t * pxBlock;
+    BaseType_t xClass;
+
+    /* Detach the class lists in one go so that the fast path is not held up
+     * while the blocks are merged back. */
+    taskENTER_CRITICAL();
+    {
+        for( xClass = 0; xClass < heapNUM_SIZE_CLASSES; xClass++ )
+        {
+            pxCached[ xClass ] = xSizeClasses[ xClass ].pxFreeList;
+            xSizeClasses[ xClass ].pxFreeList = NULL;
+            xSizeClasses[ xClass ].xCachedBlocks = 0;
+        }
+    }
+    taskEXIT_CRITICAL();
+
+    for( xClass = 0; xClass < heapNUM_SIZE_CLASSES; xClass++ )
+    {
+        while( pxCached[ xClass ] != NULL )
+        {
+            pxBlock = pxCached[ xClass ];
+            pxCached[ xClass ] = pxBlock->pxNextFreeBlock;
+            prvInsertBlockIntoFreeList( pxBlock );
+        }
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvInsertBlockIntoFreeList( BlockLink_t * pxBlockToInsert )
+{
+    BlockLink_t * pxIterator;
+    uint8_t * puc;
+
+    /* Iterate through the list until a block is found that has a higher address
+     * than the block being inserted. */
+    for( pxIterator = &xStart; pxIterator->pxNextFreeBlock < pxBlockToInsert; pxIterator = pxIterator->pxNextFreeBlock )
+    {
+        /* Nothing to do here, just iterate to the right position. */
+    }
+
+    /* Do the block being inserted, and the block it is being inserted after
+     * make a contiguous block of memory? */
+    puc = ( uint8_t * ) pxIterator;
+
+    if( ( puc + pxIterator->xBlockSize ) == ( uint8_t * ) pxBlockToInsert )
+    {
+        pxIterator->xBlockSize += pxBlockToInsert->xBlockSize;
+        pxBlockToInsert = pxIterator;
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    /* Do the block being inserted, and the block it is being inserted before
+     * make a contiguous block of memory? */
+    puc = ( uint8_t * ) pxBlockToInsert;
+
+    if( ( puc + pxBlockToInsert->xBlockSize ) == ( uint8_t * ) pxIterator->pxNextFreeBlock )
+    {
+        if( pxIterator->pxNextFreeBlock != pxEnd )
+        {
+            /* Form one big block from the two blocks. */
+            pxBlockToInsert->xBlockSize += pxIterator->pxNextFreeBlock->xBlockSize;
+            pxBlockToInsert->pxNextFreeBlock = pxIterator->pxNextFreeBlock->pxNextFreeBlock;
+        }
+        else
+        {
+            pxBlockToInsert->pxNextFreeBlock = pxEnd;
+        }
+    }
+    else
+    {
+        pxBlockToInsert->pxNextFreeBlock = pxIterator->pxNextFreeBlock;
+    }
+
+    /* If the block being inserted plugged a gab, so was merged with the block
+     * before and the block after, then it's pxNextFreeBlock pointer will have
+     * already been set, and should not be set here as that would make it point
+     * to itself. */
+    if( pxIterator != pxBlockToInsert )
+    {
+        pxIterator->pxNextFreeBlock = pxBlockToInsert;
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+}
+/*-----------------------------------------------------------*/
+
+void vPortDefineHeapRegions( const HeapRegion_t * const pxHeapRegions )
+{
+    BlockLink_t * pxFirstFreeBlockInRegion = NULL, * pxPreviousFreeBlock;
+    size_t xAlignedHeap;
+    size_t xTotalRegionSize, xTotalHeapSize = 0;
+    BaseType_t xDefinedRegions = 0;
+    size_t xAddress;
+    const HeapRegion_t * pxHeapRegion;
+
+    /* Can only call once! */
+    configASSERT( pxEnd == NULL );
+
+    pxHeapRegion = &( pxHeapRegions[ xDefinedRegions ] );
+
+    while( pxHeapRegion->xSizeInBytes > 0 )
+    {
+        xTotalRegionSize = pxHeapRegion->xSizeInBytes;
+
+        /* Ensure the heap region starts on a correctly aligned boundary. */
+        xAddress = ( size_t ) pxHeapRegion->pucStartAddress;
+
+        if( ( xAddress & portBYTE_ALIGNMENT_MASK ) != 0 )
+        {
+            xAddress += ( portBYTE_ALIGNMENT - 1 );
+            xAddress &= ~portBYTE_ALIGNMENT_MASK;
+
+            /* Adjust the size for the bytes lost to alignment. */
+            xTotalRegionSize -= xAddress - ( size_t ) pxHeapRegion->pucStartAddress;
+        }
+
+        xAlignedHeap = xAddress;
+
+        /* Set xStart if it has not already been set. */
+        if( xDefinedRegions == 0 )
+        {
+            /* xStart is used to hold a pointer to the first item in the list of
+             *  free blocks.  The void cast is used to prevent compiler warnings. */
+            xStart.pxNextFreeBlock = ( BlockLink_t * ) xAlignedHeap;
+            xStart.xBlockSize = ( size_t ) 0;
+        }
+        else
+        {
+            /* Should only get here if one region has already been added to the
+             * heap. */
+            configASSERT( pxEnd != NULL );
+
+            /* Check blocks are passed in with increasing start addresses. */
+            configASSERT( xAddress > ( size_t ) pxEnd );
+        }
+
+        /* Remember the location of the end marker in the previous region, if
+         * any. */
+        pxPreviousFreeBlock = pxEnd;
+
+        /* pxEnd is used to mark the end of the list of free blocks and is
+         * inserted at the end of the region space. */
+        xAddress = xAlignedHeap + xTotalRegionSize;
+        xAddress -= xHeapStructSize;
+        xAddress &= ~portBYTE_ALIGNMENT_MASK;
+        pxEnd = ( BlockLink_t * ) xAddress;
+        pxEnd->xBlockSize = 0;
+        pxEnd->pxNextFreeBlock = NULL;
+
+        /* To start with there is a single free block in this region that is
+         * sized to take up the entire heap region minus the space taken by the
+         * free block structure. */
+        pxFirstFreeBlockInRegion = ( BlockLink_t * ) xAlignedHeap;
+        pxFirstFreeBlockInRegion->xBlockSize = xAddress - ( size_t ) pxFirstFreeBlockInRegion;
+        pxFirstFreeBlockInRegion->pxNextFreeBlock = pxEnd;
+
+        /* If this is not the first region that makes up the entire heap space
+         * then link the previous region to this region. */
+        if( pxPreviousFreeBlock != NULL )
+        {
+            pxPreviousFreeBlock->pxNextFreeBlock = pxFirstFreeBlockInRegion;
+        }
+
+        xTotalHeapSize += pxFirstFreeBlockInRegion->xBlockSize;
+
+        /* Move onto the next HeapRegion_t structure. */
+        xDefinedRegions++;
+        pxHeapRegion = &( pxHeapRegions[ xDefinedRegions ] );
+    }
+
+    xMinimumEverFreeBytesRemaining = xTotalHeapSize;
+    xFreeBytesRemaining = xTotalHeapSize;
+
+    /* Check something was actually defined before it is accessed. */
+    configASSERT( xTotalHeapSize );
+
+    /* Work out the position of the top bit in a size_t variable. */
+    xBlockAllocatedBit = ( ( size_t ) 1 ) << ( ( sizeof( size_t ) * heapBITS_PER_BYTE ) - 1 );
+}
+/*-----------------------------------------------------------*/
+
+void vPortGetHeapStats( HeapStats_t * pxHeapStats )
+{
+    BlockLink_t * pxBlock;
+    size_t xBlocks = 0, xMaxSize = 0, xMinSize = portMAX_DELAY; /* portMAX_DELAY used as a portable way of getting the maximum value. */
+
+    vTaskSuspendAll();
+    {
+        pxBlock = xStart.pxNextFreeBlock;
+
+        /* pxBlock will be NULL if the heap has not been initialised.  The heap
+         * is initialised automatically when the first allocation is made. */
+        if( pxBlock != NULL )
+        {
+            do
+            {
+                /* Increment the number of blocks and record the largest block seen
+                 * so far. */
+                xBlocks++;
+
+                if( pxBlock->xBlockSize > xMaxSize )
+                {
+                    xMaxSize = pxBlock->xBlockSize;
+                }
+
+                /* There is a zero sized block at the end of each region - the
+                 * block is only used to link to the next heap region so it not
+                 * a real block. */
+                if( pxBlock->xBlockSize != 0 )
+                {
+                    if( pxBlock->xBlockSize < xMinSize )
+                    {
+                        xMinSize = pxBlock->xBlockSize;
+                    }
+                }
+
+                /* Move to the next block in the chain until the last block is
+                 * reached. */
+                pxBlock = pxBlock->pxNextFreeBlock;
+            } while( pxBlock != pxEnd );
+        }
+    }
+    ( void ) xTaskResumeAll();
+
+    pxHeapStats->xSizeOfLargestFreeBlockInBytes = xMaxSize;
+    pxHeapStats->xSizeOfSmallestFreeBlockInBytes = xMinSize;
+    pxHeapStats->xNumberOfFreeBlocks = xBlocks;
+
+    taskENTER_CRITICAL();
+    {
+        pxHeapStats->xAvailableHeapSpaceInBytes = xFreeBytesRemaining;
+        pxHeapStats->xNumberOfSuccessfulAllocations = xNumberOfSuccessfulAllocations;
+        pxHeapStats->xNumberOfSuccessfulFrees = xNumberOfSuccessfulFrees;
+        pxHeapStats->xMinimumEverFreeBytesRemaining = xMinimumEverFreeBytesRemaining;
+    }
+    taskEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
+
+void vPortGetHeapClassStats( HeapClassStats_t * pxClassStats )
+{
+    BaseType_t xClass;
+
+    taskENTER_CRITICAL();
+    {
+        for( xClass = 0; xClass < heapNUM_SIZE_CLASSES; xClass++ )
+        {
+            pxClassStats[ xClass ].xClassSizeInBytes = heapSIZE_CLASS_MIN << xClass;
+            pxClassStats[ xClass ].xCachedBlocks = xSizeClasses[ xClass ].xCachedBlocks;
+            pxClassStats[ xClass ].xCachedBytes = xSizeClasses[ xClass ].xCachedBlocks *
+                                                  prvSizeClassBlockSize( xClass );
+            pxClassStats[ xClass ].xHits = xSizeClasses[ xClass ].xHits;
+            pxClassStats[ xClass ].xMisses = xSizeClasses[ xClass ].xMisses;
+        }
+    }
+    taskEXIT_CRITICAL();
+}
@@ -709,6 +709,11 @@ int remoteproc_shutdown(struct remoteproc *rproc);
  * load executable, it expects the user application defines how to
  * open the executable file and how to get data from the executable file
  * and how to load data to the target memory.
+ * If the image store sets SUPPORT_MMAP, the whole image is expected to be
+ * mapped by the open callback: headers are parsed in place and each
+ * segment is copied from the mapping with a single metal_io_block_write(),
+ * without calling the load callback. The optional verify callback is
+ * called for each segment right after it is copied, in either mode.
  *
  * @rproc: pointer to the remoteproc instance
  * @path: optional path to the image file
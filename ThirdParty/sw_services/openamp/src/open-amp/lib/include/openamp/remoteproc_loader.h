@@ -34,6 +34,8 @@ extern "C" {
 
 /* Loader feature macros */
 #define SUPPORT_SEEK 1UL
+/* The whole image is mapped in local memory by open(), load() is not used */
+#define SUPPORT_MMAP 2UL
 
 /* Remoteproc loader any address */
 #define RPROC_LOAD_ANYADDR ((metal_phys_addr_t)-1)
@@ -61,7 +63,12 @@ extern "C" {
  *         after loading
  * @load: user defined callback to load the firmware contents to target
  *        memory or local memory
- * @features: loader supported features. e.g. seek
+ * @verify: optional user defined callback to check a loadable segment
+ *          once it has been copied to the target memory, e.g. against a
+ *          per segment hash. @data points to the segment in the mapped
+ *          image if SUPPORT_MMAP is set, otherwise to the target memory.
+ *          Return 0 if the segment is valid, negative value otherwise.
+ * @features: loader supported features. e.g. seek, mmap
  */
 struct image_store_ops {
 	int (*open)(void *store, const char *path, const void **img_data);
@@ -70,6 +77,8 @@ struct image_store_ops {
 		    const void **data,
 		    metal_phys_addr_t pa,
 		    struct metal_io_region *io, char is_blocking);
+	int (*verify)(void *store, size_t offset, size_t size,
+		      const void *data, metal_phys_addr_t pa);
 	unsigned int features;
 };
 
@@ -98,9 +98,30 @@ remoteproc_patoda(struct remoteproc_mem *mem, metal_phys_addr_t pa)
 	return da;
 }
 
+/* Get image data into local memory. If the whole image is mapped (img is
+ * not NULL), point into the mapping instead of calling the store load.
+ */
+static int remoteproc_store_get(void *store,
+				struct image_store_ops *store_ops,
+				const void *img, size_t img_len,
+				size_t offset, size_t len,
+				const void **img_data)
+{
+	if (img) {
+		if (offset > img_len || len > img_len - offset)
+			return -RPROC_EINVAL;
+		*img_data = (const char *)img + offset;
+		return (int)len;
+	}
+	*img_data = NULL;
+	return store_ops->load(store, offset, len, img_data,
+			       RPROC_LOAD_ANYADDR, NULL, 1);
+}
+
 static void *remoteproc_get_rsc_table(struct remoteproc *rproc,
 				      void *store,
 				      struct image_store_ops *store_ops,
+				      const void *img, size_t img_len,
 				      size_t offset,
 				      size_t len)
 {
@@ -115,8 +136,8 @@ static void *remoteproc_get_rsc_table(struct remoteproc *rproc,
 	if (!rsc_table) {
 		return RPROC_ERR_PTR(-RPROC_ENOMEM);
 	}
-	ret = store_ops->load(store, offset, len, &img_data, RPROC_LOAD_ANYADDR,
-			      NULL, 1);
+	ret = remoteproc_store_get(store, store_ops, img, img_len, offset, len,
+				   &img_data);
 	if (ret < 0 || ret < (int)len || !img_data) {
 		metal_log(METAL_LOG_ERROR,
 			  "get rsc failed: 0x%llx, 0x%llx\r\n", offset, len);
@@ -398,6 +419,8 @@ int remoteproc_load(struct remoteproc *rproc, const char *path,
 	int ret;
 	struct loader_ops *loader;
 	const void *img_data;
+	const void *img = NULL;
+	size_t img_len = 0;
 	void *limg_info = NULL;
 	size_t offset, noffset;
 	size_t len, nlen;
@@ -440,6 +463,11 @@ int remoteproc_load(struct remoteproc *rproc, const char *path,
 	}
 	len = ret;
 	metal_assert(img_data);
+	if ((store_ops->features & SUPPORT_MMAP) != 0) {
+		/* open() mapped the whole image, take all data from it */
+		img = img_data;
+		img_len = len;
+	}
 
 	/* Check executable format to select a parser */
 	loader = rproc->loader;
@@ -476,7 +504,7 @@ int remoteproc_load(struct remoteproc *rproc, const char *path,
 		} else if ((ret & RPROC_LOADER_READY_TO_LOAD) != 0) {
 			if (nlen == 0)
 				break;
-			else if ((noffset > (offset + len)) &&
+			else if ((noffset > (offset + len)) && !img &&
 				 (store_ops->features & SUPPORT_SEEK) == 0) {
 				/* Required data is not continued, however
 				 * seek is not supported, stop to load
@@ -489,11 +517,8 @@ int remoteproc_load(struct remoteproc *rproc, const char *path,
 			}
 		}
 		/* Continue to load headers image data */
-		img_data = NULL;
-		ret = store_ops->load(store, noffset, nlen,
-				      &img_data,
-				      RPROC_LOAD_ANYADDR,
-				      NULL, 1);
+		ret = remoteproc_store_get(store, store_ops, img, img_len,
+					   noffset, nlen, &img_data);
 		if (ret < (int)nlen) {
 			metal_log(METAL_LOG_ERROR,
 				  "load image data failed 0x%x,%d\r\n",
@@ -507,6 +532,7 @@ int remoteproc_load(struct remoteproc *rproc, const char *path,
 	if (ret == 0 && rsc_size > 0) {
 		/* parse resource table */
 		rsc_table = remoteproc_get_rsc_table(rproc, store, store_ops,
+						     img, img_len,
 						     offset, rsc_size);
 	}
 
@@ -551,8 +577,24 @@ int remoteproc_load(struct remoteproc *rproc, const char *path,
 				goto error3;
 			}
 			if (nlen > 0) {
-				ret = store_ops->load(store, noffset, nlen,
-						      &img_data, pa, io, 1);
+				if (img) {
+					/* Single copy from the mapped image */
+					ret = -RPROC_EINVAL;
+					if (noffset <= img_len &&
+					    nlen <= img_len - noffset) {
+						img_data = (const char *)img +
+							   noffset;
+						ret = metal_io_block_write(io,
+							metal_io_phys_to_offset(io, pa),
+							img_data, nlen);
+					}
+				} else {
+					ret = store_ops->load(store, noffset,
+							      nlen, &img_data,
+							      pa, io, 1);
+					img_data = metal_io_phys_to_virt(io,
+									 pa);
+				}
 				if (ret != (int)nlen) {
 					metal_log(METAL_LOG_ERROR,
 						  "load data failed 0x%lx, 0x%lx, 0x%x\r\n",
@@ -560,6 +602,16 @@ int remoteproc_load(struct remoteproc *rproc, const char *path,
 					ret = -RPROC_EINVAL;
 					goto error3;
 				}
+				if (store_ops->verify &&
+				    store_ops->verify(store, noffset, nlen,
+						      img_data, pa) < 0) {
+					metal_log(METAL_LOG_ERROR,
+						  "load data verify failed 0x%lx, 0x%lx, 0x%x\r\n",
+						  pa, noffset, nlen);
+					ret = -RPROC_EINVAL;
+					goto error3;
+				}
+				img_data = NULL;
 			}
 			if (nmemsize > nlen) {
 				size_t tmpoffset;
@@ -570,10 +622,9 @@ int remoteproc_load(struct remoteproc *rproc, const char *path,
 						   padding, (nmemsize - nlen));
 			}
 		} else if (nlen != 0) {
-			ret = store_ops->load(store, noffset, nlen,
-					      &img_data,
-					      RPROC_LOAD_ANYADDR,
-					      NULL, 1);
+			ret = remoteproc_store_get(store, store_ops,
+						   img, img_len,
+						   noffset, nlen, &img_data);
 			if (ret < (int)nlen) {
 				if ((last_load_state &
 				    RPROC_LOADER_POST_DATA_LOAD) != 0) {
@@ -601,6 +652,7 @@ int remoteproc_load(struct remoteproc *rproc, const char *path,
 			/* parse resource table */
 			rsc_table = remoteproc_get_rsc_table(rproc, store,
 							     store_ops,
+							     img, img_len,
 							     offset,
 							     rsc_size);
 		}
@@ -76,6 +76,8 @@
  * 8.0   srt  01/29/14 Added support for Micro DMA Mode.
  * 9.2   vak  15/04/16 Fixed compilation warnings in axidma driver
  * 9.8   rsp  07/11/18 Fix cppcheck portability warnings. CR #1006164
+ * 9.15  ant  10/18/26 Added XAXIDMA_CACHE_FLUSH_RANGE and
+ *		       XAXIDMA_CACHE_INVALIDATE_RANGE for BD sets.
  *
  * </pre>
  *****************************************************************************/
@@ -120,12 +122,21 @@ typedef u32 XAxiDma_Bd[XAXIDMA_BD_NUM_WORDS];
 #ifdef __aarch64__
 #define XAXIDMA_CACHE_FLUSH(BdPtr)
 #define XAXIDMA_CACHE_INVALIDATE(BdPtr)
+#define XAXIDMA_CACHE_FLUSH_RANGE(Addr, Len)
+#define XAXIDMA_CACHE_INVALIDATE_RANGE(Addr, Len)
 #else
 #define XAXIDMA_CACHE_FLUSH(BdPtr) \
 	Xil_DCacheFlushRange((UINTPTR)(BdPtr), XAXIDMA_BD_HW_NUM_BYTES)
 
 #define XAXIDMA_CACHE_INVALIDATE(BdPtr) \
 	Xil_DCacheInvalidateRange((UINTPTR)(BdPtr), XAXIDMA_BD_HW_NUM_BYTES)
+
+/* Same as above for a contiguous run of BDs starting at Addr */
+#define XAXIDMA_CACHE_FLUSH_RANGE(Addr, Len) \
+	Xil_DCacheFlushRange((UINTPTR)(Addr), (Len))
+
+#define XAXIDMA_CACHE_INVALIDATE_RANGE(Addr, Len) \
+	Xil_DCacheInvalidateRange((UINTPTR)(Addr), (Len))
 #endif
 
 /*****************************************************************************/
@@ -44,6 +44,8 @@
 *       rsp  01/17/18  Use virtual address for register read/write.
 *                      In _BdRingCreate() assign VA to BdaRestart CR#976392
 * 9.9   rsp  02/05/19  Fix XAxiDma_BdRingFromHw implementation for cyclic mode.
+* 9.15  ant  10/18/26  Do the BD cache maintenance of XAxiDma_BdRingToHw and
+*		       XAxiDma_BdRingFromHw once per BD set instead of per BD.
 *
 * </pre>
 ******************************************************************************/
@@ -143,6 +145,13 @@
 
 /************************** Function Prototypes ******************************/
 
+#ifdef __aarch64__
+#define XAxiDma_BdRingCacheSet(RingPtr, BdSetPtr, NumBd, Flush)
+#else
+static void XAxiDma_BdRingCacheSet(XAxiDma_BdRing *RingPtr,
+			XAxiDma_Bd *BdSetPtr, int NumBd, int Flush);
+#endif
+
 /************************** Variable Definitions *****************************/
 
 
@@ -1055,9 +1064,6 @@ int XAxiDma_BdRingToHw(XAxiDma_BdRing * RingPtr, int NumBd,
 		BdSts &=  ~XAXIDMA_BD_STS_COMPLETE_MASK;
 		XAxiDma_BdWrite(CurBdPtr, XAXIDMA_BD_STS_OFFSET, BdSts);
 
-		/* Flush the current BD so DMA core could see the updates */
-		XAXIDMA_CACHE_FLUSH(CurBdPtr);
-
 		CurBdPtr = (XAxiDma_Bd *)((void *)XAxiDma_BdRingNext(RingPtr, CurBdPtr));
 		BdCr = XAxiDma_BdRead(CurBdPtr, XAXIDMA_BD_CTRL_LEN_OFFSET);
 		BdSts = XAxiDma_BdRead(CurBdPtr, XAXIDMA_BD_STS_OFFSET);
@@ -1086,8 +1092,8 @@ int XAxiDma_BdRingToHw(XAxiDma_BdRing * RingPtr, int NumBd,
 	BdSts &= ~XAXIDMA_BD_STS_COMPLETE_MASK;
 	XAxiDma_BdWrite(CurBdPtr, XAXIDMA_BD_STS_OFFSET, BdSts);
 
-	/* Flush the last BD so DMA core could see the updates */
-	XAXIDMA_CACHE_FLUSH(CurBdPtr);
+	/* Flush the whole set so DMA core could see the updates */
+	XAxiDma_BdRingCacheSet(RingPtr, BdSetPtr, NumBd, TRUE);
 	DATA_SYNC;
 
 	/* This set has completed pre-processing, adjust ring pointers and
@@ -1249,9 +1255,13 @@ int XAxiDma_BdRingFromHw(XAxiDma_BdRing * RingPtr, int BdLimit,
 	 *  - The number of requested BDs has been processed
 	 */
 
+	/* Invalidate all the BDs that may be returned at once rather than
+	 * one by one in the loop below
+	 */
+	XAxiDma_BdRingCacheSet(RingPtr, CurBdPtr, BdLimit, FALSE);
+
 	while (BdCount < BdLimit) {
 		/* Read the status */
-		XAXIDMA_CACHE_INVALIDATE(CurBdPtr);
 		BdSts = XAxiDma_BdRead(CurBdPtr, XAXIDMA_BD_STS_OFFSET);
 		BdCr = XAxiDma_BdRead(CurBdPtr, XAXIDMA_BD_CTRL_LEN_OFFSET);
 
@@ -1285,7 +1295,6 @@ int XAxiDma_BdRingFromHw(XAxiDma_BdRing * RingPtr, int BdLimit,
 		if (RingPtr->Cyclic) {
 			BdSts = BdSts & ~XAXIDMA_BD_STS_COMPLETE_MASK;
 			XAxiDma_BdWrite(CurBdPtr, XAXIDMA_BD_STS_OFFSET, BdSts);
-			XAXIDMA_CACHE_FLUSH(CurBdPtr);
 		}
 
 		/* Reached the end of the work group */
@@ -1297,6 +1306,13 @@ int XAxiDma_BdRingFromHw(XAxiDma_BdRing * RingPtr, int BdLimit,
 		CurBdPtr = (XAxiDma_Bd *)((void *)XAxiDma_BdRingNext(RingPtr, CurBdPtr));
 	}
 
+	/* In cyclic mode the status of every completed BD was cleared above,
+	 * flush them back for the next pass of the hardware
+	 */
+	if (RingPtr->Cyclic && BdCount) {
+		XAxiDma_BdRingCacheSet(RingPtr, RingPtr->HwHead, BdCount, TRUE);
+	}
+
 	/* Subtract off any partial packet BDs found */
 	BdCount -= BdPartialCount;
 
@@ -1590,4 +1606,58 @@ void XAxiDma_BdRingDumpRegs(XAxiDma_BdRing *RingPtr) {
 
 	xil_printf("\r\n");
 }
+
+#ifndef __aarch64__
+/*****************************************************************************/
+/**
+ * Flush or invalidate the cache for a set of consecutive BDs in the ring.
+ * BDs are contiguous in memory, so the set is covered by a single range, or
+ * by two ranges when it wraps past the last BD of the ring.
+ *
+ * @param	RingPtr is a pointer to the descriptor ring to be worked on.
+ * @param	BdSetPtr is the first BD of the set.
+ * @param	NumBd is the number of BDs in the set.
+ * @param	Flush is TRUE to flush the set, FALSE to invalidate it.
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+static void XAxiDma_BdRingCacheSet(XAxiDma_BdRing *RingPtr,
+			XAxiDma_Bd *BdSetPtr, int NumBd, int Flush)
+{
+	UINTPTR Start = (UINTPTR)BdSetPtr;
+	UINTPTR RingEnd = RingPtr->LastBdAddr + RingPtr->Separation;
+	u32 Len;
+	u32 WrapLen = 0U;
+
+	if (NumBd <= 0) {
+		return;
+	}
+
+	Len = (u32)RingPtr->Separation * (u32)NumBd;
+	if (Len > RingPtr->Length) {
+		Len = RingPtr->Length;
+	}
+
+	if ((RingEnd - Start) < Len) {
+		WrapLen = Len - (u32)(RingEnd - Start);
+		Len -= WrapLen;
+	}
+
+	if (Flush) {
+		XAXIDMA_CACHE_FLUSH_RANGE(Start, Len);
+		if (WrapLen != 0U) {
+			XAXIDMA_CACHE_FLUSH_RANGE(RingPtr->FirstBdAddr,
+						  WrapLen);
+		}
+	}
+	else {
+		XAXIDMA_CACHE_INVALIDATE_RANGE(Start, Len);
+		if (WrapLen != 0U) {
+			XAXIDMA_CACHE_INVALIDATE_RANGE(RingPtr->FirstBdAddr,
+						       WrapLen);
+		}
+	}
+}
+#endif
 /** @} */
@@ -44,6 +44,8 @@
 * 9.2   vak  15/04/16  Fixed the compilation warnings in axidma driver
 * 9.7   rsp  01/11/18  Use UINTPTR instead of u32 for ChanBase CR#976392
 * 9.15  adk  08/16/22  Fix syntax error in the XAxiDma_BdRingGetCurrBd() API.
+*       ant  10/18/26  Cast the extended current BD address to a pointer
+*                      through UINTPTR, as the 32 bit address already was
 *
 * </pre>
 *
@@ -217,8 +219,8 @@ typedef struct {
 				UINTPTR)XAxiDma_ReadReg((RingPtr)->ChanBase,   \
 				XAXIDMA_CDESC_OFFSET);                         \
 			} else {			                       \
-				(RingPtr)->BdaRestart  = (XAxiDma_Bd *)((      \
-				XAxiDma_ReadReg((RingPtr)->ChanBase,  	       \
+				(RingPtr)->BdaRestart  = (XAxiDma_Bd *)(       \
+				UINTPTR)((XAxiDma_ReadReg((RingPtr)->ChanBase, \
 				XAXIDMA_CDESC_OFFSET)) |                       \
 				(LEFT_SHIFT_BY_32_BITS (XAxiDma_ReadReg(       \
 				(RingPtr)->ChanBase,                           \
@@ -233,7 +235,7 @@ typedef struct {
 					XAXIDMA_CDESC_OFFSET);		       \
 				} else {	                               \
 					(RingPtr)->BdaRestart  =               \
-					(XAxiDma_Bd *)((XAxiDma_ReadReg(       \
+					(XAxiDma_Bd *)(UINTPTR)((XAxiDma_ReadReg( \
 					(RingPtr)->ChanBase,  		       \
 					XAXIDMA_CDESC_OFFSET)) |               \
 					(LEFT_SHIFT_BY_32_BITS                 \
@@ -250,7 +252,7 @@ typedef struct {
 					XAXIDMA_RX_NDESC_OFFSET)); 	       \
 				} else {			               \
 					(RingPtr)->BdaRestart  =               \
-					(XAxiDma_Bd *)((XAxiDma_ReadReg(       \
+					(XAxiDma_Bd *)(UINTPTR)((XAxiDma_ReadReg( \
 					(RingPtr)->ChanBase,  		       \
 					XAXIDMA_CDESC_OFFSET)) |               \
 					(LEFT_SHIFT_BY_32_BITS                 \
@@ -279,11 +281,11 @@ typedef struct {
 *
 *****************************************************************************/
 #define XAxiDma_BdRingGetCurrBd(RingPtr)				       \
-	RingPtr->Addr_ext ? ((XAxiDma_Bd *)                                    \
+	RingPtr->Addr_ext ? ((XAxiDma_Bd *)(UINTPTR)                           \
 	((XAxiDma_ReadReg((RingPtr)->ChanBase,		                       \
 	XAXIDMA_CDESC_OFFSET)) | (LEFT_SHIFT_BY_32_BITS                        \
 	(XAxiDma_ReadReg((RingPtr)->ChanBase, XAXIDMA_CDESC_MSB_OFFSET))))) :  \
-	((XAxiDma_Bd *)XAxiDma_ReadReg((RingPtr)->ChanBase,                    \
+	((XAxiDma_Bd *)(UINTPTR)XAxiDma_ReadReg((RingPtr)->ChanBase,           \
 	XAXIDMA_CDESC_OFFSET));
 
 /****************************************************************************/
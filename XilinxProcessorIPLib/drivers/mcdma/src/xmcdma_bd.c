@@ -22,6 +22,8 @@
 *  1.3  rsp  02/11/19 Add top level submit XMcDma_Chan_Sideband_Submit() API
 *                     to program BD control and sideband information.
 *  1.4  rsp  09/17/19 Prefer using dmb in XMcdma_UpdateChanTDesc.
+*  1.7  ant  18/10/26 Flush/invalidate submitted and completed BDs once per
+*                     set instead of once per BD.
 ******************************************************************************/
 
 #include "xmcdma.h"
@@ -57,6 +59,12 @@
         (BdPtr) = (XMcdma_Bd *)(void *)Addr;                            \
     }
 
+#ifdef __aarch64__
+#define XMcdma_BdChainCacheSet(Chan, BdSetPtr, NumBd, Flush)
+#else
+static void XMcdma_BdChainCacheSet(XMcdma_ChanCtrl *Chan,
+				   XMcdma_Bd *BdSetPtr, u32 NumBd, u32 Flush);
+#endif
 
 /*****************************************************************************/
 /**
@@ -211,13 +219,11 @@ u32 XMcDma_ChanBdCreate(XMcdma_ChanCtrl *Chan, UINTPTR Addr, u32 Count)
 		XMcdma_BdWrite(BdStartAddr, XMCDMA_BD_HAS_CTRLSTS_OFFSET,
 			       Chan->HasStsCntrlStrm);
 
-		XMCDMA_CACHE_FLUSH(BdStartAddr);
 		BdStartAddr += Chan->Separation;
 		NxtBdAddr   += Chan->Separation;
 	}
 
 	/* Link the last Bd to the first Bd */
-	XMCDMA_CACHE_FLUSH(BdStartAddr);
 	XMcdma_BdWrite(BdStartAddr, XMCDMA_BD_NDESC_OFFSET, (u32)Addr);
 	XMcdma_BdWrite(BdStartAddr, XMCDMA_BD_NDESC_MSB_OFFSET,
 		       UPPER_32_BITS(Addr));
@@ -246,6 +252,9 @@ u32 XMcDma_ChanBdCreate(XMcdma_ChanCtrl *Chan, UINTPTR Addr, u32 Count)
 	Chan->BdTail = (XMcdma_Bd *) Addr;
 	Chan->BdRestart = (XMcdma_Bd *) Addr;
 
+	/* Flush the whole chain once it is linked */
+	XMcdma_BdChainCacheSet(Chan, Chan->BdHead, Count, TRUE);
+
 	return XST_SUCCESS;
 }
 
@@ -299,13 +308,13 @@ u32 XMcDma_ChanSubmit(XMcdma_ChanCtrl *Chan, UINTPTR BufAddr, u32 len)
 		XMcdma_BdWrite(BdCurPtr, XMCDMA_BD_CTRL_OFFSET, Bdlen);
 
 		Chan->BdTail = BdCurPtr;
-		XMCDMA_CACHE_FLUSH((UINTPTR)(BdCurPtr));
 		BdCurPtr = (XMcdma_Bd *)XMcdma_BdChainNextBd(Chan, BdCurPtr);
 		BufAddr += Bdlen;
 		len -= Bdlen;
 	}
 
-	XMCDMA_CACHE_FLUSH((UINTPTR)(BdCurPtr));
+	/* Flush all the BDs of this submission at once */
+	XMcdma_BdChainCacheSet(Chan, Chan->BdRestart, BdCount, TRUE);
 	DATA_SYNC;
 	Chan->BdRestart = BdCurPtr;
 	Chan->BdPendingCnt += BdCount;
@@ -382,13 +391,13 @@ u32 XMcDma_Chan_Sideband_Submit(XMcdma_ChanCtrl *ChanPtr, UINTPTR BufAddr,
 		}
 
 		ChanPtr->BdTail = BdCurPtr;
-		XMCDMA_CACHE_FLUSH((UINTPTR)(BdCurPtr));
 		BdCurPtr = (XMcdma_Bd *)XMcdma_BdChainNextBd(ChanPtr, BdCurPtr);
 		BufAddr += Bdlen;
 		Len -= Bdlen;
 	}
 
-	XMCDMA_CACHE_FLUSH((UINTPTR)(BdCurPtr));
+	/* Flush all the BDs of this submission at once */
+	XMcdma_BdChainCacheSet(ChanPtr, ChanPtr->BdRestart, BdCount, TRUE);
 	DATA_SYNC;
 	ChanPtr->BdRestart = BdCurPtr;
 	ChanPtr->BdPendingCnt += BdCount;
@@ -479,9 +488,11 @@ int XMcdma_BdChainFromHW(XMcdma_ChanCtrl *Chan, u32 BdLimit, XMcdma_Bd **BdSetPt
 		BdLimit = Chan->BdSubmitCnt;
 	}
 
-	while (BdCount < BdLimit) {
-		XMCDMA_CACHE_INVALIDATE((UINTPTR)(CurBdPtr));
+	/* Invalidate all the BDs that may be returned at once rather than
+	 * one by one in the loop below */
+	XMcdma_BdChainCacheSet(Chan, CurBdPtr, BdLimit, FALSE);
 
+	while (BdCount < BdLimit) {
 		if(!(Chan->IsRxChan)) {
 			BdSts = XMcdma_BdRead(CurBdPtr, XMCDMA_BD_SIDEBAND_STS_OFFSET);
 			BdCr = XMcdma_BdRead(CurBdPtr, XMCDMA_BD_CTRL_OFFSET);
@@ -791,3 +802,51 @@ void XMcDma_DumpBd(XMcdma_Bd* BdPtr)
 
 	xil_printf("\r\n");
 }
+
+#ifndef __aarch64__
+/*****************************************************************************/
+/**
+* Flush or invalidate the cache for a set of consecutive BDs of the chain.
+* The set is covered by a single range, or by two ranges when it wraps past
+* the last BD of the chain.
+*
+* @param	Chan is the MCDMA Channel to be worked on.
+* @param	BdSetPtr is the first BD of the set.
+* @param	NumBd is the number of BDs in the set.
+* @param	Flush is TRUE to flush the set, FALSE to invalidate it.
+*
+* @return	None
+*
+*****************************************************************************/
+static void XMcdma_BdChainCacheSet(XMcdma_ChanCtrl *Chan,
+				   XMcdma_Bd *BdSetPtr, u32 NumBd, u32 Flush)
+{
+	UINTPTR Start = (UINTPTR)BdSetPtr;
+	UINTPTR ChainEnd = Chan->LastBdAddr + Chan->Separation;
+	u32 Len;
+	u32 WrapLen = 0U;
+
+	if (NumBd == 0U)
+		return;
+
+	Len = (u32)Chan->Separation * NumBd;
+	if (Len > Chan->Length)
+		Len = Chan->Length;
+
+	if ((ChainEnd - Start) < Len) {
+		WrapLen = Len - (u32)(ChainEnd - Start);
+		Len -= WrapLen;
+	}
+
+	if (Flush) {
+		XMCDMA_CACHE_FLUSH_RANGE(Start, Len);
+		if (WrapLen != 0U)
+			XMCDMA_CACHE_FLUSH_RANGE(Chan->FirstBdAddr, WrapLen);
+	} else {
+		XMCDMA_CACHE_INVALIDATE_RANGE(Start, Len);
+		if (WrapLen != 0U)
+			XMCDMA_CACHE_INVALIDATE_RANGE(Chan->FirstBdAddr,
+						      WrapLen);
+	}
+}
+#endif
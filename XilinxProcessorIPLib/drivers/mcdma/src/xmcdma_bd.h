@@ -16,6 +16,8 @@
 * 1.0	adk  18/07/17 Initial version.
 * 1.2	mj   05/03/18 Added macro XMcdma_BdSetSwId and XMcdma_BdGetSwId to set
 *                     and get Sw ID field from BD.
+* 1.7	ant  18/10/26 Added XMCDMA_CACHE_FLUSH_RANGE and
+*                     XMCDMA_CACHE_INVALIDATE_RANGE for BD sets.
 *****************************************************************************/
 
 #ifndef XMCDMA_BD_H_
@@ -34,12 +36,21 @@ typedef u32 XMcdma_Bd[16];
 #ifdef __aarch64__
 #define XMCDMA_CACHE_FLUSH(BdPtr)
 #define XMCDMA_CACHE_INVALIDATE(BdPtr)
+#define XMCDMA_CACHE_FLUSH_RANGE(Addr, Len)
+#define XMCDMA_CACHE_INVALIDATE_RANGE(Addr, Len)
 #else
 #define XMCDMA_CACHE_FLUSH(BdPtr) \
         Xil_DCacheFlushRange((UINTPTR)(BdPtr), XMCDMA_BD_HW_NUM_BYTES)
 
 #define XMCDMA_CACHE_INVALIDATE(BdPtr) \
         Xil_DCacheInvalidateRange((UINTPTR)(BdPtr), XMCDMA_BD_HW_NUM_BYTES)
+
+/* Same as above for a contiguous run of BDs starting at Addr */
+#define XMCDMA_CACHE_FLUSH_RANGE(Addr, Len) \
+        Xil_DCacheFlushRange((UINTPTR)(Addr), (Len))
+
+#define XMCDMA_CACHE_INVALIDATE_RANGE(Addr, Len) \
+        Xil_DCacheInvalidateRange((UINTPTR)(Addr), (Len))
 #endif
 
 
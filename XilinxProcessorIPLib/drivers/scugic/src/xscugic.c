@@ -7,7 +7,7 @@
 /**
 *
 * @file xscugic.c
-* @addtogroup scugic_v5_0
+* @addtogroup scugic_v5_1
 * @{
 *
 * Contains required functions for the XScuGic driver for the Interrupt
@@ -144,6 +144,8 @@
 *                     This is fixed with this change.
 * 5.0   dp   04/25/22 Update XScuGic_GetPriorityTriggerType() to read and
 *                     update priority and trigger properly for GICv3.
+* 5.1   ant  10/18/26 XScuGic_SoftwareIntr records the time the interrupt is
+*                     raised when XSCUGIC_ENABLE_STATS is defined.
 * </pre>
 *
 ******************************************************************************/
@@ -753,6 +755,11 @@ s32  XScuGic_SoftwareIntr(XScuGic *InstancePtr, u32 Int_Id, u32 Cpu_Identifier)
 	Xil_AssertNonvoid(Int_Id <= 15U);
 	Xil_AssertNonvoid(Cpu_Identifier <= 255U);
 
+#if defined (XSCUGIC_ENABLE_STATS)
+	/* Measure the entry latency of the interrupt from now */
+	XScuGic_StatsMarkRaised(Int_Id);
+#endif
+
 #if defined (GICv3)
 	Mask = (Cpu_Identifier | (Int_Id << XSCUGIC_SGIR_EL1_INITID_SHIFT));
 #if EL3
@@ -7,7 +7,7 @@
 /**
 *
 * @file xscugic.h
-* @addtogroup scugic_v5_0
+* @addtogroup scugic_v5_1
 * @{
 * @details
 *
@@ -53,6 +53,27 @@
 *
 * Nested interrupts are not supported by this driver.
 *
+* <b>Multiple Interrupts per Entry</b>
+*
+* XScuGic_InterruptHandler services one interrupt per exception entry.
+* XScuGic_InterruptDrainHandler, connected the same way, keeps acknowledging
+* and dispatching pending interrupts until none is left or
+* XSCUGIC_DRAIN_MAX_INTRS have been serviced, which saves the exception
+* entry and exit of every interrupt arriving in a burst.
+*
+* <b>Interrupt Statistics</b>
+*
+* When the driver is built with XSCUGIC_ENABLE_STATS defined, both handlers
+* time every interrupt they dispatch with XTime_GetTime(), the global timer
+* of the processor. For each interrupt ID the count, minimum, average,
+* maximum and a power of two histogram of the handler duration and of the
+* entry latency are kept. The entry latency is measured from the time the
+* interrupt was raised, when known (software interrupts generated by
+* XScuGic_SoftwareIntr() or sources calling XScuGic_StatsMarkRaised()),
+* and from the entry into the driver handler otherwise. XScuGic_StatsPrint()
+* prints them, XScuGic_GetIntrStats() returns them to the application. The
+* application must be compiled with the same define to see these APIs.
+*
 * NOTE:
 * The generic interrupt controller is not a part of the snoop control unit
 * as indicated by the prefix "scu" in the name of the driver.
@@ -179,6 +200,9 @@
 *                     XScuGic_Get_Rdist_Int_Trigger_Index
 * 5.0   dp   11/07/22 Add macros for accessing the GIC Binary Point and
 *                     Running Priority registers of Cortex-R52.
+* 5.1   ant  10/18/26 Added XScuGic_InterruptDrainHandler and the optional
+*                     per interrupt statistics of xscugic_stats.c, enabled
+*                     by XSCUGIC_ENABLE_STATS.
 * </pre>
 *
 ******************************************************************************/
@@ -198,6 +222,9 @@ extern "C" {
 #include "xscugic_hw.h"
 #include "xil_exception.h"
 #include "xil_spinlock.h"
+#if defined (XSCUGIC_ENABLE_STATS)
+#include "xtime_l.h"
+#endif
 
 /************************** Constant Definitions *****************************/
 
@@ -210,6 +237,29 @@ extern "C" {
 
 #define XSCUGIC500_DCTLR_ARE_NS_ENABLE  0x20
 #define XSCUGIC500_DCTLR_ARE_S_ENABLE  0x10
+
+/*
+ * Maximum number of interrupts XScuGic_InterruptDrainHandler services in
+ * one entry, to bound the time spent with interrupts masked.
+ */
+#ifndef XSCUGIC_DRAIN_MAX_INTRS
+#define XSCUGIC_DRAIN_MAX_INTRS		8U
+#endif
+
+#if defined (XSCUGIC_ENABLE_STATS)
+/*
+ * Histogram of the statistics: bucket 0 counts times below
+ * 2^XSCUGIC_STATS_HIST_SHIFT timer counts, bucket N times from
+ * 2^(XSCUGIC_STATS_HIST_SHIFT + N - 1) to twice that, and the last bucket
+ * everything longer.
+ */
+#ifndef XSCUGIC_STATS_HIST_BUCKETS
+#define XSCUGIC_STATS_HIST_BUCKETS	12U
+#endif
+#ifndef XSCUGIC_STATS_HIST_SHIFT
+#define XSCUGIC_STATS_HIST_SHIFT	4U
+#endif
+#endif
 /**************************** Type Definitions *******************************/
 
 /* The following data type defines each entry in an interrupt vector table.
@@ -246,6 +296,42 @@ typedef struct
 	u32 UnhandledInterrupts; /**< Intc Statistics */
 } XScuGic;
 
+#if defined (XSCUGIC_ENABLE_STATS)
+/**
+ * Distribution of a time, in XTime_GetTime() counts.
+ */
+typedef struct
+{
+	u32 Min;	/**< Shortest time */
+	u32 Max;	/**< Longest time */
+	u64 Sum;	/**< Sum of all times, for the average */
+	u32 Hist[XSCUGIC_STATS_HIST_BUCKETS];	/**< Histogram */
+} XScuGic_TimeStats;
+
+/**
+ * Statistics of one interrupt ID.
+ */
+typedef struct
+{
+	u32 Count;			/**< Number of times dispatched */
+	XScuGic_TimeStats Duration;	/**< Time spent in the handler */
+	XScuGic_TimeStats Latency;	/**< Time from raise, or from entry
+					  *  into the driver handler, to the
+					  *  call of the handler */
+} XScuGic_IntrStats;
+
+/**
+ * Statistics of the driver interrupt handlers.
+ */
+typedef struct
+{
+	u32 Entries;		/**< Number of handler entries */
+	u32 Dispatched;		/**< Number of interrupts dispatched */
+	u32 Spurious;		/**< Entries which found no valid interrupt */
+	u32 MaxPerEntry;	/**< Most interrupts dispatched in one entry */
+} XScuGic_EntryStats;
+#endif
+
 /************************** Variable Definitions *****************************/
 
 extern XScuGic_Config XScuGic_ConfigTable[];	/**< Config table */
@@ -643,6 +729,20 @@ XScuGic_Config *XScuGic_LookupConfigBaseAddr(UINTPTR BaseAddress);
  * Interrupt functions in xscugic_intr.c
  */
 void XScuGic_InterruptHandler(XScuGic *InstancePtr);
+void XScuGic_InterruptDrainHandler(XScuGic *InstancePtr);
+
+#if defined (XSCUGIC_ENABLE_STATS)
+/*
+ * Statistics functions in xscugic_stats.c
+ */
+void XScuGic_StatsReset(void);
+void XScuGic_StatsMarkRaised(u32 Int_Id);
+void XScuGic_StatsRecord(u32 Int_Id, XTime Entry, XTime Start, XTime End);
+void XScuGic_StatsRecordEntry(u32 Dispatched);
+const XScuGic_IntrStats *XScuGic_GetIntrStats(u32 Int_Id);
+const XScuGic_EntryStats *XScuGic_GetEntryStats(void);
+void XScuGic_StatsPrint(void);
+#endif
 
 /*
  * Self-test functions in xscugic_selftest.c
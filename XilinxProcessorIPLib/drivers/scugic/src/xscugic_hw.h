@@ -7,7 +7,7 @@
 /**
 *
 * @file xscugic_hw.h
-* @addtogroup scugic_v5_0
+* @addtogroup scugic_v5_1
 * @{
 *
 * This header file contains identifiers and HW access functions (or
@@ -7,7 +7,7 @@
 /**
 *
 * @file xscugic_intr.c
-* @addtogroup scugic_v5_0
+* @addtogroup scugic_v5_1
 * @{
 *
 * This file contains the interrupt processing for the driver for the Xilinx
@@ -27,6 +27,10 @@
 * is encouraged to supply their own interrupt handler when performance tuning is
 * deemed necessary.
 *
+* XScuGic_InterruptDrainHandler may be connected instead of
+* XScuGic_InterruptHandler. It services all pending interrupts, up to
+* XSCUGIC_DRAIN_MAX_INTRS, before returning.
+*
 * <pre>
 * MODIFICATION HISTORY:
 *
@@ -40,6 +44,9 @@
 *                     reported by coverity tool. It fixes CR#1006344.
 * 3.10  mus  07/17/18 Updated file to fix the various coding style issues
 *                     reported by checkpatch. It fixes CR#1006344.
+* 5.1   ant  10/18/26 Added XScuGic_InterruptDrainHandler. Both handlers time
+*                     the dispatched interrupts when XSCUGIC_ENABLE_STATS is
+*                     defined.
 *
 * </pre>
 *
@@ -68,6 +75,11 @@
 
 /************************** Function Prototypes ******************************/
 
+#if defined (XSCUGIC_ENABLE_STATS)
+static void StatsDispatch(const XScuGic_VectorTableEntry *TablePtr,
+			  u32 InterruptID, XTime Entry);
+#endif
+
 /************************** Variable Definitions *****************************/
 
 /*****************************************************************************/
@@ -99,6 +111,11 @@ void XScuGic_InterruptHandler(XScuGic *InstancePtr)
 	    u32 IntIDFull;
 #endif
 	    XScuGic_VectorTableEntry *TablePtr;
+#if defined (XSCUGIC_ENABLE_STATS)
+	    XTime Entry;
+
+	    XTime_GetTime(&Entry);
+#endif
 
 	    /* Assert that the pointer to the instance is valid
 	     */
@@ -116,6 +133,9 @@ void XScuGic_InterruptHandler(XScuGic *InstancePtr)
 	    InterruptID = IntIDFull & XSCUGIC_ACK_INTID_MASK;
 #endif
 	    if (XSCUGIC_MAX_NUM_INTR_INPUTS <= InterruptID) {
+#if defined (XSCUGIC_ENABLE_STATS)
+		XScuGic_StatsRecordEntry(0U);
+#endif
 		goto IntrExit;
 	    }
 
@@ -141,7 +161,12 @@ void XScuGic_InterruptHandler(XScuGic *InstancePtr)
 	     */
 	    TablePtr = &(InstancePtr->Config->HandlerTable[InterruptID]);
 		if (TablePtr != NULL) {
+#if defined (XSCUGIC_ENABLE_STATS)
+			StatsDispatch(TablePtr, InterruptID, Entry);
+			XScuGic_StatsRecordEntry(1U);
+#else
 			TablePtr->Handler(TablePtr->CallBackRef);
+#endif
 		}
 
 IntrExit:
@@ -160,4 +185,102 @@ IntrExit:
 	     * could happen here.
 	     */
 }
+
+/*****************************************************************************/
+/**
+* This function is an alternative to XScuGic_InterruptHandler, connected in
+* the same way. After servicing the highest priority interrupt it reads the
+* interrupt acknowledge register again and services the next pending
+* interrupt, until no valid interrupt is pending or XSCUGIC_DRAIN_MAX_INTRS
+* interrupts have been serviced. Interrupts arriving in a burst are thus
+* serviced without an exception exit and entry for each of them, at the
+* cost of one extra acknowledge register read per entry.
+*
+* Every interrupt is still acknowledged and ended individually, in priority
+* order, so handlers see no difference.
+*
+* @param	InstancePtr is a pointer to the XScuGic instance.
+*
+* @return	None.
+*
+* @note		Interrupts stay masked for the whole drain. Lower
+*		XSCUGIC_DRAIN_MAX_INTRS if that is too long for the system.
+*
+******************************************************************************/
+void XScuGic_InterruptDrainHandler(XScuGic *InstancePtr)
+{
+	u32 InterruptID;
+#if !defined (GICv3)
+	u32 IntIDFull;
+#endif
+	XScuGic_VectorTableEntry *TablePtr;
+	u32 Count = 0U;
+#if defined (XSCUGIC_ENABLE_STATS)
+	XTime Entry;
+
+	XTime_GetTime(&Entry);
+#endif
+
+	Xil_AssertVoid(InstancePtr != NULL);
+
+	do {
+		/*
+		 * Acknowledge the highest priority pending interrupt. A
+		 * spurious ID (1023) means that none is left.
+		 */
+#if defined (GICv3)
+		InterruptID = XScuGic_get_IntID();
+#else
+		IntIDFull = XScuGic_CPUReadReg(InstancePtr,
+					       XSCUGIC_INT_ACK_OFFSET);
+		InterruptID = IntIDFull & XSCUGIC_ACK_INTID_MASK;
+#endif
+		if (XSCUGIC_MAX_NUM_INTR_INPUTS > InterruptID) {
+			TablePtr = &(InstancePtr->Config->HandlerTable[InterruptID]);
+#if defined (XSCUGIC_ENABLE_STATS)
+			StatsDispatch(TablePtr, InterruptID, Entry);
+#else
+			TablePtr->Handler(TablePtr->CallBackRef);
+#endif
+			Count++;
+		}
+
+		/* End the interrupt, as XScuGic_InterruptHandler does */
+#if defined (GICv3)
+		XScuGic_ack_Int(InterruptID);
+#else
+		XScuGic_CPUWriteReg(InstancePtr, XSCUGIC_EOI_OFFSET, IntIDFull);
+#endif
+	} while ((XSCUGIC_MAX_NUM_INTR_INPUTS > InterruptID) &&
+		 (Count < XSCUGIC_DRAIN_MAX_INTRS));
+
+#if defined (XSCUGIC_ENABLE_STATS)
+	XScuGic_StatsRecordEntry(Count);
+#endif
+}
+
+#if defined (XSCUGIC_ENABLE_STATS)
+/*****************************************************************************/
+/**
+* Calls the handler of an interrupt and records its latency and duration.
+*
+* @param	TablePtr is the vector table entry of the interrupt.
+* @param	InterruptID is the interrupt ID.
+* @param	Entry is the time the driver handler was entered.
+*
+* @return	None.
+*
+******************************************************************************/
+static void StatsDispatch(const XScuGic_VectorTableEntry *TablePtr,
+			  u32 InterruptID, XTime Entry)
+{
+	XTime Start;
+	XTime End;
+
+	XTime_GetTime(&Start);
+	TablePtr->Handler(TablePtr->CallBackRef);
+	XTime_GetTime(&End);
+	XScuGic_StatsRecord(InterruptID, Entry, Start, End);
+}
+#endif
 /** @} */
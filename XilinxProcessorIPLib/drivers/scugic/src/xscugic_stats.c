@@ -0,0 +1,346 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xscugic_stats.c
+* @addtogroup scugic_v5_1
+* @{
+*
+* Contains the optional per interrupt statistics of the XScuGic driver,
+* built when XSCUGIC_ENABLE_STATS is defined. XScuGic_InterruptHandler and
+* XScuGic_InterruptDrainHandler record every interrupt they dispatch, see
+* xscugic.h for a description of what is measured.
+*
+* The statistics are kept per interrupt ID, in tables shared by all XScuGic
+* instances and all cores running this image. Times are XTime_GetTime()
+* counts, converted to nanoseconds only when printed.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- ---------------------------------------------------------
+* 5.1   ant  10/18/26 First release
+* </pre>
+*
+* @note
+*
+* Recording is not atomic. Interrupts of one core are serialized by the
+* handlers, but an SMP image taking interrupts on several cores at once may
+* occasionally lose an update of a shared interrupt ID.
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "xil_types.h"
+#include "xil_assert.h"
+#include "xil_printf.h"
+#include "xscugic.h"
+
+#if defined (XSCUGIC_ENABLE_STATS)
+
+/************************** Constant Definitions *****************************/
+
+#define XSCUGIC_STATS_TIME_MAX	0xFFFFFFFFU
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+
+static u32 Elapsed(XTime From, XTime To);
+static u32 HistBucket(u32 Time);
+static void TimeRecord(XScuGic_TimeStats *StatsPtr, u32 Time, u32 IsFirst);
+static u32 CountsToNs(u64 Counts);
+static void TimePrint(const char8 *Name, const XScuGic_TimeStats *StatsPtr,
+		      u32 Count);
+
+/************************** Variable Definitions *****************************/
+
+static XScuGic_IntrStats IntrStats[XSCUGIC_MAX_NUM_INTR_INPUTS];
+static XScuGic_EntryStats EntryStats;
+static XTime RaisedTime[XSCUGIC_MAX_NUM_INTR_INPUTS];
+static volatile u8 IsRaised[XSCUGIC_MAX_NUM_INTR_INPUTS];
+
+/*****************************************************************************/
+/**
+*
+* Clears all interrupt statistics.
+*
+* @return	None.
+*
+* @note		Call it with interrupts disabled, or expect the interrupts
+*		being serviced meanwhile to be partially recorded.
+*
+******************************************************************************/
+void XScuGic_StatsReset(void)
+{
+	static const XScuGic_IntrStats ClearedIntr;
+	static const XScuGic_EntryStats ClearedEntry;
+	u32 Int_Id;
+
+	for (Int_Id = 0U; Int_Id < XSCUGIC_MAX_NUM_INTR_INPUTS; Int_Id++) {
+		IntrStats[Int_Id] = ClearedIntr;
+		IsRaised[Int_Id] = 0U;
+	}
+	EntryStats = ClearedEntry;
+}
+
+/*****************************************************************************/
+/**
+*
+* Records the time an interrupt is raised, so that its next dispatch
+* measures the entry latency from now rather than from the entry into the
+* driver handler. XScuGic_SoftwareIntr() calls it for software interrupts.
+* A device driver may call it where it starts an operation that completes
+* with an interrupt, and timer interrupts may pass their expiry by calling
+* it just before the timer fires.
+*
+* @param	Int_Id is the interrupt ID.
+*
+* @return	None.
+*
+******************************************************************************/
+void XScuGic_StatsMarkRaised(u32 Int_Id)
+{
+	if (Int_Id < XSCUGIC_MAX_NUM_INTR_INPUTS) {
+		XTime_GetTime(&RaisedTime[Int_Id]);
+		IsRaised[Int_Id] = 1U;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* Records one dispatch of an interrupt. Called by the driver handlers.
+*
+* @param	Int_Id is the interrupt ID.
+* @param	Entry is the time the driver handler was entered.
+* @param	Start is the time the interrupt handler was called.
+* @param	End is the time the interrupt handler returned.
+*
+* @return	None.
+*
+******************************************************************************/
+void XScuGic_StatsRecord(u32 Int_Id, XTime Entry, XTime Start, XTime End)
+{
+	XScuGic_IntrStats *StatsPtr;
+	XTime From = Entry;
+	u32 IsFirst;
+
+	if (Int_Id >= XSCUGIC_MAX_NUM_INTR_INPUTS) {
+		return;
+	}
+	if (IsRaised[Int_Id] != 0U) {
+		IsRaised[Int_Id] = 0U;
+		From = RaisedTime[Int_Id];
+	}
+
+	StatsPtr = &IntrStats[Int_Id];
+	IsFirst = (StatsPtr->Count == 0U) ? 1U : 0U;
+	if (StatsPtr->Count != XSCUGIC_STATS_TIME_MAX) {
+		StatsPtr->Count++;
+	}
+	TimeRecord(&StatsPtr->Duration, Elapsed(Start, End), IsFirst);
+	TimeRecord(&StatsPtr->Latency, Elapsed(From, Start), IsFirst);
+}
+
+/*****************************************************************************/
+/**
+*
+* Records one entry into a driver handler. Called by the driver handlers.
+*
+* @param	Dispatched is the number of interrupts dispatched by the
+*		entry, 0 when no valid interrupt was pending.
+*
+* @return	None.
+*
+******************************************************************************/
+void XScuGic_StatsRecordEntry(u32 Dispatched)
+{
+	EntryStats.Entries++;
+	EntryStats.Dispatched += Dispatched;
+	if (Dispatched == 0U) {
+		EntryStats.Spurious++;
+	}
+	if (Dispatched > EntryStats.MaxPerEntry) {
+		EntryStats.MaxPerEntry = Dispatched;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* Returns the statistics of an interrupt ID.
+*
+* @param	Int_Id is the interrupt ID.
+*
+* @return	Pointer to the statistics, NULL if Int_Id is out of range.
+*		Times are in XTime_GetTime() counts, COUNTS_PER_SECOND per
+*		second.
+*
+******************************************************************************/
+const XScuGic_IntrStats *XScuGic_GetIntrStats(u32 Int_Id)
+{
+	const XScuGic_IntrStats *StatsPtr = NULL;
+
+	if (Int_Id < XSCUGIC_MAX_NUM_INTR_INPUTS) {
+		StatsPtr = &IntrStats[Int_Id];
+	}
+
+	return StatsPtr;
+}
+
+/*****************************************************************************/
+/**
+*
+* Returns the statistics of the driver handler entries.
+*
+* @return	Pointer to the statistics.
+*
+******************************************************************************/
+const XScuGic_EntryStats *XScuGic_GetEntryStats(void)
+{
+	return &EntryStats;
+}
+
+/*****************************************************************************/
+/**
+*
+* Prints the handler entry statistics, then the statistics of every
+* interrupt ID dispatched at least once: count and min/avg/max in ns of the
+* handler duration and of the entry latency, each followed by its histogram.
+*
+* @return	None.
+*
+******************************************************************************/
+void XScuGic_StatsPrint(void)
+{
+	const XScuGic_IntrStats *StatsPtr;
+	u32 Int_Id;
+	u32 Bucket;
+
+	xil_printf("GIC: %u entries, %u interrupts, %u spurious, "
+		   "at most %u per entry\r\n", EntryStats.Entries,
+		   EntryStats.Dispatched, EntryStats.Spurious,
+		   EntryStats.MaxPerEntry);
+
+	xil_printf("Histogram buckets (ns):");
+	for (Bucket = 1U; Bucket < XSCUGIC_STATS_HIST_BUCKETS; Bucket++) {
+		xil_printf(" <%u", CountsToNs((u64)1U <<
+			   (XSCUGIC_STATS_HIST_SHIFT + Bucket - 1U)));
+	}
+	xil_printf(" more\r\n");
+
+	for (Int_Id = 0U; Int_Id < XSCUGIC_MAX_NUM_INTR_INPUTS; Int_Id++) {
+		StatsPtr = &IntrStats[Int_Id];
+		if (StatsPtr->Count == 0U) {
+			continue;
+		}
+		xil_printf("IRQ %u: count %u\r\n", Int_Id, StatsPtr->Count);
+		TimePrint("duration", &StatsPtr->Duration, StatsPtr->Count);
+		TimePrint("latency", &StatsPtr->Latency, StatsPtr->Count);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* Returns the time between two XTime_GetTime() values, saturated to 32 bits.
+*
+******************************************************************************/
+static u32 Elapsed(XTime From, XTime To)
+{
+	u64 Diff = (u64)(XTime)(To - From);
+
+	return (Diff > XSCUGIC_STATS_TIME_MAX) ? XSCUGIC_STATS_TIME_MAX :
+		(u32)Diff;
+}
+
+/*****************************************************************************/
+/**
+*
+* Returns the histogram bucket of a time.
+*
+******************************************************************************/
+static u32 HistBucket(u32 Time)
+{
+	u32 Value = Time >> XSCUGIC_STATS_HIST_SHIFT;
+	u32 Bucket = 0U;
+
+#if defined (__GNUC__)
+	if (Value != 0U) {
+		Bucket = 32U - (u32)__builtin_clz(Value);
+	}
+#else
+	while (Value != 0U) {
+		Value >>= 1U;
+		Bucket++;
+	}
+#endif
+	if (Bucket >= XSCUGIC_STATS_HIST_BUCKETS) {
+		Bucket = XSCUGIC_STATS_HIST_BUCKETS - 1U;
+	}
+
+	return Bucket;
+}
+
+/*****************************************************************************/
+/**
+*
+* Adds a time to a distribution.
+*
+******************************************************************************/
+static void TimeRecord(XScuGic_TimeStats *StatsPtr, u32 Time, u32 IsFirst)
+{
+	if ((IsFirst != 0U) || (Time < StatsPtr->Min)) {
+		StatsPtr->Min = Time;
+	}
+	if (Time > StatsPtr->Max) {
+		StatsPtr->Max = Time;
+	}
+	StatsPtr->Sum += Time;
+	StatsPtr->Hist[HistBucket(Time)]++;
+}
+
+/*****************************************************************************/
+/**
+*
+* Converts XTime_GetTime() counts to nanoseconds, saturated to 32 bits.
+*
+******************************************************************************/
+static u32 CountsToNs(u64 Counts)
+{
+	u64 Ns = (Counts * 1000000000U) / (u64)COUNTS_PER_SECOND;
+
+	return (Ns > XSCUGIC_STATS_TIME_MAX) ? XSCUGIC_STATS_TIME_MAX : (u32)Ns;
+}
+
+/*****************************************************************************/
+/**
+*
+* Prints one distribution and its histogram.
+*
+******************************************************************************/
+static void TimePrint(const char8 *Name, const XScuGic_TimeStats *StatsPtr,
+		      u32 Count)
+{
+	u32 Bucket;
+
+	xil_printf("  %s ns: min %u avg %u max %u, hist", Name,
+		   CountsToNs(StatsPtr->Min),
+		   CountsToNs(StatsPtr->Sum / Count),
+		   CountsToNs(StatsPtr->Max));
+	for (Bucket = 0U; Bucket < XSCUGIC_STATS_HIST_BUCKETS; Bucket++) {
+		xil_printf(" %u", StatsPtr->Hist[Bucket]);
+	}
+	xil_printf("\r\n");
+}
+
+#endif /* XSCUGIC_ENABLE_STATS */
+/** @} */
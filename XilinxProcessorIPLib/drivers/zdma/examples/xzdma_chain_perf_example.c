@@ -0,0 +1,356 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xzdma_chain_perf_example.c
+*
+* This file contains an example measuring the throughput of repeated scatter
+* gather transfers of the same set of buffers, as done by frame copy
+* pipelines. The same frame is moved FRAME_COUNT times:
+*	- with XZDma_Start(), which rebuilds the descriptors for every frame,
+*	- with XZDma_ChainStart() on a chain built once by XZDma_ChainCreate(),
+*	- with two chains linked by XZDma_ChainLink(), two frames per start,
+*	  retired together through the chain done events.
+* For each case the total time and the CPU time spent starting the transfers
+* are printed in XTime counts together with the throughput.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- -----------------------------------------------------
+* 1.16  ant    10/18/26  First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xzdma.h"
+#include "xparameters.h"
+#include "xil_cache.h"
+#include "xil_printf.h"
+#include "xtime_l.h"
+
+/************************** Constant Definitions ******************************/
+
+/*
+ * The following constants map to the XPAR parameters created in the
+ * xparameters.h file. They are defined here such that a user can easily
+ * change all the needed parameters in one place.
+ */
+#define ZDMA_DEVICE_ID		XPAR_XZDMA_0_DEVICE_ID /* ZDMA device Id */
+
+#define FRAME_BLOCKS		8U	/**< Transfers per frame */
+#define BLOCK_SIZE		4096U	/**< Bytes per transfer */
+#define FRAME_SIZE		(FRAME_BLOCKS * BLOCK_SIZE)
+#define FRAME_COUNT		256U	/**< Frames moved in each case */
+#define DSCR_MEM_SIZE		(FRAME_BLOCKS * 2U * sizeof(XZDma_LlDscr))
+
+/**************************** Type Definitions *******************************/
+
+/************************** Function Prototypes ******************************/
+
+int XZDma_ChainPerfExample(u16 DeviceId);
+static u32 WaitDone(XZDma *InstancePtr);
+static void PrintResult(const char *Name, XTime Total, XTime Setup,
+			u32 Frames);
+static int VerifyFrames(void);
+
+/************************** Variable Definitions *****************************/
+
+XZDma ZDma;		/**<Instance of the ZDMA Device */
+
+#if defined(__ICCARM__)
+    #pragma data_alignment = 64
+	u8 SrcBuf[2][FRAME_SIZE];
+    #pragma data_alignment = 64
+	u8 DstBuf[2][FRAME_SIZE];
+    #pragma data_alignment = 64
+	u8 BdListMem[DSCR_MEM_SIZE];
+    #pragma data_alignment = 64
+	u8 ChainMem[2][DSCR_MEM_SIZE];
+#else
+u8 SrcBuf[2][FRAME_SIZE] __attribute__ ((aligned (64)));
+u8 DstBuf[2][FRAME_SIZE] __attribute__ ((aligned (64)));
+u8 BdListMem[DSCR_MEM_SIZE] __attribute__ ((aligned (64)));
+u8 ChainMem[2][DSCR_MEM_SIZE] __attribute__ ((aligned (64)));
+#endif
+
+/*****************************************************************************/
+/**
+*
+* Main function to call the example.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_FAILURE if failed.
+*
+* @note		None.
+*
+******************************************************************************/
+int main(void)
+{
+	int Status;
+
+	Status = XZDma_ChainPerfExample((u16)ZDMA_DEVICE_ID);
+	if (Status != XST_SUCCESS) {
+		xil_printf("ZDMA Chain Perf Example Failed\r\n");
+		return XST_FAILURE;
+	}
+
+	xil_printf("Successfully ran ZDMA Chain Perf Example\r\n");
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function runs the three cases of the benchmark in polled mode.
+*
+* @param	DeviceId is the XPAR_<ZDMA Instance>_DEVICE_ID value from
+*		xparameters.h.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_FAILURE if failed.
+*
+* @note		None.
+*
+******************************************************************************/
+int XZDma_ChainPerfExample(u16 DeviceId)
+{
+	int Status;
+	XZDma_Config *Config;
+	XZDma_DataConfig Configur;
+	XZDma_Transfer Data[2][FRAME_BLOCKS];
+	XZDma_Chain Chain[2];
+	XTime Start, End, Before, After;
+	XTime Setup;
+	u32 Frame;
+	u32 Index;
+	u32 Buf;
+	u32 DoneCnt;
+
+	Config = XZDma_LookupConfig(DeviceId);
+	if (NULL == Config) {
+		return XST_FAILURE;
+	}
+
+	Status = XZDma_CfgInitialize(&ZDma, Config, Config->BaseAddress);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	Status = XZDma_SetMode(&ZDma, TRUE, XZDMA_NORMAL_MODE);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+
+	XZDma_GetChDataConfig(&ZDma, &Configur);
+	Configur.OverFetch = 0;
+	if (Config->IsCacheCoherent) {
+		Configur.SrcCache = 0xF;
+		Configur.DstCache = 0xF;
+	}
+	XZDma_SetChDataConfig(&ZDma, &Configur);
+
+	/* Two frames, each made of FRAME_BLOCKS separate transfers */
+	for (Buf = 0U; Buf < 2U; Buf++) {
+		for (Index = 0U; Index < FRAME_SIZE; Index++) {
+			SrcBuf[Buf][Index] = (u8)(Index + Buf);
+			DstBuf[Buf][Index] = 0U;
+		}
+		for (Index = 0U; Index < FRAME_BLOCKS; Index++) {
+			Data[Buf][Index].SrcAddr =
+				(UINTPTR)&SrcBuf[Buf][Index * BLOCK_SIZE];
+			Data[Buf][Index].DstAddr =
+				(UINTPTR)&DstBuf[Buf][Index * BLOCK_SIZE];
+			Data[Buf][Index].Size = BLOCK_SIZE;
+			Data[Buf][Index].SrcCoherent = 0;
+			Data[Buf][Index].DstCoherent = 0;
+			Data[Buf][Index].Pause = 0;
+		}
+	}
+
+	if (!Config->IsCacheCoherent) {
+		Xil_DCacheFlushRange((INTPTR)SrcBuf, sizeof(SrcBuf));
+		Xil_DCacheFlushRange((INTPTR)DstBuf, sizeof(DstBuf));
+	}
+
+	xil_printf("counts_per_second: %u\r\n", (u32)COUNTS_PER_SECOND);
+	xil_printf("frame_bytes: %u\r\n", FRAME_SIZE);
+
+	/* Case 1: descriptors rebuilt by XZDma_Start() for every frame */
+	XZDma_CreateBDList(&ZDma, XZDMA_LINKEDLIST, (UINTPTR)BdListMem,
+			   DSCR_MEM_SIZE);
+	Setup = 0U;
+	XTime_GetTime(&Start);
+	for (Frame = 0U; Frame < FRAME_COUNT; Frame++) {
+		XTime_GetTime(&Before);
+		Status = XZDma_Start(&ZDma, Data[0], FRAME_BLOCKS);
+		XTime_GetTime(&After);
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+		Setup += After - Before;
+		(void)WaitDone(&ZDma);
+	}
+	XTime_GetTime(&End);
+	PrintResult("start", End - Start, Setup, FRAME_COUNT);
+
+	/* Case 2: the same frame from a chain built once */
+	Status = XZDma_ChainCreate(&ZDma, &Chain[0], XZDMA_LINKEDLIST,
+			(UINTPTR)ChainMem[0], DSCR_MEM_SIZE, Data[0],
+			FRAME_BLOCKS);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+	Setup = 0U;
+	XTime_GetTime(&Start);
+	for (Frame = 0U; Frame < FRAME_COUNT; Frame++) {
+		XTime_GetTime(&Before);
+		Status = XZDma_ChainStart(&ZDma, &Chain[0]);
+		XTime_GetTime(&After);
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+		Setup += After - Before;
+		(void)WaitDone(&ZDma);
+	}
+	XTime_GetTime(&End);
+	PrintResult("chain", End - Start, Setup, FRAME_COUNT);
+
+	/*
+	 * Case 3: two linked chains run with one start, both chains raise
+	 * their done event and are retired together.
+	 */
+	Status = XZDma_ChainCreate(&ZDma, &Chain[1], XZDMA_LINKEDLIST,
+			(UINTPTR)ChainMem[1], DSCR_MEM_SIZE, Data[1],
+			FRAME_BLOCKS);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+	XZDma_ChainSetDoneIntr(&Chain[0], TRUE);
+	XZDma_ChainSetDoneIntr(&Chain[1], TRUE);
+	Status = XZDma_ChainLink(&Chain[0], &Chain[1]);
+	if (Status != XST_SUCCESS) {
+		return XST_FAILURE;
+	}
+	(void)XZDma_GetDstIntrCnt(&ZDma);
+	Setup = 0U;
+	XTime_GetTime(&Start);
+	for (Frame = 0U; Frame < FRAME_COUNT; Frame += 2U) {
+		XTime_GetTime(&Before);
+		Status = XZDma_ChainStart(&ZDma, &Chain[0]);
+		XTime_GetTime(&After);
+		if (Status != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+		Setup += After - Before;
+		DoneCnt = WaitDone(&ZDma);
+		if (DoneCnt != 2U) {
+			xil_printf("linked chains done %u, expected 2\r\n",
+				   DoneCnt);
+			return XST_FAILURE;
+		}
+	}
+	XTime_GetTime(&End);
+	PrintResult("linked", End - Start, Setup, FRAME_COUNT);
+
+	Status = VerifyFrames();
+
+	/* Reset the DMA to remove all configurations done in this example  */
+	XZDma_Reset(&ZDma);
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function polls the ZDMA until the started transfers are completed.
+*
+* @param	InstancePtr is a pointer to the XZDma instance.
+*
+* @return	Number of chain done events collected while waiting.
+*
+* @note		None.
+*
+******************************************************************************/
+static u32 WaitDone(XZDma *InstancePtr)
+{
+	u32 Total = 0U;
+	u32 DoneCnt;
+	s32 Status;
+
+	do {
+		Status = XZDma_ChainPollDone(InstancePtr, &DoneCnt);
+		Total += DoneCnt;
+	} while (Status != XST_SUCCESS);
+
+	return Total;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function prints the result of one case of the benchmark.
+*
+* @param	Name is the name of the case.
+* @param	Total is the time taken by all the frames.
+* @param	Setup is the CPU time spent starting the transfers.
+* @param	Frames is the number of frames moved.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void PrintResult(const char *Name, XTime Total, XTime Setup,
+			u32 Frames)
+{
+	u64 Bytes = (u64)FRAME_SIZE * Frames;
+
+	xil_printf("%s_total_counts: %u\r\n", Name, (u32)Total);
+	xil_printf("%s_setup_counts_per_frame: %u\r\n", Name,
+		   (u32)(Setup / Frames));
+	xil_printf("%s_kbytes_per_second: %u\r\n", Name,
+		   (u32)(((Bytes * COUNTS_PER_SECOND) / Total) / 1024U));
+}
+
+/*****************************************************************************/
+/**
+*
+* This function checks that both destination frames match their source.
+*
+* @return
+*		- XST_SUCCESS if the data matches.
+*		- XST_FAILURE otherwise.
+*
+* @note		None.
+*
+******************************************************************************/
+static int VerifyFrames(void)
+{
+	u32 Buf;
+	u32 Index;
+
+	if (!ZDma.Config.IsCacheCoherent) {
+		Xil_DCacheInvalidateRange((INTPTR)DstBuf, sizeof(DstBuf));
+	}
+
+	for (Buf = 0U; Buf < 2U; Buf++) {
+		for (Index = 0U; Index < FRAME_SIZE; Index++) {
+			if (SrcBuf[Buf][Index] != DstBuf[Buf][Index]) {
+				return XST_FAILURE;
+			}
+		}
+	}
+
+	return XST_SUCCESS;
+}
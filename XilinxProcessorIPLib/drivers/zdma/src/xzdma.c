@@ -7,7 +7,7 @@
 /**
 *
 * @file xzdma.c
-* @addtogroup zdma_v1_14
+* @addtogroup zdma_v1_16
 * @{
 *
 * This file contains the implementation of the interface functions for ZDMA
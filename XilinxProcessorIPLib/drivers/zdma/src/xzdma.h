@@ -7,7 +7,7 @@
 /**
 *
 * @file xzdma.h
-* @addtogroup zdma_v1_14
+* @addtogroup zdma_v1_16
 * @{
 * @details
 *
@@ -115,6 +115,8 @@
 *                        in applications directly.
 * 1.14	adk	03/15/22 Fixed syntax errors in zdma_tapp.tcl file, when stdout
 * 			 is configured as none.
+* 1.16  ant     10/18/26 Added persistent descriptor chains, XZDma_Chain* APIs
+*			 in xzdma_chain.c.
 * </pre>
 *
 ******************************************************************************/
@@ -352,6 +354,29 @@ typedef struct {
 				  *  this transfer only for SG mode */
 } XZDma_Transfer;
 
+/******************************************************************************/
+/**
+*
+* This typedef contains a persistent scatter gather descriptor chain. It is
+* built once by XZDma_ChainCreate() and started any number of times by
+* XZDma_ChainStart().
+*/
+typedef struct {
+	void *SrcDscrPtr;	/**< First source descriptor */
+	void *DstDscrPtr;	/**< First destination descriptor */
+	u32 DscrCount;		/**< Number of transfers in the chain */
+	u32 DscrSize;		/**< Size of one descriptor in bytes */
+	XZDma_DscrType DscrType;/**< Type of descriptor either Linear or
+				  *  Linked list type */
+	u32 DirtyFirst;		/**< First transfer updated since the last
+				  *  start */
+	u32 DirtyLast;		/**< Transfer following the last one updated
+				  *  since the last start, 0 if none */
+	void *NextChain;	/**< Chain linked after this one, NULL if
+				  *  none */
+	u8 IsCacheCoherent;	/**< Descriptors need no cache maintenance */
+} XZDma_Chain;
+
 /***************** Macros (Inline Functions) Definitions *********************/
 
 /*****************************************************************************/
@@ -692,6 +717,16 @@ void XZDma_ScatterGather(XZDma *InstancePtr, XZDma_Transfer *Data,
 								u32 Num);
 void XZDma_Enable(XZDma *InstancePtr);
 
+s32 XZDma_ChainCreate(XZDma *InstancePtr, XZDma_Chain *ChainPtr,
+		XZDma_DscrType TypeOfDscr, UINTPTR Dscr_MemPtr, u32 NoOfBytes,
+		XZDma_Transfer *Data, u32 Num);
+s32 XZDma_ChainUpdate(XZDma_Chain *ChainPtr, u32 Index, UINTPTR SrcAddr,
+			UINTPTR DstAddr, u32 Size);
+s32 XZDma_ChainLink(XZDma_Chain *ChainPtr, XZDma_Chain *NextPtr);
+void XZDma_ChainSetDoneIntr(XZDma_Chain *ChainPtr, u8 Enable);
+s32 XZDma_ChainStart(XZDma *InstancePtr, XZDma_Chain *ChainPtr);
+s32 XZDma_ChainPollDone(XZDma *InstancePtr, u32 *DoneCnt);
+
 /*@}*/
 
 #ifdef __cplusplus
@@ -0,0 +1,548 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xzdma_chain.c
+* @addtogroup zdma_v1_16
+* @{
+*
+* This file contains the implementation of the persistent descriptor chain
+* functions of the ZDMA driver. A chain is built once in memory supplied by
+* the application and can then be started any number of times, with only the
+* addresses and sizes of individual transfers patched in between. Linked list
+* chains can also be linked one after the other so that the hardware runs
+* through several chains with a single start.
+* Refer to the header file xzdma.h for more detailed information.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- ------------------------------------------------------
+* 1.16  ant    10/18/26  First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xzdma.h"
+
+/************************** Function Prototypes ******************************/
+
+static u32 XZDma_ChainCtrl(const XZDma_Transfer *Data, u8 IsSrc, u8 IsLast);
+static void XZDma_ChainFlush(XZDma_Chain *ChainPtr, u32 First, u32 Last);
+
+/************************** Function Definitions *****************************/
+
+/*****************************************************************************/
+/**
+*
+* This function builds a descriptor chain for the given set of transfers in
+* the memory provided by the user. The chain is flushed to memory once and
+* can then be started repeatedly with XZDma_ChainStart().
+*
+* @param	InstancePtr is a pointer to the XZDma instance.
+* @param	ChainPtr is a pointer to the chain to be initialized.
+* @param	TypeOfDscr is a variable which specifies descriptor type
+*		whether Linear or linked list type of descriptor.
+*		- XZDMA_LINEAR - Linear type of descriptor.
+*		- XZDMA_LINKEDLIST- Linked list type of descriptor.
+* @param	Dscr_MemPtr is a pointer to the allocated memory for creating
+*		descriptors. It Should be aligned to 64 bytes.
+* @param	NoOfBytes specifies the number of memory bytes allocated for
+*		descriptors.
+* @param	Data is a pointer of array to the XZDma_Transfer structure
+*		which has the transfers of the chain.
+* @param	Num specifies number of array elements of Data pointer.
+*
+* @return
+*		- XST_SUCCESS if the chain was built.
+*		- XST_INVALID_PARAM if NoOfBytes is too small for Num
+*		  transfers.
+*
+* @note		Source descriptors are placed first in the memory followed by
+*		the destination descriptors, as done by XZDma_CreateBDList().
+*		The memory needed is 32 bytes per transfer for linear
+*		descriptors and 64 bytes per transfer for linked list
+*		descriptors.
+*
+******************************************************************************/
+s32 XZDma_ChainCreate(XZDma *InstancePtr, XZDma_Chain *ChainPtr,
+		XZDma_DscrType TypeOfDscr, UINTPTR Dscr_MemPtr, u32 NoOfBytes,
+		XZDma_Transfer *Data, u32 Num)
+{
+	UINTPTR Size;
+	u32 Index;
+	u8 IsLast;
+	XZDma_LiDscr *LiSrcDscr;
+	XZDma_LiDscr *LiDstDscr;
+	XZDma_LlDscr *LlSrcDscr;
+	XZDma_LlDscr *LlDstDscr;
+
+	/* Verify arguments */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(ChainPtr != NULL);
+	Xil_AssertNonvoid((TypeOfDscr == XZDMA_LINEAR) ||
+					(TypeOfDscr == XZDMA_LINKEDLIST));
+	Xil_AssertNonvoid(Dscr_MemPtr != 0x00);
+	Xil_AssertNonvoid(Data != NULL);
+	Xil_AssertNonvoid(Num != 0x00U);
+
+	if (TypeOfDscr == XZDMA_LINEAR) {
+		Size = sizeof(XZDma_LiDscr);
+	}
+	else {
+		Size = sizeof(XZDma_LlDscr);
+	}
+
+	if (((NoOfBytes >> 1) / Size) < Num) {
+		return XST_INVALID_PARAM;
+	}
+
+	ChainPtr->DscrType = TypeOfDscr;
+	ChainPtr->DscrCount = Num;
+	ChainPtr->DscrSize = (u32)Size;
+	ChainPtr->SrcDscrPtr = (void *)Dscr_MemPtr;
+	ChainPtr->DstDscrPtr = (void *)(Dscr_MemPtr + (Size * Num));
+	ChainPtr->NextChain = NULL;
+	ChainPtr->IsCacheCoherent = InstancePtr->Config.IsCacheCoherent;
+
+	LiSrcDscr = (XZDma_LiDscr *)ChainPtr->SrcDscrPtr;
+	LiDstDscr = (XZDma_LiDscr *)ChainPtr->DstDscrPtr;
+	LlSrcDscr = (XZDma_LlDscr *)ChainPtr->SrcDscrPtr;
+	LlDstDscr = (XZDma_LlDscr *)ChainPtr->DstDscrPtr;
+
+	for (Index = 0U; Index < Num; Index++) {
+		IsLast = (Index == (Num - 1U)) ? TRUE : FALSE;
+
+		if (TypeOfDscr == XZDMA_LINEAR) {
+			LiSrcDscr[Index].Address = (u64)Data[Index].SrcAddr;
+			LiSrcDscr[Index].Size = Data[Index].Size &
+						XZDMA_WORD2_SIZE_MASK;
+			LiSrcDscr[Index].Cntl = XZDma_ChainCtrl(&Data[Index],
+								TRUE, IsLast);
+			LiDstDscr[Index].Address = (u64)Data[Index].DstAddr;
+			LiDstDscr[Index].Size = Data[Index].Size &
+						XZDMA_WORD2_SIZE_MASK;
+			LiDstDscr[Index].Cntl = XZDma_ChainCtrl(&Data[Index],
+								FALSE, IsLast);
+		}
+		else {
+			LlSrcDscr[Index].Address = (u64)Data[Index].SrcAddr;
+			LlSrcDscr[Index].Size = Data[Index].Size &
+						XZDMA_WORD2_SIZE_MASK;
+			LlSrcDscr[Index].Cntl = XZDma_ChainCtrl(&Data[Index],
+								TRUE, IsLast);
+			LlSrcDscr[Index].Reserved = 0U;
+			LlDstDscr[Index].Address = (u64)Data[Index].DstAddr;
+			LlDstDscr[Index].Size = Data[Index].Size &
+						XZDMA_WORD2_SIZE_MASK;
+			LlDstDscr[Index].Cntl = XZDma_ChainCtrl(&Data[Index],
+								FALSE, IsLast);
+			LlDstDscr[Index].Reserved = 0U;
+
+			if (IsLast == TRUE) {
+				LlSrcDscr[Index].NextDscr = 0U;
+				LlDstDscr[Index].NextDscr = 0U;
+			}
+			else {
+				LlSrcDscr[Index].NextDscr =
+					(u64)(UINTPTR)&LlSrcDscr[Index + 1U];
+				LlDstDscr[Index].NextDscr =
+					(u64)(UINTPTR)&LlDstDscr[Index + 1U];
+			}
+		}
+	}
+
+	/* One flush for the whole chain */
+	XZDma_ChainFlush(ChainPtr, 0U, Num);
+	ChainPtr->DirtyFirst = 0U;
+	ChainPtr->DirtyLast = 0U;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function patches the addresses and size of one transfer of a chain.
+* The descriptors are only updated in the cache, they are written back to
+* memory together with all other patched transfers of the chain by the next
+* XZDma_ChainStart().
+*
+* @param	ChainPtr is a pointer to the chain built by XZDma_ChainCreate().
+* @param	Index is the index of the transfer in the chain.
+* @param	SrcAddr is the new source address.
+* @param	DstAddr is the new destination address.
+* @param	Size is the new size of the transfer in bytes.
+*
+* @return
+*		- XST_SUCCESS if the transfer was updated.
+*		- XST_INVALID_PARAM if Index is out of the chain.
+*
+* @note		The chain must not be updated while the ZDMA is processing it.
+*
+******************************************************************************/
+s32 XZDma_ChainUpdate(XZDma_Chain *ChainPtr, u32 Index, UINTPTR SrcAddr,
+			UINTPTR DstAddr, u32 Size)
+{
+	XZDma_LiDscr *LiDscr;
+	XZDma_LlDscr *LlDscr;
+
+	/* Verify arguments */
+	Xil_AssertNonvoid(ChainPtr != NULL);
+	Xil_AssertNonvoid(SrcAddr != 0x00U);
+	Xil_AssertNonvoid(DstAddr != 0x00U);
+
+	if (Index >= ChainPtr->DscrCount) {
+		return XST_INVALID_PARAM;
+	}
+
+	if (ChainPtr->DscrType == XZDMA_LINEAR) {
+		LiDscr = (XZDma_LiDscr *)ChainPtr->SrcDscrPtr;
+		LiDscr[Index].Address = (u64)SrcAddr;
+		LiDscr[Index].Size = Size & XZDMA_WORD2_SIZE_MASK;
+		LiDscr = (XZDma_LiDscr *)ChainPtr->DstDscrPtr;
+		LiDscr[Index].Address = (u64)DstAddr;
+		LiDscr[Index].Size = Size & XZDMA_WORD2_SIZE_MASK;
+	}
+	else {
+		LlDscr = (XZDma_LlDscr *)ChainPtr->SrcDscrPtr;
+		LlDscr[Index].Address = (u64)SrcAddr;
+		LlDscr[Index].Size = Size & XZDMA_WORD2_SIZE_MASK;
+		LlDscr = (XZDma_LlDscr *)ChainPtr->DstDscrPtr;
+		LlDscr[Index].Address = (u64)DstAddr;
+		LlDscr[Index].Size = Size & XZDMA_WORD2_SIZE_MASK;
+	}
+
+	/* Grow the range to be flushed by the next start */
+	if (ChainPtr->DirtyLast == 0U) {
+		ChainPtr->DirtyFirst = Index;
+		ChainPtr->DirtyLast = Index + 1U;
+	}
+	else {
+		if (Index < ChainPtr->DirtyFirst) {
+			ChainPtr->DirtyFirst = Index;
+		}
+		if (Index >= ChainPtr->DirtyLast) {
+			ChainPtr->DirtyLast = Index + 1U;
+		}
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function links the end of a linked list chain to the start of another
+* one, so that the ZDMA continues with NextPtr after the last transfer of
+* ChainPtr without CPU intervention. Passing NULL as NextPtr makes ChainPtr
+* stop after its last transfer again.
+*
+* @param	ChainPtr is a pointer to the chain to be linked.
+* @param	NextPtr is a pointer to the chain to be run after ChainPtr,
+*		or NULL.
+*
+* @return
+*		- XST_SUCCESS if the chains were linked.
+*		- XST_FAILURE if any of the chains is not of linked list type
+*		  or the link would make the chains loop.
+*
+* @note		The descriptor change is written back by the next
+*		XZDma_ChainStart() of a chain leading to ChainPtr.
+*
+******************************************************************************/
+s32 XZDma_ChainLink(XZDma_Chain *ChainPtr, XZDma_Chain *NextPtr)
+{
+	XZDma_Chain *CurPtr;
+	XZDma_LlDscr *LastSrc;
+	XZDma_LlDscr *LastDst;
+	u32 Last;
+	u32 Cmd;
+
+	/* Verify arguments */
+	Xil_AssertNonvoid(ChainPtr != NULL);
+
+	if (ChainPtr->DscrType != XZDMA_LINKEDLIST) {
+		return XST_FAILURE;
+	}
+
+	if (NextPtr != NULL) {
+		if (NextPtr->DscrType != XZDMA_LINKEDLIST) {
+			return XST_FAILURE;
+		}
+		/* XZDma_ChainStart() walks the links, they must end */
+		for (CurPtr = NextPtr; CurPtr != NULL;
+				CurPtr = (XZDma_Chain *)CurPtr->NextChain) {
+			if (CurPtr == ChainPtr) {
+				return XST_FAILURE;
+			}
+		}
+	}
+
+	Last = ChainPtr->DscrCount - 1U;
+	LastSrc = &((XZDma_LlDscr *)ChainPtr->SrcDscrPtr)[Last];
+	LastDst = &((XZDma_LlDscr *)ChainPtr->DstDscrPtr)[Last];
+
+	/* A pause request on the last transfer is kept as is */
+	Cmd = LastSrc->Cntl & XZDMA_WORD3_CMD_MASK;
+	if (Cmd != XZDMA_WORD3_CMD_PAUSE_MASK) {
+		Cmd = (NextPtr != NULL) ? XZDMA_WORD3_CMD_NXTVALID_MASK :
+					XZDMA_WORD3_CMD_STOP_MASK;
+		LastSrc->Cntl = (LastSrc->Cntl & ~XZDMA_WORD3_CMD_MASK) | Cmd;
+	}
+
+	if (NextPtr != NULL) {
+		LastSrc->NextDscr = (u64)(UINTPTR)NextPtr->SrcDscrPtr;
+		LastDst->NextDscr = (u64)(UINTPTR)NextPtr->DstDscrPtr;
+	}
+	else {
+		LastSrc->NextDscr = 0U;
+		LastDst->NextDscr = 0U;
+	}
+	ChainPtr->NextChain = NextPtr;
+
+	if (ChainPtr->DirtyLast == 0U) {
+		ChainPtr->DirtyFirst = Last;
+	}
+	ChainPtr->DirtyLast = Last + 1U;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function selects whether the last transfer of a chain raises the
+* destination descriptor done event. Each such event increments the
+* destination interrupt account counter of the channel, so the number of
+* chains completed out of a set of linked chains can be collected at once
+* with XZDma_ChainPollDone() or XZDma_GetDstIntrCnt().
+*
+* @param	ChainPtr is a pointer to the chain built by XZDma_ChainCreate().
+* @param	Enable is TRUE to raise the event, FALSE otherwise.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+void XZDma_ChainSetDoneIntr(XZDma_Chain *ChainPtr, u8 Enable)
+{
+	u32 Last;
+	u32 Intr;
+	XZDma_LiDscr *LiDscr;
+	XZDma_LlDscr *LlDscr;
+
+	/* Verify arguments */
+	Xil_AssertVoid(ChainPtr != NULL);
+	Xil_AssertVoid((Enable == TRUE) || (Enable == FALSE));
+
+	Last = ChainPtr->DscrCount - 1U;
+	Intr = (Enable == TRUE) ? XZDMA_WORD3_INTR_MASK : 0U;
+
+	if (ChainPtr->DscrType == XZDMA_LINEAR) {
+		LiDscr = &((XZDma_LiDscr *)ChainPtr->DstDscrPtr)[Last];
+		LiDscr->Cntl = (LiDscr->Cntl & ~XZDMA_WORD3_INTR_MASK) | Intr;
+	}
+	else {
+		LlDscr = &((XZDma_LlDscr *)ChainPtr->DstDscrPtr)[Last];
+		LlDscr->Cntl = (LlDscr->Cntl & ~XZDMA_WORD3_INTR_MASK) | Intr;
+	}
+
+	if (ChainPtr->DirtyLast == 0U) {
+		ChainPtr->DirtyFirst = Last;
+	}
+	ChainPtr->DirtyLast = Last + 1U;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function starts the ZDMA on a chain built by XZDma_ChainCreate(). The
+* transfers patched since the previous start, in this chain and in all the
+* chains linked after it, are written back to memory with one flush per
+* chain before the channel is enabled.
+*
+* @param	InstancePtr is a pointer to the XZDma instance.
+* @param	ChainPtr is a pointer to the first chain to be run.
+*
+* @return
+*		- XST_SUCCESS if ZDMA initiated the transfer.
+*		- XST_FAILURE if ZDMA is not in scatter gather mode, or is
+*		busy or paused.
+*
+* @note		The ZDMA should be set in scatter gather mode through
+*		XZDma_SetMode() before calling this function. A paused
+*		channel has to be resumed through XZDma_Resume() and run to
+*		completion before a chain can be started on it.
+*
+******************************************************************************/
+s32 XZDma_ChainStart(XZDma *InstancePtr, XZDma_Chain *ChainPtr)
+{
+	XZDma_Chain *CurPtr;
+	u64 LocalAddr;
+
+	/* Verify arguments */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(ChainPtr != NULL);
+
+	if ((InstancePtr->IsSgDma != TRUE) ||
+		(XZDma_ChannelState(InstancePtr) != XZDMA_IDLE)) {
+		return XST_FAILURE;
+	}
+
+	for (CurPtr = ChainPtr; CurPtr != NULL;
+			CurPtr = (XZDma_Chain *)CurPtr->NextChain) {
+		if (CurPtr->DirtyLast != 0U) {
+			XZDma_ChainFlush(CurPtr, CurPtr->DirtyFirst,
+						CurPtr->DirtyLast);
+			CurPtr->DirtyFirst = 0U;
+			CurPtr->DirtyLast = 0U;
+		}
+	}
+
+	XZDma_WriteReg(InstancePtr->Config.BaseAddress,
+		XZDMA_CH_SRC_START_LSB_OFFSET,
+		((UINTPTR)(ChainPtr->SrcDscrPtr) & XZDMA_WORD0_LSB_MASK));
+	LocalAddr = (u64)(UINTPTR)(ChainPtr->SrcDscrPtr);
+	XZDma_WriteReg(InstancePtr->Config.BaseAddress,
+		XZDMA_CH_SRC_START_MSB_OFFSET,
+		((LocalAddr >> XZDMA_WORD1_MSB_SHIFT) & XZDMA_WORD1_MSB_MASK));
+	XZDma_WriteReg(InstancePtr->Config.BaseAddress,
+		XZDMA_CH_DST_START_LSB_OFFSET,
+		((UINTPTR)(ChainPtr->DstDscrPtr) & XZDMA_WORD0_LSB_MASK));
+	LocalAddr = (u64)(UINTPTR)(ChainPtr->DstDscrPtr);
+	XZDma_WriteReg(InstancePtr->Config.BaseAddress,
+		XZDMA_CH_DST_START_MSB_OFFSET,
+		((LocalAddr >> XZDMA_WORD1_MSB_SHIFT) & XZDMA_WORD1_MSB_MASK));
+
+	XZDma_Enable(InstancePtr);
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function checks in polled mode whether the ZDMA has finished the
+* chains started by XZDma_ChainStart(). The number of chains that raised
+* their done event since the previous call is returned through DoneCnt, so
+* many chains can be retired with a single call.
+*
+* @param	InstancePtr is a pointer to the XZDma instance.
+* @param	DoneCnt is a pointer to the returned number of completed chains
+*		which have the done event enabled through
+*		XZDma_ChainSetDoneIntr(). It can be NULL.
+*
+* @return
+*		- XST_SUCCESS if the ZDMA has completed all the transfers.
+*		- XST_DEVICE_BUSY if the ZDMA is still processing.
+*
+* @note		Not to be used when the DMA done interrupt is handled by
+*		XZDma_IntrHandler(), which clears the status this function
+*		looks for.
+*
+******************************************************************************/
+s32 XZDma_ChainPollDone(XZDma *InstancePtr, u32 *DoneCnt)
+{
+	u32 Status;
+
+	/* Verify arguments */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+
+	/* Read the status first so that no event before done is missed */
+	Status = XZDma_IntrGetStatus(InstancePtr);
+
+	if (DoneCnt != NULL) {
+		*DoneCnt = XZDma_GetDstIntrCnt(InstancePtr) &
+				XZDMA_CH_IRQ_ACCT_MASK;
+	}
+
+	if ((Status & XZDMA_IXR_DMA_DONE_MASK) == 0U) {
+		return XST_DEVICE_BUSY;
+	}
+
+	XZDma_IntrClear(InstancePtr, XZDMA_IXR_DMA_DONE_MASK |
+			XZDMA_IXR_DST_DSCR_DONE_MASK |
+			XZDMA_IXR_SRC_DSCR_DONE_MASK);
+	InstancePtr->ChannelState = XZDMA_IDLE;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This static function returns the control word of a chain descriptor.
+*
+* @param	Data is a pointer to the transfer of the descriptor.
+* @param	IsSrc specifies whether the descriptor is a source one.
+* @param	IsLast specifies whether the descriptor is the last one of
+*		the chain.
+*
+* @return	Control word of the descriptor.
+*
+* @note		As done by XZDma_Start(), the command is only set in the
+*		source descriptors.
+*
+******************************************************************************/
+static u32 XZDma_ChainCtrl(const XZDma_Transfer *Data, u8 IsSrc, u8 IsLast)
+{
+	u32 Value = 0U;
+
+	if (IsSrc == TRUE) {
+		if (Data->Pause == TRUE) {
+			Value = XZDMA_WORD3_CMD_PAUSE_MASK;
+		}
+		else if (IsLast == TRUE) {
+			Value = XZDMA_WORD3_CMD_STOP_MASK;
+		}
+		else {
+			Value = XZDMA_WORD3_CMD_NXTVALID_MASK;
+		}
+		if (Data->SrcCoherent == TRUE) {
+			Value |= XZDMA_WORD3_COHRNT_MASK;
+		}
+	}
+	else {
+		if (Data->DstCoherent == TRUE) {
+			Value |= XZDMA_WORD3_COHRNT_MASK;
+		}
+	}
+
+	return Value;
+}
+
+/*****************************************************************************/
+/**
+*
+* This static function writes back the source and destination descriptors of
+* a range of transfers of a chain, with one flush for each side.
+*
+* @param	ChainPtr is a pointer to the chain.
+* @param	First is the index of the first transfer to flush.
+* @param	Last is the index following the last transfer to flush.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void XZDma_ChainFlush(XZDma_Chain *ChainPtr, u32 First, u32 Last)
+{
+	UINTPTR Offset = (UINTPTR)First * ChainPtr->DscrSize;
+	u32 Len = (Last - First) * ChainPtr->DscrSize;
+
+	if (!ChainPtr->IsCacheCoherent) {
+		Xil_DCacheFlushRange((UINTPTR)ChainPtr->SrcDscrPtr + Offset, Len);
+		Xil_DCacheFlushRange((UINTPTR)ChainPtr->DstDscrPtr + Offset, Len);
+	}
+}
+/** @} */
@@ -7,7 +7,7 @@
 /**
 *
 * @file xzdma_intr.c
-* @addtogroup zdma_v1_14
+* @addtogroup zdma_v1_16
 * @{
 *
 * This file contains interrupt related functions of Xilinx ZDMA core.
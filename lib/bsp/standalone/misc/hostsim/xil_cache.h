@@ -0,0 +1,71 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xil_cache.h
+*
+* Host stand in for the BSP cache APIs in XIL_HOSTSIM builds. Host caches
+* are coherent with the simulated devices, so every call is a no-op which is
+* only counted in XHostSim_Cache.
+*
+******************************************************************************/
+
+#ifndef XIL_CACHE_H
+#define XIL_CACHE_H
+
+#include "xil_types.h"
+#include "xil_hostsim.h"
+
+static inline void Xil_DCacheFlushRange(INTPTR Adr, INTPTR Len)
+{
+	(void)Adr;
+	XHostSim_Cache.FlushRange++;
+	XHostSim_Cache.RangeBytes += (u64)Len;
+	__asm__ __volatile__("" ::: "memory");
+}
+
+static inline void Xil_DCacheInvalidateRange(INTPTR Adr, INTPTR Len)
+{
+	(void)Adr;
+	XHostSim_Cache.InvalidateRange++;
+	XHostSim_Cache.RangeBytes += (u64)Len;
+	__asm__ __volatile__("" ::: "memory");
+}
+
+static inline void Xil_DCacheFlushLine(INTPTR Adr)
+{
+	Xil_DCacheFlushRange(Adr, 64);
+}
+
+static inline void Xil_DCacheInvalidateLine(INTPTR Adr)
+{
+	Xil_DCacheInvalidateRange(Adr, 64);
+}
+
+static inline void Xil_ICacheInvalidateRange(INTPTR Adr, INTPTR Len)
+{
+	(void)Adr;
+	(void)Len;
+	XHostSim_Cache.Other++;
+}
+
+static inline void Xil_HostSimCacheOp(void)
+{
+	XHostSim_Cache.Other++;
+	__asm__ __volatile__("" ::: "memory");
+}
+
+#define Xil_DCacheEnable()	Xil_HostSimCacheOp()
+#define Xil_DCacheDisable()	Xil_HostSimCacheOp()
+#define Xil_DCacheFlush()	Xil_HostSimCacheOp()
+#define Xil_DCacheInvalidate()	Xil_HostSimCacheOp()
+#define Xil_ICacheEnable()	Xil_HostSimCacheOp()
+#define Xil_ICacheDisable()	Xil_HostSimCacheOp()
+#define Xil_ICacheInvalidate()	Xil_HostSimCacheOp()
+#define Xil_ICacheInvalidateLine(Adr)	Xil_ICacheInvalidateRange((Adr), 64)
+
+#endif /* XIL_CACHE_H */
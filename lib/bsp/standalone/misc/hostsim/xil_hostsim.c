@@ -0,0 +1,265 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xil_hostsim.c
+*
+* Register region table, Xil_In/Xil_Out accessors, cache counters and the
+* outbyte used by xil_printf in XIL_HOSTSIM builds. For more information,
+* see xil_hostsim.h.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -----------------------------------------------
+* 1.00  ant  10/18/26 Initial release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include "xil_hostsim.h"
+#include "xil_printf.h"
+
+/************************** Constant Definitions *****************************/
+
+/************************** Function Prototypes ******************************/
+static XHostSim_Region *XHostSim_Find(UINTPTR Addr);
+
+/************************** Variable Definitions *****************************/
+XHostSim_CacheStats XHostSim_Cache;
+
+static XHostSim_Region *RegionList;
+static XHostSim_Region *LastRegion;	/* Last region hit, checked first */
+
+/*****************************************************************************/
+/**
+*
+* Registers a simulated register block backed by zeroed host memory.
+*
+* @param	Region is the region to register, owned by the caller.
+* @param	Size is the size of the block in bytes, a multiple of 4.
+* @param	Read is called for 32 bit reads, NULL to read the memory.
+* @param	Write is called for 32 bit writes, NULL to write the memory.
+* @param	Priv is stored in Region->Priv for the model.
+*
+* @return	Base address of the block, 0 if out of memory.
+*
+******************************************************************************/
+UINTPTR XHostSim_Map(XHostSim_Region *Region, u32 Size,
+	XHostSim_ReadFn Read, XHostSim_WriteFn Write, void *Priv)
+{
+	memset(Region, 0, sizeof(*Region));
+	Region->Regs = XHostSim_Alloc(Size);
+	if (Region->Regs == NULL) {
+		return 0U;
+	}
+	Region->Base = (UINTPTR)Region->Regs;
+	Region->Size = Size;
+	Region->Read = Read;
+	Region->Write = Write;
+	Region->Priv = Priv;
+	Region->Next = RegionList;
+	RegionList = Region;
+
+	return Region->Base;
+}
+
+/*****************************************************************************/
+/**
+*
+* Removes a region registered by XHostSim_Map() and frees its memory.
+*
+* @param	Region is the region to remove.
+*
+* @return	None.
+*
+******************************************************************************/
+void XHostSim_Unmap(XHostSim_Region *Region)
+{
+	XHostSim_Region **Link = &RegionList;
+
+	while (*Link != NULL) {
+		if (*Link == Region) {
+			*Link = Region->Next;
+			break;
+		}
+		Link = &(*Link)->Next;
+	}
+	if (LastRegion == Region) {
+		LastRegion = NULL;
+	}
+	XHostSim_Free(Region->Regs, Region->Size);
+	Region->Regs = NULL;
+	Region->Base = 0U;
+}
+
+/*****************************************************************************/
+/**
+*
+* Clears the access counters of all regions and the cache counters.
+*
+* @return	None.
+*
+******************************************************************************/
+void XHostSim_ResetStats(void)
+{
+	XHostSim_Region *Region;
+
+	for (Region = RegionList; Region != NULL; Region = Region->Next) {
+		Region->Reads = 0U;
+		Region->Writes = 0U;
+	}
+	memset(&XHostSim_Cache, 0, sizeof(XHostSim_Cache));
+}
+
+/*****************************************************************************/
+/**
+*
+* Allocates zeroed, page aligned memory that drivers can address: below 4 GB
+* on 64 bit hosts other than aarch64.
+*
+* @param	Size is the size in bytes.
+*
+* @return	Pointer to the memory, NULL if out of memory.
+*
+******************************************************************************/
+void *XHostSim_Alloc(u32 Size)
+{
+	int Flags = MAP_PRIVATE | MAP_ANONYMOUS;
+	void *Ptr;
+
+#if defined (__x86_64__)
+	Flags |= MAP_32BIT;
+#endif
+	Ptr = mmap(NULL, (size_t)Size, PROT_READ | PROT_WRITE, Flags, -1, 0);
+
+	return (Ptr == MAP_FAILED) ? NULL : Ptr;
+}
+
+/*****************************************************************************/
+/**
+*
+* Frees memory returned by XHostSim_Alloc().
+*
+* @param	Ptr is the memory.
+* @param	Size is the size passed to XHostSim_Alloc().
+*
+* @return	None.
+*
+******************************************************************************/
+void XHostSim_Free(void *Ptr, u32 Size)
+{
+	if (Ptr != NULL) {
+		(void)munmap(Ptr, (size_t)Size);
+	}
+}
+
+static XHostSim_Region *XHostSim_Find(UINTPTR Addr)
+{
+	XHostSim_Region *Region = LastRegion;
+
+	if ((Region != NULL) && ((Addr - Region->Base) < Region->Size)) {
+		return Region;
+	}
+	for (Region = RegionList; Region != NULL; Region = Region->Next) {
+		if ((Addr - Region->Base) < Region->Size) {
+			LastRegion = Region;
+			break;
+		}
+	}
+
+	return Region;
+}
+
+u32 Xil_In32(UINTPTR Addr)
+{
+	XHostSim_Region *Region = XHostSim_Find(Addr);
+	u32 Offset;
+
+	if (Region == NULL) {
+		return *(volatile u32 *)Addr;
+	}
+	Offset = (u32)(Addr - Region->Base);
+	Region->Reads++;
+	if (Region->Read != NULL) {
+		return Region->Read(Region, Offset);
+	}
+
+	return XHostSim_RegGet(Region, Offset);
+}
+
+void Xil_Out32(UINTPTR Addr, u32 Value)
+{
+	XHostSim_Region *Region = XHostSim_Find(Addr);
+	u32 Offset;
+
+	if (Region == NULL) {
+		*(volatile u32 *)Addr = Value;
+		return;
+	}
+	Offset = (u32)(Addr - Region->Base);
+	Region->Writes++;
+	if (Region->Write != NULL) {
+		Region->Write(Region, Offset, Value);
+	} else {
+		XHostSim_RegSet(Region, Offset, Value);
+	}
+}
+
+/*
+ * 8, 16 and 64 bit accesses are rare on registers. They access the backing
+ * memory directly, 64 bit ones as two 32 bit accesses so that models see
+ * them.
+ */
+u8 Xil_In8(UINTPTR Addr)
+{
+	return *(volatile u8 *)Addr;
+}
+
+u16 Xil_In16(UINTPTR Addr)
+{
+	return *(volatile u16 *)Addr;
+}
+
+u64 Xil_In64(UINTPTR Addr)
+{
+	if (XHostSim_Find(Addr) == NULL) {
+		return *(volatile u64 *)Addr;
+	}
+
+	return (u64)Xil_In32(Addr) | ((u64)Xil_In32(Addr + 4U) << 32U);
+}
+
+void Xil_Out8(UINTPTR Addr, u8 Value)
+{
+	*(volatile u8 *)Addr = Value;
+}
+
+void Xil_Out16(UINTPTR Addr, u16 Value)
+{
+	*(volatile u16 *)Addr = Value;
+}
+
+void Xil_Out64(UINTPTR Addr, u64 Value)
+{
+	if (XHostSim_Find(Addr) == NULL) {
+		*(volatile u64 *)Addr = Value;
+		return;
+	}
+	Xil_Out32(Addr, (u32)Value);
+	Xil_Out32(Addr + 4U, (u32)(Value >> 32U));
+}
+
+void outbyte(char c)
+{
+	(void)putchar(c);
+}
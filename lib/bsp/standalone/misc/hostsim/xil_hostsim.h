@@ -0,0 +1,140 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xil_hostsim.h
+*
+* Host (Linux) build mode of the standalone BSP, used to run and time driver
+* code without a board. Build with -DXIL_HOSTSIM and this directory first in
+* the include path: xil_io.h then takes its Xil_In and Xil_Out functions from
+* here, and xil_cache.h, xparameters.h and bspconfig.h of this directory
+* replace the processor specific ones.
+*
+* Register blocks are simulated by regions registered with XHostSim_Map().
+* A region is backed by host memory, and its base address is what the driver
+* configuration uses as the device base address. 32 bit accesses to a region
+* call its Read and Write functions, so that a model can implement side
+* effects such as self clearing bits, FIFO pops or DMA descriptor completion.
+* With NULL functions the region behaves as plain memory.
+*
+* Accesses outside all regions go straight to host memory, which is what DMA
+* descriptors and buffers allocated by the application need. Drivers select
+* their 64 bit descriptor layouts with __aarch64__ and otherwise keep
+* addresses in u32, so on other 64 bit hosts all memory seen by a driver must
+* come from XHostSim_Alloc(), which returns memory below 4 GB.
+*
+* Cache maintenance calls are no-ops which are only counted.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -----------------------------------------------
+* 1.00  ant  10/18/26 Initial release
+* </pre>
+*
+******************************************************************************/
+
+#ifndef XIL_HOSTSIM_H	/* prevent circular inclusions */
+#define XIL_HOSTSIM_H	/* by using protection macros */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files ********************************/
+#include "xil_types.h"
+
+/************************** Constant Definitions ****************************/
+
+/**************************** Type Definitions ******************************/
+
+typedef struct XHostSim_Region XHostSim_Region;
+
+/**
+ * Called for a 32 bit read of the region. Returns the value read, usually
+ * after updating the backing memory with XHostSim_RegSet().
+ */
+typedef u32 (*XHostSim_ReadFn)(XHostSim_Region *Region, u32 Offset);
+
+/**
+ * Called for a 32 bit write of the region, instead of storing the value.
+ */
+typedef void (*XHostSim_WriteFn)(XHostSim_Region *Region, u32 Offset,
+	u32 Value);
+
+/**
+ * Simulated register block.
+ */
+struct XHostSim_Region {
+	UINTPTR Base;		/**< Base address, set by XHostSim_Map() */
+	u32 Size;		/**< Size in bytes */
+	u32 *Regs;		/**< Backing memory */
+	XHostSim_ReadFn Read;	/**< Read side effects, or NULL */
+	XHostSim_WriteFn Write;	/**< Write side effects, or NULL */
+	void *Priv;		/**< Model data */
+	u64 Reads;		/**< Number of reads */
+	u64 Writes;		/**< Number of writes */
+	XHostSim_Region *Next;
+};
+
+/**
+ * Counters of the no-op cache layer.
+ */
+typedef struct {
+	u64 FlushRange;		/**< Xil_DCacheFlushRange calls */
+	u64 InvalidateRange;	/**< Xil_DCacheInvalidateRange calls */
+	u64 RangeBytes;		/**< Bytes passed to both */
+	u64 Other;		/**< Whole cache and enable/disable calls */
+} XHostSim_CacheStats;
+
+/***************** Macros (Inline Functions) Definitions ********************/
+
+/* Barriers only need to order the compiler on the host */
+#define dmb()	__asm__ __volatile__("" ::: "memory")
+#define dsb()	__asm__ __volatile__("" ::: "memory")
+#define isb()	__asm__ __volatile__("" ::: "memory")
+
+/************************** Variable Definitions ****************************/
+
+extern XHostSim_CacheStats XHostSim_Cache;
+
+/************************** Function Prototypes *****************************/
+
+UINTPTR XHostSim_Map(XHostSim_Region *Region, u32 Size,
+	XHostSim_ReadFn Read, XHostSim_WriteFn Write, void *Priv);
+void XHostSim_Unmap(XHostSim_Region *Region);
+void XHostSim_ResetStats(void);
+void *XHostSim_Alloc(u32 Size);
+void XHostSim_Free(void *Ptr, u32 Size);
+
+static inline u32 XHostSim_RegGet(const XHostSim_Region *Region, u32 Offset)
+{
+	return Region->Regs[Offset >> 2U];
+}
+
+static inline void XHostSim_RegSet(XHostSim_Region *Region, u32 Offset,
+	u32 Value)
+{
+	Region->Regs[Offset >> 2U] = Value;
+}
+
+/* Accessors used by xil_io.h in XIL_HOSTSIM builds */
+u8 Xil_In8(UINTPTR Addr);
+u16 Xil_In16(UINTPTR Addr);
+u32 Xil_In32(UINTPTR Addr);
+u64 Xil_In64(UINTPTR Addr);
+void Xil_Out8(UINTPTR Addr, u8 Value);
+void Xil_Out16(UINTPTR Addr, u16 Value);
+void Xil_Out32(UINTPTR Addr, u32 Value);
+void Xil_Out64(UINTPTR Addr, u64 Value);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XIL_HOSTSIM_H */
@@ -0,0 +1,677 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xil_hostsim_bench.c
+*
+* Host micro-benchmark of driver hot paths, built from the unmodified driver
+* sources in XIL_HOSTSIM mode against simple register models:
+*
+* - axidma_tx: XAxiDma_BdRingAlloc, buffer setup, XAxiDma_BdRingToHw,
+*   XAxiDma_BdRingFromHw and XAxiDma_BdRingFree on the MM2S ring. The model
+*   completes every BD up to the tail as soon as TDESC is written.
+* - emacps_rx: XEmacPs_BdRingFromHwRx, XEmacPs_BdRingFree, re-arm with
+*   XEmacPs_BdRingAlloc and XEmacPs_BdRingToHw. The model receives a batch
+*   of frames into the ring starting at RXQBASE before each iteration.
+*
+* Each phase is timed separately and reported in ns per BD, together with
+* the register accesses and cache maintenance calls per BD, as lines of
+*
+*	hostsim,<test>,<batch>,<metric>,<value>
+*
+* The completed BD count and status of every iteration is checked, so the
+* exit status also tells whether the drivers still work against the models.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -----------------------------------------------
+* 1.00  ant  10/18/26 Initial release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+#include "xil_hostsim.h"
+#include "xaxidma.h"
+#include "xemacps_hw.h"
+#include "xemacps_bd.h"
+#include "xemacps_bdring.h"
+
+/************************** Constant Definitions *****************************/
+#define DEFAULT_RING_BDS	(256U)
+#define DEFAULT_BATCH		(32U)
+#define DEFAULT_DURATION_MS	(500U)
+#define FRAME_LEN		(1514U)
+#define BUF_SIZE		(2048U)
+#define AXIDMA_REG_SIZE		(0x1000U)
+#define EMACPS_REG_SIZE		(0x1000U)
+#define AXIDMA_LEN_MASK		(0x03FFFFFFU)
+
+/**************************** Type Definitions *******************************/
+
+/* Phase of a benchmark loop */
+typedef struct {
+	const char *Name;
+	u64 Ns;
+} Phase;
+
+/* AXI DMA channel as seen by the model */
+typedef struct {
+	UINTPTR NextBd;		/* First BD not processed yet, 0 after CDESC */
+	u32 IsRx;
+} AxiDmaChan;
+
+typedef struct {
+	AxiDmaChan Chan[2];
+} AxiDmaModel;
+
+typedef struct {
+	XHostSim_Region *Region;
+	UINTPTR NextBd;		/* Next BD to receive into, 0 to use RXQBASE */
+} EmacPsModel;
+
+/************************** Function Prototypes ******************************/
+static u64 NowNs(void);
+static UINTPTR BdAddr(UINTPTR Bd, u32 LoOffset, u32 HiOffset);
+static void AxiDmaModel_Complete(XHostSim_Region *Region, u32 ChanOff);
+static void AxiDmaModel_Write(XHostSim_Region *Region, u32 Offset,
+	u32 Value);
+static u32 EmacPsModel_Receive(EmacPsModel *Model, u32 NumFrames);
+static void Report(const char *Test, u32 Batch, Phase *Phases, u32 NumPhases,
+	u64 Bds, const XHostSim_Region *Region);
+static int BenchAxiDmaTx(void);
+static int BenchEmacPsRx(void);
+static void Usage(const char *Prog);
+
+/************************** Variable Definitions *****************************/
+static u32 RingBds = DEFAULT_RING_BDS;
+static u32 Batch = DEFAULT_BATCH;
+static u32 DurationMs = DEFAULT_DURATION_MS;
+
+/*****************************************************************************/
+/**
+*
+* Returns a monotonic time stamp in nanoseconds.
+*
+******************************************************************************/
+static u64 NowNs(void)
+{
+	struct timespec Ts;
+
+	(void)clock_gettime(CLOCK_MONOTONIC, &Ts);
+
+	return ((u64)Ts.tv_sec * 1000000000ULL) + (u64)Ts.tv_nsec;
+}
+
+/*****************************************************************************/
+/**
+*
+* Reads a descriptor address split in a low and a high word. The high word is
+* only used by drivers built for aarch64.
+*
+******************************************************************************/
+static UINTPTR BdAddr(UINTPTR Bd, u32 LoOffset, u32 HiOffset)
+{
+	UINTPTR Addr = *(volatile u32 *)(Bd + LoOffset);
+
+#if defined (__aarch64__)
+	Addr |= (UINTPTR)(*(volatile u32 *)(Bd + HiOffset)) << 32U;
+#else
+	(void)HiOffset;
+#endif
+
+	return Addr;
+}
+
+/*****************************************************************************/
+/**
+*
+* AXI DMA model: processes the BDs of a running channel up to the tail
+* descriptor, as the engine would once the data has moved.
+*
+******************************************************************************/
+static void AxiDmaModel_Complete(XHostSim_Region *Region, u32 ChanOff)
+{
+	AxiDmaModel *Model = (AxiDmaModel *)Region->Priv;
+	AxiDmaChan *Chan = &Model->Chan[(ChanOff != 0U) ? 1U : 0U];
+	UINTPTR Tail;
+	UINTPTR Bd;
+	u32 Ctrl;
+	u32 Sts;
+
+	if ((XHostSim_RegGet(Region, ChanOff + XAXIDMA_SR_OFFSET) &
+		XAXIDMA_HALTED_MASK) != 0U) {
+		return;
+	}
+
+	Tail = XHostSim_RegGet(Region, ChanOff + XAXIDMA_TDESC_OFFSET);
+#if defined (__aarch64__)
+	Tail |= (UINTPTR)XHostSim_RegGet(Region,
+		ChanOff + XAXIDMA_TDESC_MSB_OFFSET) << 32U;
+#endif
+	if (Chan->NextBd == 0U) {
+		Chan->NextBd = XHostSim_RegGet(Region,
+			ChanOff + XAXIDMA_CDESC_OFFSET);
+#if defined (__aarch64__)
+		Chan->NextBd |= (UINTPTR)XHostSim_RegGet(Region,
+			ChanOff + XAXIDMA_CDESC_MSB_OFFSET) << 32U;
+#endif
+	}
+
+	Bd = Chan->NextBd;
+	for (;;) {
+		Ctrl = *(volatile u32 *)(Bd + XAXIDMA_BD_CTRL_LEN_OFFSET);
+		Sts = XAXIDMA_BD_STS_COMPLETE_MASK | (Ctrl & AXIDMA_LEN_MASK);
+		if (Chan->IsRx != 0U) {
+			Sts |= XAXIDMA_BD_STS_RXSOF_MASK |
+				XAXIDMA_BD_STS_RXEOF_MASK;
+		}
+		*(volatile u32 *)(Bd + XAXIDMA_BD_STS_OFFSET) = Sts;
+		if (Bd == Tail) {
+			break;
+		}
+		Bd = BdAddr(Bd, XAXIDMA_BD_NDESC_OFFSET,
+			XAXIDMA_BD_NDESC_MSB_OFFSET);
+	}
+	Chan->NextBd = BdAddr(Tail, XAXIDMA_BD_NDESC_OFFSET,
+		XAXIDMA_BD_NDESC_MSB_OFFSET);
+	XHostSim_RegSet(Region, ChanOff + XAXIDMA_CDESC_OFFSET, (u32)Tail);
+}
+
+/*****************************************************************************/
+/**
+*
+* AXI DMA model register writes: reset and run/stop update the halted bit,
+* a tail descriptor write completes the BDs. Descriptors are expected not to
+* cross a 4 GB boundary, so a TDESC write is processed with the current
+* TDESC_MSB.
+*
+******************************************************************************/
+static void AxiDmaModel_Write(XHostSim_Region *Region, u32 Offset,
+	u32 Value)
+{
+	AxiDmaModel *Model = (AxiDmaModel *)Region->Priv;
+	u32 ChanOff = (Offset >= XAXIDMA_RX_OFFSET) ? XAXIDMA_RX_OFFSET : 0U;
+	AxiDmaChan *Chan = &Model->Chan[(ChanOff != 0U) ? 1U : 0U];
+	u32 Sr;
+
+	switch (Offset - ChanOff) {
+	case XAXIDMA_CR_OFFSET:
+		if ((Value & XAXIDMA_CR_RESET_MASK) != 0U) {
+			/* Reset is done at once and resets both channels */
+			XHostSim_RegSet(Region, XAXIDMA_CR_OFFSET, 0U);
+			XHostSim_RegSet(Region, XAXIDMA_RX_OFFSET +
+				XAXIDMA_CR_OFFSET, 0U);
+			XHostSim_RegSet(Region, XAXIDMA_SR_OFFSET,
+				XAXIDMA_HALTED_MASK);
+			XHostSim_RegSet(Region, XAXIDMA_RX_OFFSET +
+				XAXIDMA_SR_OFFSET, XAXIDMA_HALTED_MASK);
+			break;
+		}
+		XHostSim_RegSet(Region, Offset, Value);
+		Sr = XHostSim_RegGet(Region, ChanOff + XAXIDMA_SR_OFFSET);
+		if ((Value & XAXIDMA_CR_RUNSTOP_MASK) != 0U) {
+			Sr &= ~XAXIDMA_HALTED_MASK;
+		} else {
+			Sr |= XAXIDMA_HALTED_MASK;
+		}
+		XHostSim_RegSet(Region, ChanOff + XAXIDMA_SR_OFFSET, Sr);
+		break;
+	case XAXIDMA_CDESC_OFFSET:
+	case XAXIDMA_CDESC_MSB_OFFSET:
+		XHostSim_RegSet(Region, Offset, Value);
+		Chan->NextBd = 0U;
+		break;
+	case XAXIDMA_TDESC_OFFSET:
+		XHostSim_RegSet(Region, Offset, Value);
+		AxiDmaModel_Complete(Region, ChanOff);
+		break;
+	default:
+		XHostSim_RegSet(Region, Offset, Value);
+		break;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* GEM receive model: writes up to NumFrames frames into the BDs owned by the
+* hardware, starting at RXQBASE and following the wrap bit, and returns the
+* number received. It stops at the first BD still owned by software.
+*
+******************************************************************************/
+static u32 EmacPsModel_Receive(EmacPsModel *Model, u32 NumFrames)
+{
+	UINTPTR Bd = Model->NextBd;
+	u32 Count;
+	u32 Word0;
+
+	if (Bd == 0U) {
+		Bd = XHostSim_RegGet(Model->Region, XEMACPS_RXQBASE_OFFSET);
+#if defined (__aarch64__)
+		Bd |= (UINTPTR)XHostSim_RegGet(Model->Region,
+			XEMACPS_MSBBUF_RXQBASE_OFFSET) << 32U;
+#endif
+	}
+
+	for (Count = 0U; Count < NumFrames; Count++) {
+		Word0 = *(volatile u32 *)(Bd + XEMACPS_BD_ADDR_OFFSET);
+		if ((Word0 & XEMACPS_RXBUF_NEW_MASK) != 0U) {
+			break;
+		}
+		*(volatile u32 *)(Bd + XEMACPS_BD_STAT_OFFSET) =
+			XEMACPS_RXBUF_SOF_MASK | XEMACPS_RXBUF_EOF_MASK |
+			FRAME_LEN;
+		*(volatile u32 *)(Bd + XEMACPS_BD_ADDR_OFFSET) =
+			Word0 | XEMACPS_RXBUF_NEW_MASK;
+		if ((Word0 & XEMACPS_RXBUF_WRAP_MASK) != 0U) {
+			Bd = XHostSim_RegGet(Model->Region,
+				XEMACPS_RXQBASE_OFFSET);
+#if defined (__aarch64__)
+			Bd |= (UINTPTR)XHostSim_RegGet(Model->Region,
+				XEMACPS_MSBBUF_RXQBASE_OFFSET) << 32U;
+#endif
+		} else {
+			Bd += sizeof(XEmacPs_Bd);
+		}
+	}
+	Model->NextBd = Bd;
+
+	return Count;
+}
+
+/*****************************************************************************/
+/**
+*
+* Prints the results of a benchmark.
+*
+******************************************************************************/
+static void Report(const char *Test, u32 BatchSize, Phase *Phases,
+	u32 NumPhases, u64 Bds, const XHostSim_Region *Region)
+{
+	u32 Index;
+	u64 Total = 0U;
+
+	for (Index = 0U; Index < NumPhases; Index++) {
+		printf("hostsim,%s,%u,%s_ns_per_bd,%.1f\n", Test, BatchSize,
+			Phases[Index].Name, (double)Phases[Index].Ns /
+			(double)Bds);
+		Total += Phases[Index].Ns;
+	}
+	printf("hostsim,%s,%u,total_ns_per_bd,%.1f\n", Test, BatchSize,
+		(double)Total / (double)Bds);
+	printf("hostsim,%s,%u,reg_reads_per_bd,%.3f\n", Test, BatchSize,
+		(double)Region->Reads / (double)Bds);
+	printf("hostsim,%s,%u,reg_writes_per_bd,%.3f\n", Test, BatchSize,
+		(double)Region->Writes / (double)Bds);
+	printf("hostsim,%s,%u,cache_ops_per_bd,%.3f\n", Test, BatchSize,
+		(double)(XHostSim_Cache.FlushRange +
+		XHostSim_Cache.InvalidateRange) / (double)Bds);
+	printf("hostsim,%s,%u,bds,%llu\n", Test, BatchSize,
+		(unsigned long long)Bds);
+}
+
+/*****************************************************************************/
+/**
+*
+* Times the MM2S ring of the AXI DMA driver.
+*
+* @return	0 on success, 1 if the driver or the model misbehaved.
+*
+******************************************************************************/
+static int BenchAxiDmaTx(void)
+{
+	XHostSim_Region Region;
+	AxiDmaModel Model;
+	XAxiDma_Config Config;
+	XAxiDma Dma;
+	XAxiDma_BdRing *Ring;
+	XAxiDma_Bd Template;
+	XAxiDma_Bd *BdSet;
+	XAxiDma_Bd *Bd;
+	Phase Phases[] = {
+		{ "alloc_setup", 0U }, { "to_hw", 0U }, { "from_hw", 0U },
+		{ "free", 0U },
+	};
+	u32 RingSize = XAxiDma_BdRingMemCalc(XAXIDMA_BD_MINIMUM_ALIGNMENT,
+		RingBds);
+	u8 *RingMem;
+	u8 *Bufs;
+	u64 End;
+	u64 T0;
+	u64 T1;
+	u64 Bds = 0U;
+	u32 Index;
+	int Num;
+	int Errors = 0;
+
+	memset(&Model, 0, sizeof(Model));
+	Model.Chan[1].IsRx = 1U;
+	memset(&Config, 0, sizeof(Config));
+	Config.BaseAddr = XHostSim_Map(&Region, AXIDMA_REG_SIZE, NULL,
+		AxiDmaModel_Write, &Model);
+	Config.HasMm2S = 1;
+	Config.HasS2Mm = 1;
+	Config.HasSg = 1;
+	Config.Mm2SDataWidth = 64;
+	Config.S2MmDataWidth = 64;
+	Config.Mm2sNumChannels = 1;
+	Config.S2MmNumChannels = 1;
+	Config.SgLengthWidth = 26;
+#if defined (__aarch64__)
+	Config.AddrWidth = 64;
+#else
+	Config.AddrWidth = 32;
+#endif
+	RingMem = XHostSim_Alloc(RingSize);
+	Bufs = XHostSim_Alloc(RingBds * BUF_SIZE);
+	if ((Config.BaseAddr == 0U) || (RingMem == NULL) || (Bufs == NULL)) {
+		fprintf(stderr, "axidma_tx: out of memory\n");
+		return 1;
+	}
+
+	if (XAxiDma_CfgInitialize(&Dma, &Config) != XST_SUCCESS) {
+		fprintf(stderr, "axidma_tx: XAxiDma_CfgInitialize failed\n");
+		return 1;
+	}
+	Ring = XAxiDma_GetTxRing(&Dma);
+	if ((XAxiDma_BdRingCreate(Ring, (UINTPTR)RingMem, (UINTPTR)RingMem,
+		XAXIDMA_BD_MINIMUM_ALIGNMENT, (int)RingBds) != XST_SUCCESS)) {
+		fprintf(stderr, "axidma_tx: XAxiDma_BdRingCreate failed\n");
+		return 1;
+	}
+	XAxiDma_BdClear(&Template);
+	if ((XAxiDma_BdRingClone(Ring, &Template) != XST_SUCCESS) ||
+		(XAxiDma_BdRingStart(Ring) != XST_SUCCESS)) {
+		fprintf(stderr, "axidma_tx: ring setup failed\n");
+		return 1;
+	}
+
+	XHostSim_ResetStats();
+	End = NowNs() + ((u64)DurationMs * 1000000U);
+	while ((NowNs() < End) && (Errors == 0)) {
+		T0 = NowNs();
+		if (XAxiDma_BdRingAlloc(Ring, (int)Batch, &BdSet) !=
+			XST_SUCCESS) {
+			Errors++;
+			break;
+		}
+		Bd = BdSet;
+		for (Index = 0U; Index < Batch; Index++) {
+			(void)XAxiDma_BdSetBufAddr(Bd, (UINTPTR)Bufs +
+				((Bds + Index) % RingBds) * BUF_SIZE);
+			(void)XAxiDma_BdSetLength(Bd, FRAME_LEN,
+				Ring->MaxTransferLen);
+			XAxiDma_BdSetCtrl(Bd, XAXIDMA_BD_CTRL_TXSOF_MASK |
+				XAXIDMA_BD_CTRL_TXEOF_MASK);
+			Bd = (XAxiDma_Bd *)XAxiDma_BdRingNext(Ring, Bd);
+		}
+		T1 = NowNs();
+		Phases[0].Ns += T1 - T0;
+
+		T0 = T1;
+		if (XAxiDma_BdRingToHw(Ring, (int)Batch, BdSet) !=
+			XST_SUCCESS) {
+			Errors++;
+		}
+		T1 = NowNs();
+		Phases[1].Ns += T1 - T0;
+
+		T0 = T1;
+		Num = XAxiDma_BdRingFromHw(Ring, (int)Batch, &BdSet);
+		T1 = NowNs();
+		Phases[2].Ns += T1 - T0;
+		if ((Num != (int)Batch) || ((XAxiDma_BdGetSts(BdSet) &
+			XAXIDMA_BD_STS_COMPLETE_MASK) == 0U)) {
+			Errors++;
+			break;
+		}
+
+		T0 = T1;
+		if (XAxiDma_BdRingFree(Ring, Num, BdSet) != XST_SUCCESS) {
+			Errors++;
+		}
+		T1 = NowNs();
+		Phases[3].Ns += T1 - T0;
+		Bds += Batch;
+	}
+
+	if (Bds != 0U) {
+		Report("axidma_tx", Batch, Phases, 4U, Bds, &Region);
+	}
+	if (Errors != 0) {
+		fprintf(stderr, "axidma_tx: driver or model error after %llu "
+			"BDs\n", (unsigned long long)Bds);
+	}
+	XHostSim_Unmap(&Region);
+	XHostSim_Free(RingMem, RingSize);
+	XHostSim_Free(Bufs, RingBds * BUF_SIZE);
+
+	return (Errors != 0) ? 1 : 0;
+}
+
+/*****************************************************************************/
+/**
+*
+* Times the receive ring of the GEM driver.
+*
+* @return	0 on success, 1 if the driver or the model misbehaved.
+*
+******************************************************************************/
+static int BenchEmacPsRx(void)
+{
+	XHostSim_Region Region;
+	EmacPsModel Model;
+	XEmacPs_BdRing Ring;
+	XEmacPs_Bd Template;
+	XEmacPs_Bd *BdSet;
+	XEmacPs_Bd *Bd;
+	Phase Phases[] = {
+		{ "from_hw_rx", 0U }, { "free", 0U }, { "alloc_setup", 0U },
+		{ "to_hw", 0U },
+	};
+	u32 RingSize = XEmacPs_BdRingMemCalc(XEMACPS_DMABD_MINIMUM_ALIGNMENT,
+		RingBds);
+	u8 *RingMem;
+	u8 *Bufs;
+	UINTPTR RegBase;
+	u64 End;
+	u64 T0;
+	u64 T1;
+	u64 Bds = 0U;
+	u32 Index;
+	u32 Num;
+	int Errors = 0;
+
+	memset(&Model, 0, sizeof(Model));
+	memset(&Ring, 0, sizeof(Ring));
+	Model.Region = &Region;
+	RegBase = XHostSim_Map(&Region, EMACPS_REG_SIZE, NULL, NULL, &Model);
+	RingMem = XHostSim_Alloc(RingSize);
+	Bufs = XHostSim_Alloc(RingBds * BUF_SIZE);
+	if ((RegBase == 0U) || (RingMem == NULL) || (Bufs == NULL)) {
+		fprintf(stderr, "emacps_rx: out of memory\n");
+		return 1;
+	}
+
+	XEmacPs_BdClear(&Template);
+	if ((XEmacPs_BdRingCreate(&Ring, (UINTPTR)RingMem, (UINTPTR)RingMem,
+		XEMACPS_DMABD_MINIMUM_ALIGNMENT, RingBds) != XST_SUCCESS) ||
+		(XEmacPs_BdRingClone(&Ring, &Template, XEMACPS_RECV) !=
+		XST_SUCCESS) ||
+		(XEmacPs_BdRingAlloc(&Ring, RingBds - 1U, &BdSet) !=
+		XST_SUCCESS)) {
+		fprintf(stderr, "emacps_rx: ring setup failed\n");
+		return 1;
+	}
+	/*
+	 * One BD stays owned by software: with the whole ring given to
+	 * hardware HwTail equals HwHead, and XEmacPs_BdRingFromHwRx() then
+	 * returns a single BD per call.
+	 */
+	Bd = BdSet;
+	for (Index = 0U; Index < RingBds; Index++) {
+		XEmacPs_BdSetAddressRx(Bd, (UINTPTR)Bufs + (Index * BUF_SIZE));
+		if (Index < (RingBds - 1U)) {
+			XEmacPs_BdClearRxNew(Bd);
+		} else {
+			XEmacPs_BdWrite(Bd, XEMACPS_BD_ADDR_OFFSET,
+				XEmacPs_BdRead(Bd, XEMACPS_BD_ADDR_OFFSET) |
+				XEMACPS_RXBUF_NEW_MASK);
+		}
+		Bd = XEmacPs_BdRingNext(&Ring, Bd);
+	}
+	if (XEmacPs_BdRingToHw(&Ring, RingBds - 1U, BdSet) != XST_SUCCESS) {
+		fprintf(stderr, "emacps_rx: XEmacPs_BdRingToHw failed\n");
+		return 1;
+	}
+	/* What XEmacPs_SetQueuePtr does for queue 0 */
+	XEmacPs_WriteReg(RegBase, XEMACPS_RXQBASE_OFFSET,
+		(u32)((UINTPTR)RingMem & ULONG64_LO_MASK));
+#if defined (__aarch64__)
+	XEmacPs_WriteReg(RegBase, XEMACPS_MSBBUF_RXQBASE_OFFSET,
+		UPPER_32_BITS((UINTPTR)RingMem));
+#endif
+
+	XHostSim_ResetStats();
+	End = NowNs() + ((u64)DurationMs * 1000000U);
+	while ((NowNs() < End) && (Errors == 0)) {
+		if (EmacPsModel_Receive(&Model, Batch) != Batch) {
+			Errors++;
+			break;
+		}
+
+		T0 = NowNs();
+		Num = XEmacPs_BdRingFromHwRx(&Ring, Batch, &BdSet);
+		T1 = NowNs();
+		Phases[0].Ns += T1 - T0;
+		if ((Num != Batch) || (XEmacPs_BdGetLength(BdSet) !=
+			FRAME_LEN)) {
+			Errors++;
+			break;
+		}
+
+		T0 = T1;
+		if (XEmacPs_BdRingFree(&Ring, Num, BdSet) != XST_SUCCESS) {
+			Errors++;
+		}
+		T1 = NowNs();
+		Phases[1].Ns += T1 - T0;
+
+		T0 = T1;
+		if (XEmacPs_BdRingAlloc(&Ring, Batch, &BdSet) !=
+			XST_SUCCESS) {
+			Errors++;
+			break;
+		}
+		Bd = BdSet;
+		for (Index = 0U; Index < Batch; Index++) {
+			XEmacPs_BdSetAddressRx(Bd, (UINTPTR)Bufs +
+				(((Bds + Index) % RingBds) * BUF_SIZE));
+			XEmacPs_BdClearRxNew(Bd);
+			Bd = XEmacPs_BdRingNext(&Ring, Bd);
+		}
+		T1 = NowNs();
+		Phases[2].Ns += T1 - T0;
+
+		T0 = T1;
+		if (XEmacPs_BdRingToHw(&Ring, Batch, BdSet) != XST_SUCCESS) {
+			Errors++;
+		}
+		T1 = NowNs();
+		Phases[3].Ns += T1 - T0;
+		Bds += Batch;
+	}
+
+	if (Bds != 0U) {
+		Report("emacps_rx", Batch, Phases, 4U, Bds, &Region);
+	}
+	if (Errors != 0) {
+		fprintf(stderr, "emacps_rx: driver or model error after %llu "
+			"BDs\n", (unsigned long long)Bds);
+	}
+	XHostSim_Unmap(&Region);
+	XHostSim_Free(RingMem, RingSize);
+	XHostSim_Free(Bufs, RingBds * BUF_SIZE);
+
+	return (Errors != 0) ? 1 : 0;
+}
+
+static void Usage(const char *Prog)
+{
+	fprintf(stderr, "usage: %s [-r ring_bds] [-b batch] [-t ms] "
+		"[test...]\n"
+		"tests: axidma_tx emacps_rx (default: all)\n", Prog);
+}
+
+int main(int argc, char *argv[])
+{
+	static const struct {
+		const char *Name;
+		int (*Fn)(void);
+	} Tests[] = {
+		{ "axidma_tx", BenchAxiDmaTx },
+		{ "emacps_rx", BenchEmacPsRx },
+	};
+	u32 NumTests = (u32)(sizeof(Tests) / sizeof(Tests[0]));
+	u32 Test;
+	int Opt;
+	int Index;
+	int Found;
+	int Status = 0;
+
+	while ((Opt = getopt(argc, argv, "r:b:t:h")) != -1) {
+		switch (Opt) {
+		case 'r':
+			RingBds = (u32)strtoul(optarg, NULL, 0);
+			break;
+		case 'b':
+			Batch = (u32)strtoul(optarg, NULL, 0);
+			break;
+		case 't':
+			DurationMs = (u32)strtoul(optarg, NULL, 0);
+			break;
+		default:
+			Usage(argv[0]);
+			return 2;
+		}
+	}
+	if ((Batch == 0U) || (Batch >= RingBds)) {
+		fprintf(stderr, "batch must be at least 1 and smaller than "
+			"the ring\n");
+		return 2;
+	}
+	for (Index = optind; Index < argc; Index++) {
+		Found = 0;
+		for (Test = 0U; Test < NumTests; Test++) {
+			Found |= (strcmp(argv[Index], Tests[Test].Name) == 0);
+		}
+		if (Found == 0) {
+			Usage(argv[0]);
+			return 2;
+		}
+	}
+
+	for (Test = 0U; Test < NumTests; Test++) {
+		Found = (optind == argc);
+		for (Index = optind; Index < argc; Index++) {
+			Found |= (strcmp(argv[Index], Tests[Test].Name) == 0);
+		}
+		if (Found != 0) {
+			Status |= Tests[Test].Fn();
+		}
+	}
+
+	return Status;
+}
@@ -0,0 +1,23 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xparameters.h
+*
+* Hardware description for XIL_HOSTSIM builds. Simulated devices are
+* described by the configuration structures built by the application, so
+* only the standard output is defined here: xil_printf() writes through the
+* outbyte() of xil_hostsim.c.
+*
+******************************************************************************/
+
+#ifndef XPARAMETERS_H
+#define XPARAMETERS_H
+
+#define STDOUT_BASEADDRESS	0U
+
+#endif /* XPARAMETERS_H */
@@ -0,0 +1,385 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xpm_sampler_decode.c
+*
+* Host utility which converts a dump of the PMU sampling profiler buffer
+* (see xpm_sampler.h) to perf script text or folded stacks. perf script
+* output can be fed to flame graph, speedscope or other tools consuming
+* "perf script", folded stacks go directly to flamegraph.pl.
+*
+* Addresses are symbolized with the output of "nm -n <elf>" when given,
+* return addresses are looked up at the call site (address - 4).
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date        Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.00  ant  10/18/2026 Initial release
+*
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <inttypes.h>
+
+/************************** Constant Definitions *****************************/
+/* Must match xpm_sampler.h */
+#define SAMPLER_MAGIC		(0x534D5058U)
+#define SAMPLER_VERSION		(1U)
+#define SAMPLER_HDR_LEN		(32U)
+#define SAMPLER_REC_FIXED_LEN	(24U)
+
+#define DEFAULT_TIMER_FREQ	(100000000U)
+#define MAX_SYM_NAME		(256U)
+#define MAX_FOLDED_LEN		(4096U)
+
+/**************************** Type Definitions *******************************/
+typedef struct {
+	uint64_t Addr;
+	char *Name;
+} Symbol;
+
+typedef struct {
+	uint32_t Id;
+	const char *Name;
+} EventName;
+
+/************************** Variable Definitions *****************************/
+static const EventName EventNames[] = {
+	{0x03U, "l1d_cache_refill"},
+	{0x04U, "l1d_cache"},
+	{0x08U, "instructions"},
+	{0x10U, "branch-misses"},
+	{0x11U, "cycles"},
+	{0x12U, "branches"},
+	{0x17U, "l2d_cache_refill"},
+	{0x22U, "br_mis_pred_retired"},
+	{0x23U, "stall_frontend"},
+	{0x24U, "stall_backend"},
+};
+
+static Symbol *Symbols;
+static uint32_t NumSymbols;
+static double TimerFreq = DEFAULT_TIMER_FREQ;
+
+/*****************************************************************************/
+static uint32_t Rd32(const uint8_t *Buf)
+{
+	return (uint32_t)Buf[0U] | ((uint32_t)Buf[1U] << 8U) |
+		((uint32_t)Buf[2U] << 16U) | ((uint32_t)Buf[3U] << 24U);
+}
+
+/*****************************************************************************/
+static uint64_t Rd64(const uint8_t *Buf)
+{
+	return (uint64_t)Rd32(Buf) | ((uint64_t)Rd32(&Buf[4U]) << 32U);
+}
+
+/*****************************************************************************/
+static const char *GetEventName(uint32_t Id)
+{
+	static char Raw[16];
+	uint32_t Index;
+
+	for (Index = 0U; Index < (sizeof(EventNames) / sizeof(EventNames[0U]));
+	     Index++) {
+		if (EventNames[Index].Id == Id) {
+			return EventNames[Index].Name;
+		}
+	}
+	(void)snprintf(Raw, sizeof(Raw), "raw-0x%x", Id);
+
+	return Raw;
+}
+
+/*****************************************************************************/
+static int SymCompare(const void *A, const void *B)
+{
+	const Symbol *SymA = A;
+	const Symbol *SymB = B;
+
+	return (SymA->Addr > SymB->Addr) - (SymA->Addr < SymB->Addr);
+}
+
+/*****************************************************************************/
+static int LoadSymbols(const char *Path)
+{
+	FILE *File = fopen(Path, "r");
+	char Line[MAX_SYM_NAME + 64U];
+	char Name[MAX_SYM_NAME];
+	uint64_t Addr;
+	char Type;
+	uint32_t Capacity = 0U;
+	Symbol *Tmp;
+
+	if (File == NULL) {
+		perror(Path);
+		return -1;
+	}
+
+	while (fgets(Line, sizeof(Line), File) != NULL) {
+		if (sscanf(Line, "%" SCNx64 " %c %255s", &Addr, &Type,
+			   Name) != 3) {
+			continue;
+		}
+		/* Only code symbols are of interest */
+		if ((Type != 't') && (Type != 'T') && (Type != 'w') &&
+		    (Type != 'W')) {
+			continue;
+		}
+		if (NumSymbols == Capacity) {
+			Capacity = (Capacity == 0U) ? 1024U : (Capacity * 2U);
+			Tmp = realloc(Symbols, Capacity * sizeof(Symbol));
+			if (Tmp == NULL) {
+				fclose(File);
+				return -1;
+			}
+			Symbols = Tmp;
+		}
+		Symbols[NumSymbols].Addr = Addr;
+		Symbols[NumSymbols].Name = strdup(Name);
+		NumSymbols++;
+	}
+	fclose(File);
+	qsort(Symbols, NumSymbols, sizeof(Symbol), SymCompare);
+
+	return 0;
+}
+
+/*****************************************************************************/
+static const Symbol *FindSymbol(uint64_t Addr)
+{
+	uint32_t Low = 0U;
+	uint32_t High = NumSymbols;
+	uint32_t Mid;
+
+	/* Last symbol with address <= Addr */
+	while (Low < High) {
+		Mid = Low + ((High - Low) / 2U);
+		if (Symbols[Mid].Addr <= Addr) {
+			Low = Mid + 1U;
+		}
+		else {
+			High = Mid;
+		}
+	}
+
+	return (Low == 0U) ? NULL : &Symbols[Low - 1U];
+}
+
+/*****************************************************************************/
+static void PrintPerfFrame(uint64_t Addr, uint64_t Lookup)
+{
+	const Symbol *Sym = FindSymbol(Lookup);
+
+	if (Sym != NULL) {
+		printf("\t%16" PRIx64 " %s+0x%" PRIx64 " (firmware)\n", Addr,
+		       Sym->Name, Lookup - Sym->Addr);
+	}
+	else {
+		printf("\t%16" PRIx64 " [unknown] (firmware)\n", Addr);
+	}
+}
+
+/*****************************************************************************/
+static void AppendFolded(char *Out, size_t *Len, uint64_t Lookup)
+{
+	const Symbol *Sym = FindSymbol(Lookup);
+	int Count;
+
+	if (Sym != NULL) {
+		Count = snprintf(&Out[*Len], MAX_FOLDED_LEN - *Len, "%s%s",
+				 (*Len != 0U) ? ";" : "", Sym->Name);
+	}
+	else {
+		Count = snprintf(&Out[*Len], MAX_FOLDED_LEN - *Len,
+				 "%s0x%" PRIx64, (*Len != 0U) ? ";" : "",
+				 Lookup);
+	}
+	if ((Count > 0) && ((*Len + (size_t)Count) < MAX_FOLDED_LEN)) {
+		*Len += (size_t)Count;
+	}
+}
+
+/*****************************************************************************/
+static void DecodeRecord(const uint8_t *Rec, uint32_t MaxDepth,
+			 uint32_t Cpu, uint32_t Period, const char *Event,
+			 int Folded)
+{
+	uint64_t TimeStamp = Rd64(Rec);
+	uint64_t Pc = Rd64(&Rec[8U]);
+	uint32_t Depth = Rd32(&Rec[16U]);
+	uint64_t Frame;
+	char Stack[MAX_FOLDED_LEN];
+	size_t Len = 0U;
+	int32_t Index;
+
+	if (Depth > MaxDepth) {
+		Depth = MaxDepth;
+	}
+
+	if (Folded == 0) {
+		printf("firmware 0/0 [%03u] %.9f: %u %s:\n", Cpu,
+		       (double)TimeStamp / TimerFreq, Period, Event);
+		PrintPerfFrame(Pc, Pc);
+		for (Index = 0; Index < (int32_t)Depth; Index++) {
+			Frame = Rd64(&Rec[SAMPLER_REC_FIXED_LEN +
+				       ((uint32_t)Index * 8U)]);
+			PrintPerfFrame(Frame, Frame - 4U);
+		}
+		printf("\n");
+	}
+	else {
+		/* Folded stacks are outermost first */
+		for (Index = (int32_t)Depth - 1; Index >= 0; Index--) {
+			Frame = Rd64(&Rec[SAMPLER_REC_FIXED_LEN +
+				       ((uint32_t)Index * 8U)]);
+			AppendFolded(Stack, &Len, Frame - 4U);
+		}
+		AppendFolded(Stack, &Len, Pc);
+		printf("%s 1\n", Stack);
+	}
+}
+
+/*****************************************************************************/
+static int Decode(const uint8_t *Buf, size_t Size, int Folded)
+{
+	uint32_t RecordSize;
+	uint32_t NumRecords;
+	uint32_t Total;
+	uint32_t Count;
+	uint32_t First;
+	uint32_t MaxDepth;
+	uint32_t Index;
+	const char *Event;
+
+	if ((Size < SAMPLER_HDR_LEN) || (Rd32(Buf) != SAMPLER_MAGIC) ||
+	    ((Rd32(&Buf[4U]) & 0xFFFFU) != SAMPLER_VERSION)) {
+		fprintf(stderr, "Not a PMU sampler buffer\n");
+		return -1;
+	}
+
+	RecordSize = Rd32(&Buf[4U]) >> 16U;
+	NumRecords = Rd32(&Buf[8U]);
+	Total = Rd32(&Buf[12U]);
+	Event = GetEventName(Rd32(&Buf[16U]));
+	if ((RecordSize < SAMPLER_REC_FIXED_LEN) || (NumRecords == 0U)) {
+		fprintf(stderr, "Invalid record size %u or count %u\n",
+			RecordSize, NumRecords);
+		return -1;
+	}
+	MaxDepth = (RecordSize - SAMPLER_REC_FIXED_LEN) / 8U;
+
+	/* Oldest record is at the write index once the ring has wrapped */
+	Count = (Total < NumRecords) ? Total : NumRecords;
+	First = (Total < NumRecords) ? 0U : (Total % NumRecords);
+	if ((SAMPLER_HDR_LEN + ((size_t)NumRecords * RecordSize)) > Size) {
+		fprintf(stderr, "Dump is truncated\n");
+		return -1;
+	}
+	if (Total > NumRecords) {
+		fprintf(stderr, "Ring wrapped, %u oldest samples lost\n",
+			Total - NumRecords);
+	}
+
+	for (Index = 0U; Index < Count; Index++) {
+		DecodeRecord(&Buf[SAMPLER_HDR_LEN + ((size_t)((First + Index) %
+			     NumRecords) * RecordSize)], MaxDepth,
+			     Rd32(&Buf[24U]), Rd32(&Buf[20U]), Event, Folded);
+	}
+
+	return 0;
+}
+
+/*****************************************************************************/
+static void Usage(const char *Name)
+{
+	fprintf(stderr, "Usage: %s [-f perf|folded] [-s <nm -n output>] "
+		"[-t <timer freq in Hz>] <sample dump>\n"
+		"Default format is perf, default timer frequency %u Hz\n",
+		Name, DEFAULT_TIMER_FREQ);
+}
+
+/*****************************************************************************/
+int main(int argc, char *argv[])
+{
+	FILE *File;
+	long Size;
+	uint8_t *Buf;
+	int Folded = 0;
+	int Arg;
+	int Status;
+
+	for (Arg = 1; Arg < (argc - 1); Arg += 2) {
+		if (strcmp(argv[Arg], "-f") == 0) {
+			if (strcmp(argv[Arg + 1], "folded") == 0) {
+				Folded = 1;
+			}
+			else if (strcmp(argv[Arg + 1], "perf") != 0) {
+				Usage(argv[0]);
+				return 1;
+			}
+		}
+		else if (strcmp(argv[Arg], "-s") == 0) {
+			if (LoadSymbols(argv[Arg + 1]) != 0) {
+				return 1;
+			}
+		}
+		else if (strcmp(argv[Arg], "-t") == 0) {
+			TimerFreq = strtod(argv[Arg + 1], NULL);
+			if (TimerFreq <= 0.0) {
+				fprintf(stderr, "Invalid frequency %s\n",
+					argv[Arg + 1]);
+				return 1;
+			}
+		}
+		else {
+			break;
+		}
+	}
+	if (Arg != (argc - 1)) {
+		Usage(argv[0]);
+		return 1;
+	}
+
+	File = fopen(argv[Arg], "rb");
+	if (File == NULL) {
+		perror(argv[Arg]);
+		return 1;
+	}
+	fseek(File, 0L, SEEK_END);
+	Size = ftell(File);
+	rewind(File);
+	if (Size <= 0) {
+		fprintf(stderr, "Empty sample dump\n");
+		fclose(File);
+		return 1;
+	}
+
+	Buf = malloc((size_t)Size);
+	if ((Buf == NULL) || (fread(Buf, 1U, (size_t)Size, File) !=
+			      (size_t)Size)) {
+		fprintf(stderr, "Failed to read %s\n", argv[Arg]);
+		fclose(File);
+		free(Buf);
+		return 1;
+	}
+	fclose(File);
+
+	Status = Decode(Buf, (size_t)Size, Folded);
+	free(Buf);
+
+	return (Status == 0) ? 0 : 1;
+}
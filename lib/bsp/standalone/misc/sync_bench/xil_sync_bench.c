@@ -0,0 +1,377 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xil_sync_bench.c
+*
+* Host contention benchmark for the BSP ticket lock and ring buffers, built
+* from the BSP sources and run with one pthread per CPU. It can also be built
+* for Linux on the target (e.g. A53) to measure the real interconnect.
+*
+* - tas: test and set lock, same algorithm as Xil_SpinLock
+* - ticket: Xil_TicketLock
+* Every thread repeatedly takes the lock for the test duration and
+* increments a shared counter inside; total rate and the share of the
+* slowest and fastest thread (fairness) are reported, and the counter is
+* checked against the acquisitions for mutual exclusion.
+*
+* - spsc/spsc-nc: one producer and one consumer, coherent and
+*   non-coherent (cache calls are no-ops on host) rings
+* - mpmc: half the threads push, half pop
+* Elements carry producer and sequence, consumers check per producer order
+* and all elements are accounted for.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -----------------------------------------------
+* 1.00  ant  10/18/26 Initial release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <time.h>
+#include "xil_ticketlock.h"
+#include "xil_ringbuf.h"
+
+/************************** Constant Definitions *****************************/
+#define MAX_THREADS		(64U)
+#define DEFAULT_DURATION_MS	(1000U)
+#define DEFAULT_ITEMS		(4000000U)
+#define RING_DEPTH		(1024U)
+#define RING_ID			(0x42454E43U)
+#define LOCK_ID			(0x4C4F434BU)
+
+/**************************** Type Definitions *******************************/
+typedef struct {
+	pthread_t Thread;
+	uint32_t Index;
+	uint64_t Count;
+	uint32_t Errors;
+	uint64_t Pad[6];
+} Worker;
+
+typedef struct {
+	uint32_t Producer;
+	uint32_t Seq;
+} Item;
+
+/************************** Variable Definitions *****************************/
+static uint32_t NumThreads = 4U;
+static uint32_t DurationMs = DEFAULT_DURATION_MS;
+static uint32_t NumItems = DEFAULT_ITEMS;
+static uint32_t CsWork = 0U;
+
+static Worker Workers[MAX_THREADS];
+static pthread_barrier_t StartBarrier;
+static volatile int Stop;
+
+static volatile uint32_t TasLock __attribute__((aligned(64)));
+static XTicketLock TicketLock;
+static volatile uint64_t Shared __attribute__((aligned(64)));
+
+static XRingBuf_Shm *RingShm;
+static uint32_t RingFlags;
+static uint32_t NumProducers;
+static volatile uint32_t ProducersDone;
+
+/*****************************************************************************/
+static double NowSec(void)
+{
+	struct timespec Ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &Ts);
+	return (double)Ts.tv_sec + ((double)Ts.tv_nsec * 1e-9);
+}
+
+/*****************************************************************************/
+static void CriticalSection(void)
+{
+	uint32_t Index;
+
+	Shared = Shared + 1U;
+	for (Index = 0U; Index < CsWork; Index++) {
+		XIL_CPU_RELAX();
+	}
+}
+
+/*****************************************************************************/
+static void TasAcquire(void)
+{
+	while (__atomic_exchange_n(&TasLock, 1U, __ATOMIC_ACQUIRE) != 0U) {
+		while (__atomic_load_n(&TasLock, __ATOMIC_RELAXED) != 0U) {
+			XIL_CPU_RELAX();
+		}
+	}
+}
+
+/*****************************************************************************/
+static void TasRelease(void)
+{
+	__atomic_store_n(&TasLock, 0U, __ATOMIC_RELEASE);
+}
+
+/*****************************************************************************/
+static void *TasThread(void *Arg)
+{
+	Worker *Self = Arg;
+
+	pthread_barrier_wait(&StartBarrier);
+	while (Stop == 0) {
+		TasAcquire();
+		CriticalSection();
+		TasRelease();
+		Self->Count++;
+	}
+
+	return NULL;
+}
+
+/*****************************************************************************/
+static void *TicketThread(void *Arg)
+{
+	Worker *Self = Arg;
+
+	pthread_barrier_wait(&StartBarrier);
+	while (Stop == 0) {
+		Xil_TicketLock(&TicketLock);
+		CriticalSection();
+		Xil_TicketUnlock(&TicketLock);
+		Self->Count++;
+	}
+
+	return NULL;
+}
+
+/*****************************************************************************/
+static int RunLock(const char *Name, void *(*Fn)(void *))
+{
+	uint64_t Total = 0U;
+	uint64_t Min = ~0ULL;
+	uint64_t Max = 0U;
+	uint32_t Index;
+	double Start;
+	double Elapsed;
+
+	Stop = 0;
+	Shared = 0U;
+	pthread_barrier_init(&StartBarrier, NULL, NumThreads + 1U);
+	for (Index = 0U; Index < NumThreads; Index++) {
+		Workers[Index].Index = Index;
+		Workers[Index].Count = 0U;
+		pthread_create(&Workers[Index].Thread, NULL, Fn, &Workers[Index]);
+	}
+	pthread_barrier_wait(&StartBarrier);
+	Start = NowSec();
+	usleep(DurationMs * 1000U);
+	Stop = 1;
+	for (Index = 0U; Index < NumThreads; Index++) {
+		pthread_join(Workers[Index].Thread, NULL);
+	}
+	Elapsed = NowSec() - Start;
+	pthread_barrier_destroy(&StartBarrier);
+
+	for (Index = 0U; Index < NumThreads; Index++) {
+		Total += Workers[Index].Count;
+		if (Workers[Index].Count < Min) {
+			Min = Workers[Index].Count;
+		}
+		if (Workers[Index].Count > Max) {
+			Max = Workers[Index].Count;
+		}
+	}
+
+	printf("%-8s %12.0f ops/s  min/max share %5.1f%%/%5.1f%%  %s\n", Name,
+		(double)Total / Elapsed, (100.0 * (double)Min) / (double)Total,
+		(100.0 * (double)Max) / (double)Total,
+		(Shared == Total) ? "ok" : "MUTUAL EXCLUSION BROKEN");
+
+	return (Shared == Total) ? 0 : 1;
+}
+
+/*****************************************************************************/
+static void *ProducerThread(void *Arg)
+{
+	Worker *Self = Arg;
+	XRingBuf Ring;
+	Item Elt;
+
+	if (Xil_RingBufAttach(&Ring, RingShm, RING_ID, RingFlags) !=
+	    (u32)XST_SUCCESS) {
+		Self->Errors++;
+		return NULL;
+	}
+	Elt.Producer = Self->Index;
+	pthread_barrier_wait(&StartBarrier);
+	for (Elt.Seq = 0U; Elt.Seq < NumItems; Elt.Seq++) {
+		while (Xil_RingBufPush(&Ring, &Elt) != (u32)XST_SUCCESS) {
+			XIL_CPU_RELAX();
+		}
+	}
+	__atomic_fetch_add(&ProducersDone, 1U, __ATOMIC_RELEASE);
+
+	return NULL;
+}
+
+/*****************************************************************************/
+static void *ConsumerThread(void *Arg)
+{
+	Worker *Self = Arg;
+	XRingBuf Ring;
+	Item Elt;
+	uint32_t Next[MAX_THREADS];
+	uint32_t Done;
+
+	memset(Next, 0, sizeof(Next));
+	if (Xil_RingBufAttach(&Ring, RingShm, RING_ID, RingFlags) !=
+	    (u32)XST_SUCCESS) {
+		Self->Errors++;
+		return NULL;
+	}
+	pthread_barrier_wait(&StartBarrier);
+	for (;;) {
+		/* Read done count before pop so the last elements are seen */
+		Done = __atomic_load_n(&ProducersDone, __ATOMIC_ACQUIRE);
+		if (Xil_RingBufPop(&Ring, &Elt) != (u32)XST_SUCCESS) {
+			if (Done == NumProducers) {
+				break;
+			}
+			XIL_CPU_RELAX();
+			continue;
+		}
+		/* FIFO order per producer holds for every consumer */
+		if ((Elt.Producer >= NumProducers) ||
+		    (Elt.Seq < Next[Elt.Producer])) {
+			Self->Errors++;
+		}
+		else {
+			Next[Elt.Producer] = Elt.Seq + 1U;
+		}
+		Self->Count++;
+	}
+
+	return NULL;
+}
+
+/*****************************************************************************/
+static int RunRing(const char *Name, uint32_t Flags, uint32_t Producers,
+	uint32_t Consumers)
+{
+	XRingBuf Ring;
+	uint64_t Total = 0U;
+	uint32_t Errors = 0U;
+	uint32_t Index;
+	double Start;
+	double Elapsed;
+	int Status;
+
+	RingFlags = Flags;
+	NumProducers = Producers;
+	ProducersDone = 0U;
+	RingShm = aligned_alloc(XIL_SHM_CACHELINE_SIZE,
+		Xil_RingBufSize(RING_DEPTH, sizeof(Item), Flags));
+	if ((RingShm == NULL) || (Xil_RingBufInit(&Ring, RingShm, RING_ID,
+	    RING_DEPTH, sizeof(Item), Flags) != (u32)XST_SUCCESS)) {
+		fprintf(stderr, "%s: ring init failed\n", Name);
+		free(RingShm);
+		return 1;
+	}
+
+	pthread_barrier_init(&StartBarrier, NULL, Producers + Consumers + 1U);
+	for (Index = 0U; Index < (Producers + Consumers); Index++) {
+		Workers[Index].Index = Index;
+		Workers[Index].Count = 0U;
+		Workers[Index].Errors = 0U;
+		pthread_create(&Workers[Index].Thread, NULL,
+			(Index < Producers) ? ProducerThread : ConsumerThread,
+			&Workers[Index]);
+	}
+	pthread_barrier_wait(&StartBarrier);
+	Start = NowSec();
+	for (Index = 0U; Index < (Producers + Consumers); Index++) {
+		pthread_join(Workers[Index].Thread, NULL);
+		Errors += Workers[Index].Errors;
+		if (Index >= Producers) {
+			Total += Workers[Index].Count;
+		}
+	}
+	Elapsed = NowSec() - Start;
+	pthread_barrier_destroy(&StartBarrier);
+	free(RingShm);
+
+	Status = ((Errors == 0U) &&
+		(Total == ((uint64_t)NumItems * Producers))) ? 0 : 1;
+	printf("%-8s %12.0f elt/s  %u producer(s) %u consumer(s)  %s\n", Name,
+		(double)Total / Elapsed, Producers, Consumers,
+		(Status == 0) ? "ok" : "ELEMENTS LOST OR REORDERED");
+
+	return Status;
+}
+
+/*****************************************************************************/
+static void Usage(const char *Prog)
+{
+	fprintf(stderr, "Usage: %s [-t threads] [-d lock test ms] "
+		"[-n items per producer] [-w critical section relax loops]\n",
+		Prog);
+}
+
+/*****************************************************************************/
+int main(int argc, char *argv[])
+{
+	int Opt;
+	int Status = 0;
+	uint32_t Half;
+
+	while ((Opt = getopt(argc, argv, "t:d:n:w:")) != -1) {
+		switch (Opt) {
+		case 't':
+			NumThreads = (uint32_t)strtoul(optarg, NULL, 0);
+			break;
+		case 'd':
+			DurationMs = (uint32_t)strtoul(optarg, NULL, 0);
+			break;
+		case 'n':
+			NumItems = (uint32_t)strtoul(optarg, NULL, 0);
+			break;
+		case 'w':
+			CsWork = (uint32_t)strtoul(optarg, NULL, 0);
+			break;
+		default:
+			Usage(argv[0]);
+			return 1;
+		}
+	}
+	if ((NumThreads < 2U) || (NumThreads > MAX_THREADS)) {
+		fprintf(stderr, "Threads must be 2 to %u\n", MAX_THREADS);
+		return 1;
+	}
+
+	if (Xil_TicketLockInit(&TicketLock, LOCK_ID) != (u32)XST_SUCCESS) {
+		fprintf(stderr, "Ticket lock init failed\n");
+		return 1;
+	}
+
+	printf("%u threads, %u relax loops in critical section\n", NumThreads,
+		CsWork);
+	Status |= RunLock("tas", TasThread);
+	Status |= RunLock("ticket", TicketThread);
+	Status |= RunRing("spsc", XIL_RINGBUF_SPSC, 1U, 1U);
+	Status |= RunRing("spsc-nc", XIL_RINGBUF_SPSC |
+		XIL_RINGBUF_NONCOHERENT, 1U, 1U);
+	Half = NumThreads / 2U;
+	Status |= RunRing("mpmc", XIL_RINGBUF_MPMC, Half, NumThreads - Half);
+
+	return Status;
+}
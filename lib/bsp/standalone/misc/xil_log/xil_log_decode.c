@@ -0,0 +1,452 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xil_log_decode.c
+*
+* Host utility which decodes deferred log records written by XIL_LOG() (see
+* xil_log.h in the standalone BSP). Records hold the address of the format
+* string and raw arguments, the strings are read from the loaded sections of
+* the application ELF and the message is formatted the way xil_printf would.
+*
+* Input is either a dump of the whole log buffer (starting with XLogHdr, e.g.
+* read over JTAG) or the byte stream produced by Xil_LogDrainRaw(). Record
+* word size is taken from the ELF class.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -----------------------------------------------
+* 1.00  ant  10/18/26 Initial release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <ctype.h>
+#include <unistd.h>
+
+/************************** Constant Definitions *****************************/
+/* Must match xil_log.h */
+#define LOG_MAGIC		(0x474F4C58U)
+#define LOG_HDR_SIZE		(32U)
+#define LOG_REC_MARK		(0xA5000000U)
+#define LOG_REC_MARK_MASK	(0xFF000000U)
+#define LOG_REC_ARGS_SHIFT	(16U)
+#define LOG_REC_ARGS_MASK	(0x00FF0000U)
+#define LOG_REC_LEN_MASK	(0x0000FFFFU)
+#define LOG_REC_HDR_WORDS	(3U)
+#define LOG_MAX_ARGS		(8U)
+
+#define ELF_SHF_ALLOC		(0x2U)
+#define ELF_SHT_NOBITS		(8U)
+
+/**************************** Type Definitions *******************************/
+typedef struct {
+	uint64_t Addr;
+	uint64_t Size;
+	const uint8_t *Data;
+} Section;
+
+/************************** Variable Definitions *****************************/
+static Section *Sections;
+static uint32_t NumSections;
+static uint32_t WordSize = 4U;
+static double TimerFreq;
+
+/*****************************************************************************/
+static uint64_t GetLe(const uint8_t *Ptr, uint32_t Size)
+{
+	uint64_t Val = 0U;
+
+	while (Size > 0U) {
+		Size--;
+		Val = (Val << 8U) | Ptr[Size];
+	}
+
+	return Val;
+}
+
+/*****************************************************************************/
+static uint8_t *ReadFile(const char *Name, size_t *Size)
+{
+	FILE *File = fopen(Name, "rb");
+	uint8_t *Buf = NULL;
+	long Len;
+
+	if (File == NULL) {
+		perror(Name);
+		return NULL;
+	}
+	fseek(File, 0L, SEEK_END);
+	Len = ftell(File);
+	rewind(File);
+	if (Len > 0) {
+		Buf = malloc((size_t)Len);
+		if ((Buf != NULL) &&
+		    (fread(Buf, 1U, (size_t)Len, File) != (size_t)Len)) {
+			free(Buf);
+			Buf = NULL;
+		}
+	}
+	fclose(File);
+	if (Buf == NULL) {
+		fprintf(stderr, "Failed to read %s\n", Name);
+	}
+	*Size = (size_t)Len;
+
+	return Buf;
+}
+
+/*****************************************************************************/
+/**
+ * Collects the allocated sections with contents of a little endian ELF32 or
+ * ELF64 file.
+ *****************************************************************************/
+static int LoadElf(const uint8_t *Elf, size_t Size)
+{
+	uint32_t Is64;
+	uint64_t ShOff;
+	uint32_t ShEntSize;
+	uint32_t ShNum;
+	uint32_t Index;
+	const uint8_t *Sh;
+	uint64_t Flags;
+	uint64_t Offset;
+
+	if ((Size < 52U) || (memcmp(Elf, "\177ELF", 4U) != 0) ||
+	    (Elf[5] != 1U)) {
+		fprintf(stderr, "Not a little endian ELF file\n");
+		return -1;
+	}
+	Is64 = (Elf[4] == 2U) ? 1U : 0U;
+	WordSize = (Is64 != 0U) ? 8U : 4U;
+	ShOff = GetLe(&Elf[Is64 ? 0x28U : 0x20U], WordSize);
+	ShEntSize = (uint32_t)GetLe(&Elf[Is64 ? 0x3AU : 0x2EU], 2U);
+	ShNum = (uint32_t)GetLe(&Elf[Is64 ? 0x3CU : 0x30U], 2U);
+	if ((ShOff + ((uint64_t)ShEntSize * ShNum)) > Size) {
+		fprintf(stderr, "Truncated ELF file\n");
+		return -1;
+	}
+
+	Sections = calloc(ShNum + 1U, sizeof(Section));
+	if (Sections == NULL) {
+		return -1;
+	}
+	for (Index = 0U; Index < ShNum; Index++) {
+		Sh = &Elf[ShOff + ((uint64_t)Index * ShEntSize)];
+		Flags = GetLe(&Sh[8], WordSize);
+		if (((Flags & ELF_SHF_ALLOC) == 0U) ||
+		    (GetLe(&Sh[4], 4U) == ELF_SHT_NOBITS)) {
+			continue;
+		}
+		Sections[NumSections].Addr = GetLe(&Sh[Is64 ? 0x10U : 0x0CU],
+			WordSize);
+		Offset = GetLe(&Sh[Is64 ? 0x18U : 0x10U], WordSize);
+		Sections[NumSections].Size = GetLe(&Sh[Is64 ? 0x20U : 0x14U],
+			WordSize);
+		if ((Offset + Sections[NumSections].Size) > Size) {
+			continue;
+		}
+		Sections[NumSections].Data = &Elf[Offset];
+		NumSections++;
+	}
+
+	return 0;
+}
+
+/*****************************************************************************/
+/**
+ * Returns the NUL terminated string at target address Addr, or NULL if it is
+ * not in a loaded section.
+ *****************************************************************************/
+static const char *GetString(uint64_t Addr)
+{
+	uint32_t Index;
+	const Section *Sec;
+
+	for (Index = 0U; Index < NumSections; Index++) {
+		Sec = &Sections[Index];
+		if ((Addr >= Sec->Addr) && (Addr < (Sec->Addr + Sec->Size)) &&
+		    (memchr(&Sec->Data[Addr - Sec->Addr], 0,
+			    (size_t)(Sec->Addr + Sec->Size - Addr)) != NULL)) {
+			return (const char *)&Sec->Data[Addr - Sec->Addr];
+		}
+	}
+
+	return NULL;
+}
+
+/*****************************************************************************/
+/**
+ * Formats the record like xil_printf: flags '-' and '0', width, precision for
+ * strings, 'l' for 64 bit arguments on 64 bit targets, conversions d i u x X
+ * p c s and %.
+ *****************************************************************************/
+static void Format(const char *Fmt, const uint64_t *Args, uint32_t NumArgs)
+{
+	char Spec[32];
+	uint32_t SpecLen;
+	uint32_t ArgIdx = 0U;
+	uint32_t Long;
+	uint64_t Arg;
+	const char *Str;
+	char Conv;
+
+	while (*Fmt != '\0') {
+		if (*Fmt != '%') {
+			putchar(*Fmt);
+			Fmt++;
+			continue;
+		}
+
+		Spec[0] = '%';
+		SpecLen = 1U;
+		Long = 0U;
+		Fmt++;
+		while ((*Fmt == '-') || (*Fmt == '.') || (*Fmt == 'l') ||
+		       (*Fmt == 'L') || (isdigit((unsigned char)*Fmt) != 0)) {
+			if ((*Fmt == 'l') || (*Fmt == 'L')) {
+				Long = 1U;
+			}
+			else if (SpecLen < (sizeof(Spec) - 8U)) {
+				Spec[SpecLen] = *Fmt;
+				SpecLen++;
+			}
+			Fmt++;
+		}
+		if (*Fmt == '\0') {
+			break;
+		}
+		Conv = *Fmt;
+		Fmt++;
+		if (Conv == '%') {
+			putchar('%');
+			continue;
+		}
+
+		Arg = (ArgIdx < NumArgs) ? Args[ArgIdx] : 0U;
+		ArgIdx++;
+		if ((Long == 0U) || (WordSize == 4U)) {
+			if ((Conv != 'p') && (Conv != 's')) {
+				Arg &= 0xFFFFFFFFU;
+			}
+		}
+
+		switch (tolower((unsigned char)Conv)) {
+		case 'd':
+		case 'i':
+			memcpy(&Spec[SpecLen], "lld", 4U);
+			printf(Spec, (Long && (WordSize == 8U)) ? (long long)Arg :
+				(long long)(int32_t)(uint32_t)Arg);
+			break;
+		case 'u':
+			memcpy(&Spec[SpecLen], "llu", 4U);
+			printf(Spec, (unsigned long long)Arg);
+			break;
+		case 'p':
+		case 'x':
+			/* xil_printf prints hex digits in upper case */
+			memcpy(&Spec[SpecLen], "llX", 4U);
+			printf(Spec, (unsigned long long)Arg);
+			break;
+		case 'c':
+			putchar((int)(Arg & 0xFFU));
+			break;
+		case 's':
+			Str = GetString(Arg);
+			if (Str != NULL) {
+				memcpy(&Spec[SpecLen], "s", 2U);
+				printf(Spec, Str);
+			}
+			else {
+				printf("<str 0x%llx>", (unsigned long long)Arg);
+			}
+			break;
+		default:
+			break;
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+ * Decodes one record and returns its length in words, or 0 if the words at
+ * Rec are not a record.
+ *****************************************************************************/
+static uint32_t DecodeRecord(const uint8_t *Rec, uint32_t AvailWords)
+{
+	uint64_t Words[LOG_REC_HDR_WORDS + LOG_MAX_ARGS];
+	uint32_t Hdr = (uint32_t)GetLe(Rec, 4U);
+	uint32_t Len = Hdr & LOG_REC_LEN_MASK;
+	uint32_t NumArgs = (Hdr & LOG_REC_ARGS_MASK) >> LOG_REC_ARGS_SHIFT;
+	uint32_t Index;
+	const char *Fmt;
+
+	if (((Hdr & LOG_REC_MARK_MASK) != LOG_REC_MARK) ||
+	    (NumArgs > LOG_MAX_ARGS) ||
+	    (Len != (LOG_REC_HDR_WORDS + NumArgs)) || (Len > AvailWords)) {
+		return 0U;
+	}
+	for (Index = 0U; Index < Len; Index++) {
+		Words[Index] = GetLe(&Rec[Index * WordSize], WordSize);
+	}
+
+	if (TimerFreq > 0.0) {
+		printf("[%12.6f] ", (double)Words[1] / TimerFreq);
+	}
+	else {
+		printf("[%12llu] ", (unsigned long long)Words[1]);
+	}
+	if (Words[2] == 0U) {
+		printf("xil_log: %llu records dropped\n",
+			(unsigned long long)Words[3]);
+		return Len;
+	}
+	Fmt = GetString(Words[2]);
+	if (Fmt == NULL) {
+		printf("<fmt 0x%llx>", (unsigned long long)Words[2]);
+		for (Index = 0U; Index < NumArgs; Index++) {
+			printf(" 0x%llx",
+				(unsigned long long)Words[LOG_REC_HDR_WORDS +
+					Index]);
+		}
+		printf("\n");
+		return Len;
+	}
+	Format(Fmt, &Words[LOG_REC_HDR_WORDS], NumArgs);
+	if ((*Fmt == '\0') || (Fmt[strlen(Fmt) - 1U] != '\n')) {
+		putchar('\n');
+	}
+
+	return Len;
+}
+
+/*****************************************************************************/
+static void DecodeStream(const uint8_t *Buf, uint32_t NumWords)
+{
+	uint32_t Word = 0U;
+	uint32_t Len;
+	uint32_t Skipped = 0U;
+
+	while (Word < NumWords) {
+		Len = DecodeRecord(&Buf[Word * WordSize], NumWords - Word);
+		if (Len == 0U) {
+			Word++;
+			Skipped++;
+		}
+		else {
+			Word += Len;
+		}
+	}
+	if (Skipped != 0U) {
+		fprintf(stderr, "Skipped %u words without valid record\n",
+			Skipped);
+	}
+}
+
+/*****************************************************************************/
+/**
+ * Decodes a dump of the whole log buffer, records from Tail to Head.
+ *****************************************************************************/
+static int DecodeBuffer(const uint8_t *Buf, size_t Size)
+{
+	uint32_t NumWords = (uint32_t)GetLe(&Buf[8], 4U);
+	uint32_t Dropped = (uint32_t)GetLe(&Buf[12], 4U);
+	uint32_t Head = (uint32_t)GetLe(&Buf[16], 4U);
+	uint32_t Tail = (uint32_t)GetLe(&Buf[20], 4U);
+	uint32_t Used = Head - Tail;
+	uint32_t Index;
+	uint8_t *Linear;
+
+	if ((Buf[6] != WordSize) || (NumWords == 0U) ||
+	    ((NumWords & (NumWords - 1U)) != 0U) || (Used > NumWords) ||
+	    ((LOG_HDR_SIZE + ((size_t)NumWords * WordSize)) > Size)) {
+		fprintf(stderr, "Log buffer header does not match the ELF or "
+			"dump is truncated\n");
+		return 1;
+	}
+	if (Dropped != 0U) {
+		fprintf(stderr, "%u records were dropped\n", Dropped);
+	}
+
+	/* Unwrap the ring so records are contiguous */
+	Linear = malloc(((size_t)Used + 1U) * WordSize);
+	if (Linear == NULL) {
+		return 1;
+	}
+	for (Index = 0U; Index < Used; Index++) {
+		memcpy(&Linear[Index * WordSize], &Buf[LOG_HDR_SIZE +
+			(((Tail + Index) & (NumWords - 1U)) * WordSize)],
+			WordSize);
+	}
+	DecodeStream(Linear, Used);
+	free(Linear);
+
+	return 0;
+}
+
+/*****************************************************************************/
+static void Usage(const char *Prog)
+{
+	fprintf(stderr, "Usage: %s [-t timer freq in Hz] <elf> <log dump>\n"
+		"Log dump is the log buffer or output of Xil_LogDrainRaw\n",
+		Prog);
+}
+
+/*****************************************************************************/
+int main(int argc, char *argv[])
+{
+	uint8_t *Elf;
+	uint8_t *Buf;
+	size_t ElfSize;
+	size_t Size;
+	int Opt;
+	int Status = 0;
+
+	while ((Opt = getopt(argc, argv, "t:")) != -1) {
+		if (Opt == 't') {
+			TimerFreq = strtod(optarg, NULL);
+		}
+		else {
+			Usage(argv[0]);
+			return 1;
+		}
+	}
+	if ((argc - optind) != 2) {
+		Usage(argv[0]);
+		return 1;
+	}
+
+	Elf = ReadFile(argv[optind], &ElfSize);
+	if ((Elf == NULL) || (LoadElf(Elf, ElfSize) != 0)) {
+		free(Elf);
+		return 1;
+	}
+	Buf = ReadFile(argv[optind + 1], &Size);
+	if (Buf == NULL) {
+		free(Elf);
+		return 1;
+	}
+
+	if ((Size >= LOG_HDR_SIZE) && (GetLe(Buf, 4U) == LOG_MAGIC)) {
+		Status = DecodeBuffer(Buf, Size);
+	}
+	else {
+		DecodeStream(Buf, (uint32_t)(Size / WordSize));
+	}
+
+	free(Buf);
+	free(Sections);
+	free(Elf);
+	return Status;
+}
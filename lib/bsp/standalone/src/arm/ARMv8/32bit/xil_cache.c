@@ -25,6 +25,12 @@
  * 6.8  asa  11/10/18 Fix issues in cache Xil_DCacheInvalidate and
  * 			Xil_DCacheFlush that got introduced in the optimization
  * 			changes done in the previous patch for this file.
+ * 8.0	ant  10/18/26 Xil_DCacheFlushRange flushes the whole cache from
+ *			Xil_DCacheGetRangeThreshold() bytes on and masks
+ *			interrupts only for XIL_DCACHE_RANGE_CHUNK bytes at a
+ *			time.
+ *	ant  10/18/26 The whole cache is only flushed when opted in and
+ *			called with interrupts masked.
  * </pre>
  *
  ******************************************************************************/
@@ -407,6 +413,10 @@ void Xil_DCacheFlushLine(u32 adr)
  *
  * @return	None.
  *
+ * @note		Ranges of Xil_DCacheGetRangeThreshold() bytes or more are
+ *		handled by flushing the whole Data cache, when called with
+ *		IRQ and FIQ masked.
+ *
  ****************************************************************************/
 void Xil_DCacheFlushRange(INTPTR adr, u32 len)
 {
@@ -416,6 +426,15 @@ void Xil_DCacheFlushRange(INTPTR adr, u32 len)
 	u32 tempend;
 	u32 currmask;
 
+	/*
+	 * Fewer operations for the whole cache, taken only when the caller
+	 * already masks the interrupts the whole cache flush keeps masked
+	 */
+	if (Xil_DCacheRangeUseFlush(len) != 0U) {
+		Xil_DCacheFlush();
+		return;
+	}
+
 	currmask = mfcpsr();
 	mtcpsr(currmask | IRQ_FIQ_MASK);
 	if (len != 0U) {
@@ -448,6 +467,13 @@ void Xil_DCacheFlushRange(INTPTR adr, u32 len)
 			/* Wait for invalidate to complete */
 			dsb();
 			tempadr += cacheline;
+			if (((tempadr & (XIL_DCACHE_RANGE_CHUNK - 1U)) == 0U) &&
+				(tempadr < tempend)) {
+				/* Take pending interrupts between chunks */
+				mtcpsr(currmask);
+				isb();
+				mtcpsr(currmask | IRQ_FIQ_MASK);
+			}
 		}
 	}
 	mtcpsr(currmask);
@@ -23,6 +23,8 @@
 * Ver   Who  Date     Changes
 * ----- ---- -------- -----------------------------------------------
 * 5.2	pkp  28/05/15 First release
+* 8.0	ant  10/18/26 Added XIL_DCACHE_RANGE_THRESHOLD and xil_cache_range.h
+*	ant  10/18/26 XIL_DCACHE_RANGE_THRESHOLD defaults to 0
 * </pre>
 *
 ******************************************************************************/
@@ -30,11 +32,22 @@
 #define XIL_CACHE_H
 
 #include "xil_types.h"
+#include "xil_cache_range.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/*
+ * Default size from which range flush cleans and invalidates the whole data
+ * cache instead, 0 to always flush line by line. Opt in by defining it or
+ * with Xil_DCacheSetRangeThreshold(), e.g. to 0x100000U, the size of
+ * the L2 cache.
+ */
+#ifndef XIL_DCACHE_RANGE_THRESHOLD
+#define XIL_DCACHE_RANGE_THRESHOLD	0U
+#endif
+
 void Xil_DCacheEnable(void);
 void Xil_DCacheDisable(void);
 void Xil_DCacheInvalidate(void);
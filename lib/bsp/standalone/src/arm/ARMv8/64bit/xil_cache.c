@@ -61,6 +61,15 @@
 *                    macro. Xil_DCacheFlushRange macro points to the
 *                    Xil_DCacheInvalidateRange API to avoid code duplication.
 * 8.0 mus  02/24/22  Added support for CortexA78 processor in VERSAL NET SoC
+* 8.0 ant  10/18/26  Xil_DCacheInvalidateRange flushes the whole cache from
+*                    Xil_DCacheGetRangeThreshold() bytes on and masks
+*                    interrupts only for XIL_DCACHE_RANGE_CHUNK bytes at a
+*                    time.
+* 8.0 ant  10/18/26  Xil_DCacheInvalidateRange stays line by line, as set/way
+*                    operations do not reach the caches of other CPUs. The
+*                    whole cache is only flushed by the new
+*                    Xil_DCacheFlushRange function, when opted in and called
+*                    with interrupts masked.
 *
 * </pre>
 *
@@ -474,6 +483,8 @@ void Xil_DCacheInvalidateLine(INTPTR adr)
 * 			crashing because of the loss of essential data. Hence, such
 * 			operations are promoted to clean and invalidate which avoids such
 *			corruption.
+*			Interrupts are masked for XIL_DCACHE_RANGE_CHUNK bytes
+*			at a time.
 *
 ****************************************************************************/
 void Xil_DCacheInvalidateRange(INTPTR  adr, INTPTR len)
@@ -482,6 +493,7 @@ void Xil_DCacheInvalidateRange(INTPTR  adr, INTPTR len)
 	INTPTR end = adr + len;
 	adr = adr & (~0x3F);
 	u32 currmask = mfcpsr();
+
 	mtcpsr(currmask | IRQ_FIQ_MASK);
 	if (len != 0U) {
 		while (adr < end) {
@@ -560,6 +572,13 @@ void Xil_DCacheInvalidateRange(INTPTR  adr, INTPTR len)
 			 __asm volatile( "NOP" );
 			 __asm volatile( "NOP" );
 	#endif
+			if (((adr & ((INTPTR)XIL_DCACHE_RANGE_CHUNK - 1)) == 0) &&
+				(adr < end)) {
+				/* Take pending interrupts between chunks */
+				mtcpsr(currmask);
+				isb();
+				mtcpsr(currmask | IRQ_FIQ_MASK);
+			}
 		}
 	}
 	/* Wait for invalidate to complete */
@@ -567,6 +586,38 @@ void Xil_DCacheInvalidateRange(INTPTR  adr, INTPTR len)
 	mtcpsr(currmask);
 }
 
+/****************************************************************************/
+/**
+* @brief	Flush the Data cache for the given address range.
+* 			The cachelines present in the address range are cleaned and
+*			invalidated.
+*
+* @param	adr: 64bit start address of the range to be flushed.
+* @param	len: Length of the range to be flushed in bytes.
+*
+* @return	None.
+*
+* @note		Ranges of Xil_DCacheGetRangeThreshold() bytes or more are
+*			handled by flushing the whole Data cache of this CPU,
+*			when called with IRQ and FIQ masked. See
+*			xil_cache_range.h.
+*
+****************************************************************************/
+void Xil_DCacheFlushRange(INTPTR adr, INTPTR len)
+{
+	u32 rangelen = 0U;
+
+	if (len > 0) {
+		rangelen = (len > (INTPTR)0xFFFFFFFFU) ? 0xFFFFFFFFU : (u32)len;
+	}
+
+	if (Xil_DCacheRangeUseFlush(rangelen) != 0U) {
+		Xil_DCacheFlush();
+	} else {
+		Xil_DCacheInvalidateRange(adr, len);
+	}
+}
+
 /****************************************************************************/
 /**
 * @brief	Flush the Data cache.
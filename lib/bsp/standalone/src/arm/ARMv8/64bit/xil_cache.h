@@ -23,6 +23,10 @@
 * Ver   Who  Date     Changes
 * ----- ---- -------- -----------------------------------------------
 * 5.00 	pkp  05/29/14 First release
+* 8.0   ant  10/18/26 Added XIL_DCACHE_RANGE_THRESHOLD and xil_cache_range.h
+*       ant  10/18/26 Xil_DCacheFlushRange is a function instead of a macro
+*                     for Xil_DCacheInvalidateRange, which stays line by
+*                     line. XIL_DCACHE_RANGE_THRESHOLD defaults to 0.
 * </pre>
 *
 ******************************************************************************/
@@ -30,6 +34,7 @@
 #define XIL_CACHE_H
 
 #include "xil_types.h"
+#include "xil_cache_range.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -47,14 +52,22 @@ extern "C" {
  *@endcond
  */
 
-/***************** Macros (Inline Functions) Definitions *********************/
-#define Xil_DCacheFlushRange Xil_DCacheInvalidateRange
+/*
+ * Default size from which range flush cleans and invalidates the whole data
+ * cache instead, 0 to always flush line by line. Opt in by defining it or
+ * with Xil_DCacheSetRangeThreshold(), e.g. to 0x100000U, the size of
+ * the L2 cache.
+ */
+#ifndef XIL_DCACHE_RANGE_THRESHOLD
+#define XIL_DCACHE_RANGE_THRESHOLD	0U
+#endif
 
 /************************** Function Prototypes ******************************/
 void Xil_DCacheEnable(void);
 void Xil_DCacheDisable(void);
 void Xil_DCacheInvalidate(void);
 void Xil_DCacheInvalidateRange(INTPTR adr, INTPTR len);
+void Xil_DCacheFlushRange(INTPTR adr, INTPTR len);
 void Xil_DCacheInvalidateLine(INTPTR adr);
 void Xil_DCacheFlush(void);
 void Xil_DCacheFlushLine(INTPTR adr);
@@ -0,0 +1,272 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xpm_sampler.c
+*
+* This file contains the PMU counter overflow based sampling profiler for
+* Cortex A53/A72/A78 64 bit processors. For more information, see
+* xpm_sampler.h.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -----------------------------------------------
+* 8.0   ant  10/18/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xpm_sampler.h"
+#include "xpseudo_asm.h"
+#include "bspconfig.h"
+#include "xstatus.h"
+
+/************************** Constant Definitions ****************************/
+
+#define XPM_SAMPLER_PMCR_E_MASK		0x1U	/* PMCR_EL0 enable bit */
+#define XPM_SAMPLER_CNTR_MAX		0xFFFFFFFFU
+#define XPM_SAMPLER_MPIDR_AFF0_MASK	0xFFU
+
+/**************************** Type Definitions ******************************/
+
+/***************** Macros (Inline Functions) Definitions ********************/
+
+/************************** Variable Definitions *****************************/
+
+static XPm_SamplerHdr *SamplerHdr = NULL;
+static XPm_SampleRecord *SamplerRecords = NULL;
+static u32 SamplerCntr = XPM_NO_COUNTERS_AVAILABLE;
+static u32 SamplerReload = 0U;
+
+/************************** Function Prototypes ******************************/
+
+static inline __attribute__((always_inline)) u32 Xpm_SamplerWalkStack(
+	u64 *Frames);
+
+/****************************************************************************/
+/**
+*
+* @brief    This function initializes the sample buffer. Buffer starts with
+*           XPm_SamplerHdr and rest of it is used for sample records.
+*
+* @param    BufPtr: 8 byte aligned buffer for samples.
+* @param    Size: Size of the buffer in bytes.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_INVALID_PARAM if the buffer can not hold a record.
+*
+*****************************************************************************/
+u32 Xpm_SamplerInit(void *BufPtr, u32 Size)
+{
+	u32 Status = (u32)XST_INVALID_PARAM;
+
+	if ((BufPtr == NULL) || (((UINTPTR)BufPtr & 0x7U) != 0U) ||
+		(Size < (sizeof(XPm_SamplerHdr) + sizeof(XPm_SampleRecord)))) {
+		goto END;
+	}
+
+	SamplerHdr = (XPm_SamplerHdr *)BufPtr;
+	SamplerRecords = (XPm_SampleRecord *)(void *)(SamplerHdr + 1U);
+	SamplerHdr->Magic = XPM_SAMPLER_MAGIC;
+	SamplerHdr->Version = (u16)XPM_SAMPLER_VERSION;
+	SamplerHdr->RecordSize = (u16)sizeof(XPm_SampleRecord);
+	SamplerHdr->NumRecords = (Size - (u32)sizeof(XPm_SamplerHdr)) /
+				(u32)sizeof(XPm_SampleRecord);
+	SamplerHdr->TotalSamples = 0U;
+	SamplerHdr->EventId = 0U;
+	SamplerHdr->Period = 0U;
+	SamplerHdr->CpuId = (u32)(mfcp(MPIDR_EL1) & XPM_SAMPLER_MPIDR_AFF0_MASK);
+	SamplerHdr->Reserved = 0U;
+	Status = (u32)XST_SUCCESS;
+
+END:
+	return Status;
+}
+
+/****************************************************************************/
+/**
+*
+* @brief    This function allocates a free event counter, sets it up to count
+*           EventId and enables its overflow interrupt after every Period
+*           events.
+*
+* @param    EventId: Event to be sampled, refer xpm_counter.h.
+* @param    Period: Number of events between two samples.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_INVALID_PARAM if sampler is not initialized or Period is 0.
+*		- XPM_NO_COUNTERS_AVAILABLE if all counters are being used.
+*
+*****************************************************************************/
+u32 Xpm_SamplerStart(u32 EventId, u32 Period)
+{
+	u32 Status = (u32)XST_INVALID_PARAM;
+	u64 Counters;
+	u32 Index;
+
+	if ((SamplerHdr == NULL) || (Period == 0U) ||
+		(SamplerCntr != XPM_NO_COUNTERS_AVAILABLE)) {
+		goto END;
+	}
+
+	Counters = mfcp(PMCNTENSET_EL0) & XPM_EVENT_CNTRS_BIT_MASK;
+	for (Index = 0U; Index < XPM_CTRCOUNT; Index++) {
+		if ((Counters & ((u64)1U << Index)) == 0U) {
+			break;
+		}
+	}
+	if (Index == XPM_CTRCOUNT) {
+		Status = XPM_NO_COUNTERS_AVAILABLE;
+		goto END;
+	}
+
+	SamplerCntr = Index;
+	SamplerReload = (XPM_SAMPLER_CNTR_MAX - Period) + 1U;
+	SamplerHdr->EventId = EventId;
+	SamplerHdr->Period = Period;
+
+	mtcp(PMSELR_EL0, (u64)SamplerCntr);
+	mtcp(PMXEVTYPER_EL0, (u64)EventId);
+	mtcp(PMXEVCNTR_EL0, (u64)SamplerReload);
+	mtcp(PMOVSCLR_EL0, (u64)1U << SamplerCntr);
+	mtcp(PMINTENSET_EL1, (u64)1U << SamplerCntr);
+	isb();
+#if defined(VERSAL_NET)
+	mtcp(MDCR_EL3, mfcp(MDCR_EL3) | XPM_MDCR_EL3_SPME_MASK);
+#endif
+	mtcp(PMCR_EL0, mfcp(PMCR_EL0) | XPM_SAMPLER_PMCR_E_MASK);
+	mtcp(PMCNTENSET_EL0, (u64)1U << SamplerCntr);
+	isb();
+	Status = (u32)XST_SUCCESS;
+
+END:
+	return Status;
+}
+
+/****************************************************************************/
+/**
+*
+* @brief    This function stops sampling and releases the event counter.
+*           Samples taken remain in the buffer.
+*
+* @return	None.
+*
+*****************************************************************************/
+void Xpm_SamplerStop(void)
+{
+	if (SamplerCntr != XPM_NO_COUNTERS_AVAILABLE) {
+		mtcp(PMCNTENCLR_EL0, (u64)1U << SamplerCntr);
+		mtcp(PMINTENCLR_EL1, (u64)1U << SamplerCntr);
+		mtcp(PMOVSCLR_EL0, (u64)1U << SamplerCntr);
+		isb();
+		SamplerCntr = XPM_NO_COUNTERS_AVAILABLE;
+	}
+}
+
+/****************************************************************************/
+/**
+*
+* @brief    PMU interrupt handler. Records the interrupted PC and call chain,
+*           reloads the counter for the next period and clears the overflow.
+*
+* @param    CallBackRef: Not used.
+*
+* @return	None.
+*
+*****************************************************************************/
+void Xpm_SamplerIntrHandler(void *CallBackRef)
+{
+	XPm_SampleRecord *Record;
+	u64 Overflow;
+
+	(void)CallBackRef;
+
+	if (SamplerCntr == XPM_NO_COUNTERS_AVAILABLE) {
+		goto END;
+	}
+
+	Overflow = mfcp(PMOVSCLR_EL0) & ((u64)1U << SamplerCntr);
+	if (Overflow == 0U) {
+		goto END;
+	}
+
+	Record = &SamplerRecords[SamplerHdr->TotalSamples %
+			SamplerHdr->NumRecords];
+	Record->TimeStamp = mfcp(CNTPCT_EL0);
+#if EL3
+	Record->Pc = mfcp(ELR_EL3);
+#else
+	Record->Pc = mfcp(ELR_EL1);
+#endif
+	Record->Depth = Xpm_SamplerWalkStack(Record->Frames);
+	Record->Reserved = 0U;
+	SamplerHdr->TotalSamples++;
+
+	/* Reload counter for the next period before clearing overflow */
+	mtcp(PMSELR_EL0, (u64)SamplerCntr);
+	isb();
+	mtcp(PMXEVCNTR_EL0, (u64)SamplerReload);
+	mtcp(PMOVSCLR_EL0, Overflow);
+	isb();
+
+END:
+	return;
+}
+
+/****************************************************************************/
+/**
+*
+* @brief    This function walks the frame pointer chain of interrupted code.
+*           Frame records are {previous frame pointer, return address}, the
+*           first XPM_SAMPLER_SKIP_FRAMES records belong to interrupt
+*           dispatch. Walk stops at a NULL, misaligned or out of order frame
+*           pointer so a corrupted chain is never followed far.
+*           It is always inlined so that the walk starts from the frame of
+*           Xpm_SamplerIntrHandler, which XPM_SAMPLER_SKIP_FRAMES counts.
+*
+* @param    Frames: Array of XPM_SAMPLER_MAX_DEPTH entries for return
+*           addresses.
+*
+* @return	Number of return addresses stored.
+*
+*****************************************************************************/
+static inline __attribute__((always_inline)) u32 Xpm_SamplerWalkStack(
+	u64 *Frames)
+{
+	const u64 *Fp = (const u64 *)__builtin_frame_address(0);
+	const u64 *NextFp;
+	u32 Skip = 0U;
+	u32 Depth = 0U;
+
+	while ((Fp != NULL) && (Depth < XPM_SAMPLER_MAX_DEPTH)) {
+		NextFp = (const u64 *)(UINTPTR)Fp[0U];
+		if (Skip < XPM_SAMPLER_SKIP_FRAMES) {
+			Skip++;
+		}
+		else {
+			if (Fp[1U] == 0U) {
+				break;
+			}
+			Frames[Depth] = Fp[1U];
+			Depth++;
+		}
+		if ((((UINTPTR)NextFp & 0x7U) != 0U) || (NextFp <= Fp) ||
+			(((UINTPTR)NextFp - (UINTPTR)Fp) >
+				XPM_SAMPLER_MAX_FRAME_SIZE)) {
+			break;
+		}
+		Fp = NextFp;
+	}
+
+	return Depth;
+}
@@ -0,0 +1,128 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+* @file xpm_sampler.h
+*
+* @addtogroup a53_64_pm_sampler_apis Cortex A53/A72/A78 64bit PMU Sampling Profiler
+*
+* The sampler programs one performance monitor event counter to overflow
+* after every Period occurrences of the chosen event and records a sample on
+* every overflow interrupt. Sampling on XPM_EVENT_CPU_CYCLES gives time based
+* profile, other events (L1/L2 data cache refills, mispredicted branches...)
+* point at the code causing them.
+*
+* Each sample holds the counter timestamp, the interrupted PC and up to
+* XPM_SAMPLER_MAX_DEPTH return addresses from the frame pointer chain of the
+* interrupted code. Samples are written to a caller provided buffer, which
+* starts with XPm_SamplerHdr followed by fixed size XPm_SampleRecord entries,
+* used as a ring so the latest samples are always retained. The buffer can be
+* dumped over JTAG or by the application and converted on host with
+* misc/xpm_sampler_decode.
+*
+* Usage:
+* - Call Xpm_SamplerInit() with the buffer.
+* - Connect Xpm_SamplerIntrHandler() to the PMU interrupt of the CPU in GIC
+*   and enable it.
+* - Call Xpm_SamplerStart() with the event and period, Xpm_SamplerStop() when
+*   done.
+*
+* @{
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- ---------------------------------------------------
+* 8.0   ant  10/18/26 First release
+* </pre>
+*
+* @note
+*
+* Call chain is available only for code built with -fno-omit-frame-pointer,
+* PC is always recorded. Nested interrupts must be disabled while sampling.
+*
+******************************************************************************/
+
+#ifndef XPM_SAMPLER_H
+#define XPM_SAMPLER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/***************************** Include Files *********************************/
+
+#include "xil_types.h"
+#include "xpm_counter.h"
+
+/************************** Constant Definitions *****************************/
+
+/**
+ *@cond nocomments
+ */
+
+#define XPM_SAMPLER_MAGIC		0x534D5058U /* "XPMS" */
+#define XPM_SAMPLER_VERSION		1U
+#define XPM_SAMPLER_MAX_DEPTH		8U
+
+/*
+ * Frames walked up from Xpm_SamplerIntrHandler before reaching the
+ * interrupted code: the handler itself, XScuGic_InterruptHandler and
+ * IRQInterrupt. The stack walker is always inlined into the handler, so it
+ * has no frame of its own.
+ */
+#ifndef XPM_SAMPLER_SKIP_FRAMES
+#define XPM_SAMPLER_SKIP_FRAMES		3U
+#endif
+
+/* Largest stack frame accepted while walking the frame pointer chain */
+#define XPM_SAMPLER_MAX_FRAME_SIZE	0x10000U
+
+/**************************** Type Definitions *******************************/
+
+/* Header at the start of sample buffer, all fields are little endian */
+typedef struct {
+	u32 Magic;		/* XPM_SAMPLER_MAGIC */
+	u16 Version;		/* XPM_SAMPLER_VERSION */
+	u16 RecordSize;		/* sizeof(XPm_SampleRecord) */
+	u32 NumRecords;		/* Ring capacity in records */
+	u32 TotalSamples;	/* Samples taken, ring index is modulo
+				 * NumRecords */
+	u32 EventId;		/* PMU event being sampled */
+	u32 Period;		/* Events between two samples */
+	u32 CpuId;		/* MPIDR affinity level 0 */
+	u32 Reserved;
+} XPm_SamplerHdr;
+
+typedef struct {
+	u64 TimeStamp;		/* Generic timer count at sample */
+	u64 Pc;			/* Interrupted PC */
+	u32 Depth;		/* Valid entries in Frames */
+	u32 Reserved;
+	u64 Frames[XPM_SAMPLER_MAX_DEPTH]; /* Return addresses, innermost
+					    * first */
+} XPm_SampleRecord;
+
+/**
+ *@endcond
+ */
+
+/************************** Function Prototypes ******************************/
+
+u32 Xpm_SamplerInit(void *BufPtr, u32 Size);
+u32 Xpm_SamplerStart(u32 EventId, u32 Period);
+void Xpm_SamplerStop(void);
+void Xpm_SamplerIntrHandler(void *CallBackRef);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* XPM_SAMPLER_H */
+/**
+* @} End of "addtogroup a53_64_pm_sampler_apis".
+*/
@@ -0,0 +1,126 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xil_cache_range.c
+*
+* Threshold between range and whole cache maintenance, and scatter list
+* flush. For more information, see xil_cache_range.h.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -----------------------------------------------
+* 8.0   ant  10/18/26 First release
+*       ant  10/18/26 Added Xil_DCacheRangeUseFlush()
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files ********************************/
+#include "xil_cache.h"
+#include "xpseudo_asm.h"
+
+/************************** Constant Definitions ****************************/
+
+#define XIL_CACHE_IRQ_FIQ_MASK	0xC0U	/* IRQ and FIQ mask bits in cpsr */
+
+/************************** Variable Definitions ****************************/
+
+static u32 DCacheRangeThreshold = XIL_DCACHE_RANGE_THRESHOLD;
+
+/****************************************************************************/
+/**
+*
+* @brief    Sets the size from which Xil_DCacheFlushRange() and
+*           Xil_DCacheFlushRanges() flush the whole data cache.
+*
+* @param    Len: Size in bytes, 0 to always maintain line by line, which
+*           is the default unless XIL_DCACHE_RANGE_THRESHOLD is defined.
+*
+* @return   None.
+*
+*****************************************************************************/
+void Xil_DCacheSetRangeThreshold(u32 Len)
+{
+	DCacheRangeThreshold = Len;
+}
+
+/****************************************************************************/
+/**
+*
+* @brief    Returns the size from which the whole data cache is flushed
+*           instead of a range.
+*
+* @return   Size in bytes, 0 if always maintained line by line.
+*
+*****************************************************************************/
+u32 Xil_DCacheGetRangeThreshold(void)
+{
+	return DCacheRangeThreshold;
+}
+
+/****************************************************************************/
+/**
+*
+* @brief    Tells whether a range flush of Len bytes is done by flushing the
+*           whole data cache: a threshold is set, Len reaches it and the
+*           caller masks IRQ and FIQ, so that the set/way flush, which runs
+*           with interrupts masked, adds no interrupt latency.
+*
+* @param    Len: Size of the range in bytes.
+*
+* @return   Non zero to flush the whole data cache, 0 to flush the range.
+*
+*****************************************************************************/
+u32 Xil_DCacheRangeUseFlush(u32 Len)
+{
+	u32 Threshold = DCacheRangeThreshold;
+	u32 UseFlush = 0U;
+
+	if ((Threshold != 0U) && (Len >= Threshold) &&
+		((mfcpsr() & XIL_CACHE_IRQ_FIQ_MASK) == XIL_CACHE_IRQ_FIQ_MASK)) {
+		UseFlush = 1U;
+	}
+
+	return UseFlush;
+}
+
+/****************************************************************************/
+/**
+*
+* @brief    Flushes the data cache for a scatter list of ranges, e.g. the
+*           buffers of a DMA descriptor chain. When the ranges add up to
+*           the threshold and the caller masks interrupts, the whole cache
+*           is flushed once, otherwise each range is flushed line by line.
+*
+* @param    Ranges: Array of ranges.
+* @param    Count: Number of ranges.
+*
+* @return   None.
+*
+*****************************************************************************/
+void Xil_DCacheFlushRanges(const XCacheRange *Ranges, u32 Count)
+{
+	u32 Total = 0U;
+	u32 Index;
+
+	for (Index = 0U; Index < Count; Index++) {
+		Total = ((0xFFFFFFFFU - Total) > Ranges[Index].Len) ?
+			(Total + Ranges[Index].Len) : 0xFFFFFFFFU;
+	}
+
+	if (Xil_DCacheRangeUseFlush(Total) != 0U) {
+		Xil_DCacheFlush();
+	} else {
+		for (Index = 0U; Index < Count; Index++) {
+			Xil_DCacheFlushRange(Ranges[Index].Addr,
+				Ranges[Index].Len);
+		}
+	}
+}
@@ -0,0 +1,82 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xil_cache_range.h
+*
+* Adaptive data cache maintenance for large ranges, shared by the ARM ports
+* and included by their xil_cache.h.
+*
+* Range maintenance costs one operation per cache line, so past some size
+* cleaning and invalidating the whole cache by set/way is cheaper. This is
+* opt in: once a threshold is set with Xil_DCacheSetRangeThreshold() or
+* XIL_DCACHE_RANGE_THRESHOLD, each port's Xil_DCacheFlushRange() switches to
+* Xil_DCacheFlush() from that many bytes on. The mem_bench application
+* measures the break even point of a board, about the size of the last level
+* cache. Xil_DCacheFlush() masks interrupts for its whole run, so the switch
+* is only made when the caller already masks IRQ and FIQ.
+* Xil_DCacheInvalidateRange() always works line by line.
+*
+* Line by line maintenance masks interrupts only for XIL_DCACHE_RANGE_CHUNK
+* bytes at a time.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -----------------------------------------------
+* 8.0   ant  10/18/26 First release
+*       ant  10/18/26 Whole cache flushes are opt in and only done with
+*                     interrupts masked by the caller. Added
+*                     Xil_DCacheRangeUseFlush().
+* </pre>
+*
+* @note
+*
+* Set/way operations only reach the caches of the calling CPU and the
+* caches it shares, not the L1 caches of other CPUs. Leave the threshold at
+* 0 if a buffer can be dirty in the L1 cache of another CPU of the cluster.
+*
+******************************************************************************/
+
+#ifndef XIL_CACHE_RANGE_H	/* prevent circular inclusions */
+#define XIL_CACHE_RANGE_H	/* by using protection macros */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files ********************************/
+#include "xil_types.h"
+
+/************************** Constant Definitions ****************************/
+
+/* Bytes of range maintenance done with interrupts masked, power of 2 */
+#ifndef XIL_DCACHE_RANGE_CHUNK
+#define XIL_DCACHE_RANGE_CHUNK	0x4000U
+#endif
+
+/**************************** Type Definitions ******************************/
+
+/* One range of a scatter list for Xil_DCacheFlushRanges() */
+typedef struct {
+	INTPTR Addr;
+	u32 Len;
+} XCacheRange;
+
+/************************** Function Prototypes *****************************/
+
+void Xil_DCacheSetRangeThreshold(u32 Len);
+u32 Xil_DCacheGetRangeThreshold(void);
+u32 Xil_DCacheRangeUseFlush(u32 Len);
+void Xil_DCacheFlushRanges(const XCacheRange *Ranges, u32 Count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XIL_CACHE_RANGE_H */
@@ -0,0 +1,464 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xil_ringbuf.c
+*
+* Implements SPSC and MPMC lock free ring buffers in shared memory. For more
+* information, see xil_ringbuf.h.
+*
+* Ordering between the element and the index (or slot sequence) publishing it
+* is given by acquire/release atomics, which emit DMB (ARMv7) or LDAR/STLR
+* (ARMv8). For non-coherent rings, the writer cleans the lines it wrote after
+* the write and the reader invalidates the lines before the read, cache range
+* APIs end with DSB so maintenance completes before the next index update.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -----------------------------------------------
+* 8.0   ant  10/18/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files ********************************/
+#include "xil_ringbuf.h"
+
+#if defined(__GNUC__)
+#include "xil_cache.h"
+#include "xil_mem.h"
+
+/************************** Constant Definitions ****************************/
+
+/* Sequence word at the start of every MPMC slot */
+#define XRINGBUF_SEQ_SIZE	4U
+#define XRINGBUF_MAX_DEPTH	0x10000000U
+
+/**************************** Type Definitions ******************************/
+
+/***************** Macros (Inline Functions) Definitions ********************/
+
+#define XRINGBUF_ALIGN4(Size)	(((Size) + 3U) & ~3U)
+
+/************************** Function Prototypes *****************************/
+
+static u32 Xil_RingBufStride(u32 EltSize, u32 Flags);
+static void Xil_RingBufSetup(XRingBuf *Ring, XRingBuf_Shm *Shm);
+static void Xil_RingBufFlush(const XRingBuf *Ring, const volatile void *Addr,
+		u32 Len);
+static void Xil_RingBufInvalidate(const XRingBuf *Ring,
+		const volatile void *Addr, u32 Len);
+static u32 Xil_RingBufPushSpsc(XRingBuf *Ring, const void *Elt);
+static u32 Xil_RingBufPopSpsc(XRingBuf *Ring, void *Elt);
+static u32 Xil_RingBufPushMpmc(XRingBuf *Ring, const void *Elt);
+static u32 Xil_RingBufPopMpmc(XRingBuf *Ring, void *Elt);
+
+/************************** Variable Definitions ****************************/
+
+/****************************************************************************/
+/**
+*
+* @brief	Returns the shared memory needed for a ring.
+*
+* @param    Depth: Number of elements, power of 2 and at least 2.
+* @param    EltSize: Element size in bytes.
+* @param    Flags: XIL_RINGBUF_* flags.
+*
+* @return   Size in bytes, 0 if the parameters are not valid.
+*
+*****************************************************************************/
+u32 Xil_RingBufSize(u32 Depth, u32 EltSize, u32 Flags)
+{
+	u32 Size = 0U;
+	u32 Stride = Xil_RingBufStride(EltSize, Flags);
+
+	if ((Stride != 0U) && (Depth >= 2U) && (Depth <= XRINGBUF_MAX_DEPTH) &&
+		((Depth & (Depth - 1U)) == 0U) &&
+		(Stride <= ((0xFFFFFFFFU - (u32)sizeof(XRingBuf_Shm)) / Depth))) {
+		Size = (u32)sizeof(XRingBuf_Shm) + (Depth * Stride);
+	}
+
+	return Size;
+}
+
+/****************************************************************************/
+/**
+*
+* @brief	Initializes a ring in shared memory and the local handle to it.
+*           Must be called by exactly one of the applications sharing the
+*           ring, before the others attach to it.
+*
+* @param    Ring: Local handle to be initialized.
+* @param    ShmPtr: Shared memory of Xil_RingBufSize() bytes, aligned to
+*           XIL_SHM_CACHELINE_SIZE.
+* @param    Id: User chosen Id identifying the ring.
+* @param    Depth: Number of elements, power of 2 and at least 2.
+* @param    EltSize: Element size in bytes.
+* @param    Flags: XIL_RINGBUF_SPSC or XIL_RINGBUF_MPMC, SPSC rings can be
+*           combined with XIL_RINGBUF_NONCOHERENT.
+*
+* @return   XST_SUCCESS if the ring is initialized.
+*           XST_INVALID_PARAM if any parameter is not valid.
+*
+*****************************************************************************/
+u32 Xil_RingBufInit(XRingBuf *Ring, void *ShmPtr, u32 Id, u32 Depth,
+		u32 EltSize, u32 Flags)
+{
+	u32 Status = (u32)XST_INVALID_PARAM;
+	XRingBuf_Shm *Shm = (XRingBuf_Shm *)ShmPtr;
+	u32 Index;
+
+	if ((Ring == NULL) || (Shm == NULL) ||
+		(((UINTPTR)Shm & (XIL_SHM_CACHELINE_SIZE - 1U)) != 0U) ||
+		(Xil_RingBufSize(Depth, EltSize, Flags) == 0U)) {
+		goto END;
+	}
+
+	Shm->Magic = 0U;
+	Shm->Id = Id;
+	Shm->Flags = Flags;
+	Shm->Depth = Depth;
+	Shm->EltSize = EltSize;
+	Shm->Stride = Xil_RingBufStride(EltSize, Flags);
+	Shm->Head = 0U;
+	Shm->Tail = 0U;
+	Xil_RingBufSetup(Ring, Shm);
+
+	/* Slot sequence tells MPMC producers that the slot is free */
+	if ((Flags & XIL_RINGBUF_MPMC) != 0U) {
+		for (Index = 0U; Index < Depth; Index++) {
+			*(volatile u32 *)(void *)&Ring->Slots[Index * Ring->Stride] =
+				Index;
+		}
+	}
+
+	Xil_RingBufFlush(Ring, Shm, (u32)sizeof(XRingBuf_Shm));
+	__atomic_store_n(&Shm->Magic, XIL_RINGBUF_MAGIC, __ATOMIC_RELEASE);
+	Xil_RingBufFlush(Ring, &Shm->Magic, (u32)sizeof(Shm->Magic));
+	Status = (u32)XST_SUCCESS;
+
+END:
+	return Status;
+}
+
+/****************************************************************************/
+/**
+*
+* @brief	Initializes the local handle to a ring initialized by another
+*           application.
+*
+* @param    Ring: Local handle to be initialized.
+* @param    ShmPtr: Shared memory of the ring.
+* @param    Id: Id the ring was initialized with.
+* @param    Flags: Flags the ring was initialized with.
+*
+* @return   XST_SUCCESS if the ring can be used.
+*           XST_FAILURE if the ring is not initialized yet, or with other Id
+*           or flags.
+*
+*****************************************************************************/
+u32 Xil_RingBufAttach(XRingBuf *Ring, void *ShmPtr, u32 Id, u32 Flags)
+{
+	u32 Status = (u32)XST_FAILURE;
+	XRingBuf_Shm *Shm = (XRingBuf_Shm *)ShmPtr;
+
+	if ((Ring == NULL) || (Shm == NULL)) {
+		goto END;
+	}
+
+	Ring->Flags = Flags;
+	Xil_RingBufInvalidate(Ring, Shm, (u32)sizeof(XRingBuf_Shm));
+	if ((__atomic_load_n(&Shm->Magic, __ATOMIC_ACQUIRE) !=
+			XIL_RINGBUF_MAGIC) || (Shm->Id != Id) ||
+		(Shm->Flags != Flags)) {
+		goto END;
+	}
+
+	Xil_RingBufSetup(Ring, Shm);
+	Status = (u32)XST_SUCCESS;
+
+END:
+	return Status;
+}
+
+/****************************************************************************/
+/**
+*
+* @brief	Copies an element to the ring.
+*
+* @param    Ring: Ring handle.
+* @param    Elt: Element of the ring element size.
+*
+* @return   XST_SUCCESS if the element is queued.
+*           XST_DEVICE_BUSY if the ring is full.
+*
+*****************************************************************************/
+u32 Xil_RingBufPush(XRingBuf *Ring, const void *Elt)
+{
+	u32 Status;
+
+	if ((Ring->Flags & XIL_RINGBUF_MPMC) != 0U) {
+		Status = Xil_RingBufPushMpmc(Ring, Elt);
+	} else {
+		Status = Xil_RingBufPushSpsc(Ring, Elt);
+	}
+
+	return Status;
+}
+
+/****************************************************************************/
+/**
+*
+* @brief	Copies the oldest element out of the ring.
+*
+* @param    Ring: Ring handle.
+* @param    Elt: Buffer of the ring element size.
+*
+* @return   XST_SUCCESS if an element is copied.
+*           XST_NO_DATA if the ring is empty.
+*
+*****************************************************************************/
+u32 Xil_RingBufPop(XRingBuf *Ring, void *Elt)
+{
+	u32 Status;
+
+	if ((Ring->Flags & XIL_RINGBUF_MPMC) != 0U) {
+		Status = Xil_RingBufPopMpmc(Ring, Elt);
+	} else {
+		Status = Xil_RingBufPopSpsc(Ring, Elt);
+	}
+
+	return Status;
+}
+
+/****************************************************************************/
+/**
+*
+* @brief	Returns the slot size for the element size, or 0 if the element
+*           size or flags are not valid. Atomics on non-coherent cacheable
+*           memory are not reliable, so MPMC rings must be coherent.
+*
+*****************************************************************************/
+static u32 Xil_RingBufStride(u32 EltSize, u32 Flags)
+{
+	u32 Stride = 0U;
+
+	if ((EltSize == 0U) || (EltSize > 0xFFFFU) ||
+		((Flags & ~(XIL_RINGBUF_MPMC | XIL_RINGBUF_NONCOHERENT)) != 0U) ||
+		(Flags == (XIL_RINGBUF_MPMC | XIL_RINGBUF_NONCOHERENT))) {
+		goto END;
+	}
+
+	Stride = XRINGBUF_ALIGN4(EltSize);
+	if ((Flags & XIL_RINGBUF_MPMC) != 0U) {
+		Stride += XRINGBUF_SEQ_SIZE;
+	}
+
+END:
+	return Stride;
+}
+
+/****************************************************************************/
+/**
+*
+* @brief	Fills the local handle from the ring control block.
+*
+*****************************************************************************/
+static void Xil_RingBufSetup(XRingBuf *Ring, XRingBuf_Shm *Shm)
+{
+	Ring->Shm = Shm;
+	Ring->Slots = (u8 *)(void *)(Shm + 1U);
+	Ring->Flags = Shm->Flags;
+	Ring->Mask = Shm->Depth - 1U;
+	Ring->EltSize = Shm->EltSize;
+	Ring->Stride = Shm->Stride;
+	Ring->HeadCache = Shm->Head;
+	Ring->TailCache = Shm->Tail;
+}
+
+/****************************************************************************/
+/**
+*
+* @brief	Writes back lines written by this CPU for a non-coherent ring.
+*
+*****************************************************************************/
+static void Xil_RingBufFlush(const XRingBuf *Ring, const volatile void *Addr,
+		u32 Len)
+{
+	if ((Ring->Flags & XIL_RINGBUF_NONCOHERENT) != 0U) {
+		Xil_DCacheFlushRange((INTPTR)Addr, Len);
+	}
+}
+
+/****************************************************************************/
+/**
+*
+* @brief	Discards stale lines written by the other side of a
+*           non-coherent ring. This CPU never writes these lines, so no data
+*           is lost.
+*
+*****************************************************************************/
+static void Xil_RingBufInvalidate(const XRingBuf *Ring,
+		const volatile void *Addr, u32 Len)
+{
+	if ((Ring->Flags & XIL_RINGBUF_NONCOHERENT) != 0U) {
+		Xil_DCacheInvalidateRange((INTPTR)Addr, Len);
+	}
+}
+
+/****************************************************************************/
+/**
+*
+* @brief	SPSC push. Tail is read from shared memory only when the ring
+*           looks full with the Tail seen last time.
+*
+*****************************************************************************/
+static u32 Xil_RingBufPushSpsc(XRingBuf *Ring, const void *Elt)
+{
+	u32 Status = (u32)XST_DEVICE_BUSY;
+	XRingBuf_Shm *Shm = Ring->Shm;
+	u32 Head = Shm->Head;
+	u8 *Slot;
+
+	if ((Head - Ring->TailCache) > Ring->Mask) {
+		Xil_RingBufInvalidate(Ring, &Shm->Tail, (u32)sizeof(Shm->Tail));
+		Ring->TailCache = __atomic_load_n(&Shm->Tail, __ATOMIC_ACQUIRE);
+		if ((Head - Ring->TailCache) > Ring->Mask) {
+			goto END;
+		}
+	}
+
+	Slot = &Ring->Slots[(Head & Ring->Mask) * Ring->Stride];
+	Xil_MemCpy(Slot, Elt, Ring->EltSize);
+	Xil_RingBufFlush(Ring, Slot, Ring->EltSize);
+	__atomic_store_n(&Shm->Head, Head + 1U, __ATOMIC_RELEASE);
+	Xil_RingBufFlush(Ring, &Shm->Head, (u32)sizeof(Shm->Head));
+	Status = (u32)XST_SUCCESS;
+
+END:
+	return Status;
+}
+
+/****************************************************************************/
+/**
+*
+* @brief	SPSC pop. Head is read from shared memory only when the ring
+*           looks empty with the Head seen last time.
+*
+*****************************************************************************/
+static u32 Xil_RingBufPopSpsc(XRingBuf *Ring, void *Elt)
+{
+	u32 Status = (u32)XST_NO_DATA;
+	XRingBuf_Shm *Shm = Ring->Shm;
+	u32 Tail = Shm->Tail;
+	u8 *Slot;
+
+	if (Tail == Ring->HeadCache) {
+		Xil_RingBufInvalidate(Ring, &Shm->Head, (u32)sizeof(Shm->Head));
+		Ring->HeadCache = __atomic_load_n(&Shm->Head, __ATOMIC_ACQUIRE);
+		if (Tail == Ring->HeadCache) {
+			goto END;
+		}
+	}
+
+	Slot = &Ring->Slots[(Tail & Ring->Mask) * Ring->Stride];
+	Xil_RingBufInvalidate(Ring, Slot, Ring->EltSize);
+	Xil_MemCpy(Elt, Slot, Ring->EltSize);
+	__atomic_store_n(&Shm->Tail, Tail + 1U, __ATOMIC_RELEASE);
+	Xil_RingBufFlush(Ring, &Shm->Tail, (u32)sizeof(Shm->Tail));
+	Status = (u32)XST_SUCCESS;
+
+END:
+	return Status;
+}
+
+/****************************************************************************/
+/**
+*
+* @brief	MPMC push. A slot is free for position Pos when its sequence
+*           equals Pos, the producer claims it by advancing Head and
+*           publishes the element by setting the sequence to Pos + 1.
+*
+*****************************************************************************/
+static u32 Xil_RingBufPushMpmc(XRingBuf *Ring, const void *Elt)
+{
+	u32 Status = (u32)XST_DEVICE_BUSY;
+	XRingBuf_Shm *Shm = Ring->Shm;
+	u32 Pos = __atomic_load_n(&Shm->Head, __ATOMIC_RELAXED);
+	volatile u32 *Seq;
+	s32 Diff;
+
+	while (Status == (u32)XST_DEVICE_BUSY) {
+		Seq = (volatile u32 *)(void *)
+			&Ring->Slots[(Pos & Ring->Mask) * Ring->Stride];
+		Diff = (s32)(__atomic_load_n(Seq, __ATOMIC_ACQUIRE) - Pos);
+		if (Diff == 0) {
+			/* Pos is reloaded with current Head on failure */
+			if (__atomic_compare_exchange_n(&Shm->Head, &Pos, Pos + 1U,
+					1, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+				Status = (u32)XST_SUCCESS;
+			}
+		} else if (Diff < 0) {
+			/* Slot still holds the element of previous lap, full */
+			goto END;
+		} else {
+			Pos = __atomic_load_n(&Shm->Head, __ATOMIC_RELAXED);
+		}
+	}
+
+	Xil_MemCpy((u8 *)(UINTPTR)Seq + XRINGBUF_SEQ_SIZE, Elt, Ring->EltSize);
+	__atomic_store_n(Seq, Pos + 1U, __ATOMIC_RELEASE);
+
+END:
+	return Status;
+}
+
+/****************************************************************************/
+/**
+*
+* @brief	MPMC pop. A slot holds the element for position Pos when its
+*           sequence equals Pos + 1, the consumer claims it by advancing Tail
+*           and frees it for the next lap by setting the sequence to
+*           Pos + Depth.
+*
+*****************************************************************************/
+static u32 Xil_RingBufPopMpmc(XRingBuf *Ring, void *Elt)
+{
+	u32 Status = (u32)XST_NO_DATA;
+	XRingBuf_Shm *Shm = Ring->Shm;
+	u32 Pos = __atomic_load_n(&Shm->Tail, __ATOMIC_RELAXED);
+	volatile u32 *Seq;
+	s32 Diff;
+
+	while (Status == (u32)XST_NO_DATA) {
+		Seq = (volatile u32 *)(void *)
+			&Ring->Slots[(Pos & Ring->Mask) * Ring->Stride];
+		Diff = (s32)(__atomic_load_n(Seq, __ATOMIC_ACQUIRE) -
+			(Pos + 1U));
+		if (Diff == 0) {
+			/* Pos is reloaded with current Tail on failure */
+			if (__atomic_compare_exchange_n(&Shm->Tail, &Pos, Pos + 1U,
+					1, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+				Status = (u32)XST_SUCCESS;
+			}
+		} else if (Diff < 0) {
+			/* Slot not yet written by producer, empty */
+			goto END;
+		} else {
+			Pos = __atomic_load_n(&Shm->Tail, __ATOMIC_RELAXED);
+		}
+	}
+
+	Xil_MemCpy(Elt, (u8 *)(UINTPTR)Seq + XRINGBUF_SEQ_SIZE, Ring->EltSize);
+	__atomic_store_n(Seq, Pos + Ring->Mask + 1U, __ATOMIC_RELEASE);
+
+END:
+	return Status;
+}
+#endif /* __GNUC__ */
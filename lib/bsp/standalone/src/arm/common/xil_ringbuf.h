@@ -0,0 +1,121 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xil_ringbuf.h
+*
+* @addtogroup arm_ringbuf_apis ARM Lock Free Ring Buffer APIs
+*
+* Bounded lock free queues of fixed size elements in shared memory for passing
+* messages between applications on different CPUs, without serializing them
+* on a lock.
+*
+* - XIL_RINGBUF_SPSC: single producer, single consumer. Producer owns the Head
+*   index and consumer owns the Tail index, no atomic read modify write is
+*   used. With XIL_RINGBUF_NONCOHERENT, the ring can be in cacheable memory
+*   which is not kept coherent by hardware between the CPUs (e.g. R5 and A53
+*   without CCI coherency), caches are maintained on every push and pop.
+* - XIL_RINGBUF_MPMC: any number of producers and consumers. Every slot
+*   carries a sequence number which tells whether it is free or holds data,
+*   producers and consumers claim slots by compare and swap on Head and Tail.
+*   Memory must be coherent between the CPUs, or non-cacheable.
+*
+* Control words written by different sides live in separate
+* XIL_SHM_CACHELINE_SIZE lines, so the producers and consumers do not bounce
+* a line between them and cache maintenance of one never discards writes of
+* the other. Layout uses only 32 bit fields and offsets, so a ring can be
+* shared between 32 and 64 bit CPUs.
+*
+* Usage:
+* - Reserve Xil_RingBufSize() bytes of shared memory, aligned to
+*   XIL_SHM_CACHELINE_SIZE.
+* - One application calls Xil_RingBufInit(), the others call
+*   Xil_RingBufAttach() with the same Id and flags till it returns
+*   XST_SUCCESS. Every application keeps its own XRingBuf handle in local
+*   memory.
+* - Use Xil_RingBufPush()/Xil_RingBufPop() to pass elements.
+*
+* @{
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -----------------------------------------------
+* 8.0   ant  10/18/26 First release
+* </pre>
+*
+******************************************************************************/
+
+#ifndef XIL_RINGBUF_H	/* prevent circular inclusions */
+#define XIL_RINGBUF_H	/* by using protection macros */
+
+/***************************** Include Files ********************************/
+#include "xil_types.h"
+#include "xstatus.h"
+#include "xil_ticketlock.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#if defined(__GNUC__)
+/************************** Constant Definitions ****************************/
+
+#define XIL_RINGBUF_MAGIC		0x46425252U /* "RRBF" */
+
+/* Ring flags */
+#define XIL_RINGBUF_SPSC		0x0U
+#define XIL_RINGBUF_MPMC		0x1U
+#define XIL_RINGBUF_NONCOHERENT		0x2U
+
+/**************************** Type Definitions ******************************/
+
+/* Ring control block at the start of the shared memory, slots follow it */
+typedef struct {
+	volatile u32 Magic;	/* XIL_RINGBUF_MAGIC once initialized */
+	volatile u32 Id;	/* User Id of the ring */
+	volatile u32 Flags;	/* XIL_RINGBUF_* flags */
+	volatile u32 Depth;	/* Number of slots, power of 2 */
+	volatile u32 EltSize;	/* Element size in bytes */
+	volatile u32 Stride;	/* Slot size in bytes */
+	u8 Pad0[XIL_SHM_CACHELINE_SIZE - 24U];
+	volatile u32 Head;	/* Free running producer index */
+	u8 Pad1[XIL_SHM_CACHELINE_SIZE - 4U];
+	volatile u32 Tail;	/* Free running consumer index */
+	u8 Pad2[XIL_SHM_CACHELINE_SIZE - 4U];
+} __attribute__ ((aligned(XIL_SHM_CACHELINE_SIZE))) XRingBuf_Shm;
+
+/* Handle in local memory of each application */
+typedef struct {
+	XRingBuf_Shm *Shm;
+	u8 *Slots;
+	u32 Flags;
+	u32 Mask;
+	u32 EltSize;
+	u32 Stride;
+	u32 HeadCache;	/* SPSC: last Head seen by consumer */
+	u32 TailCache;	/* SPSC: last Tail seen by producer */
+} XRingBuf;
+
+/************************** Function Prototypes *****************************/
+u32 Xil_RingBufSize(u32 Depth, u32 EltSize, u32 Flags);
+u32 Xil_RingBufInit(XRingBuf *Ring, void *ShmPtr, u32 Id, u32 Depth,
+		u32 EltSize, u32 Flags);
+u32 Xil_RingBufAttach(XRingBuf *Ring, void *ShmPtr, u32 Id, u32 Flags);
+u32 Xil_RingBufPush(XRingBuf *Ring, const void *Elt);
+u32 Xil_RingBufPop(XRingBuf *Ring, void *Elt);
+
+#endif /* __GNUC__ */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* XIL_RINGBUF_H */
+/**
+* @} End of "addtogroup arm_ringbuf_apis".
+*/
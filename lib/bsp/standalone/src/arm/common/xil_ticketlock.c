@@ -0,0 +1,169 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xil_ticketlock.c
+*
+* Implements fair ticket spinlocks with proportional backoff using GCC atomic
+* builtins, which generate load/store exclusive sequences with the required
+* barriers for ARMv7 and ARMv8. For more information, see xil_ticketlock.h.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -----------------------------------------------
+* 8.0   ant  10/18/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files ********************************/
+#include "xil_ticketlock.h"
+
+#if defined(__GNUC__)
+/************************** Constant Definitions ****************************/
+
+/**************************** Type Definitions ******************************/
+
+/***************** Macros (Inline Functions) Definitions ********************/
+
+/************************** Variable Definitions ****************************/
+
+/************************** Function Prototypes *****************************/
+
+/****************************************************************************/
+/**
+*
+* @brief	Initializes a lock in shared memory. Must be called by exactly
+*           one of the applications sharing the lock, before any other
+*           application attaches to it.
+*
+* @param    Lock: Lock in shared memory, aligned to XIL_SHM_CACHELINE_SIZE.
+* @param    Id: User chosen Id identifying the lock.
+*
+* @return   XST_SUCCESS if the lock is initialized.
+*           XST_INVALID_PARAM if Lock is NULL or misaligned.
+*
+*****************************************************************************/
+u32 Xil_TicketLockInit(XTicketLock *Lock, u32 Id)
+{
+	u32 Status = (u32)XST_INVALID_PARAM;
+
+	if ((Lock == NULL) ||
+		(((UINTPTR)Lock & (XIL_SHM_CACHELINE_SIZE - 1U)) != 0U)) {
+		goto END;
+	}
+
+	Lock->Next = 0U;
+	Lock->Owner = 0U;
+	Lock->Id = Id;
+	/* Publish lock only after the tickets are reset */
+	__atomic_store_n(&Lock->Magic, XIL_TICKETLOCK_MAGIC, __ATOMIC_RELEASE);
+	Status = (u32)XST_SUCCESS;
+
+END:
+	return Status;
+}
+
+/****************************************************************************/
+/**
+*
+* @brief	Checks that a lock in shared memory has been initialized with
+*           the expected Id by the application owning it.
+*
+* @param    Lock: Lock in shared memory.
+* @param    Id: Id the lock was initialized with.
+*
+* @return   XST_SUCCESS if the lock can be used.
+*           XST_FAILURE if the lock is not initialized yet or has other Id.
+*
+*****************************************************************************/
+u32 Xil_TicketLockAttach(XTicketLock *Lock, u32 Id)
+{
+	u32 Status = (u32)XST_FAILURE;
+
+	if ((Lock != NULL) &&
+		(__atomic_load_n(&Lock->Magic, __ATOMIC_ACQUIRE) ==
+			XIL_TICKETLOCK_MAGIC) && (Lock->Id == Id)) {
+		Status = (u32)XST_SUCCESS;
+	}
+
+	return Status;
+}
+
+/****************************************************************************/
+/**
+*
+* @brief	Takes the lock, waiting for the CPUs which asked for it earlier
+*           to release it first.
+*
+* @param    Lock: Initialized lock.
+*
+* @return   None.
+*
+*****************************************************************************/
+void Xil_TicketLock(XTicketLock *Lock)
+{
+	u32 Ticket;
+	u32 Owner;
+	u32 Delay;
+
+	Ticket = __atomic_fetch_add(&Lock->Next, 1U, __ATOMIC_RELAXED);
+	Owner = __atomic_load_n(&Lock->Owner, __ATOMIC_ACQUIRE);
+	while (Owner != Ticket) {
+		/* Wait about as long as the CPUs ahead keep the lock */
+		for (Delay = (Ticket - Owner) * XIL_TICKETLOCK_BACKOFF;
+			Delay > 0U; Delay--) {
+			XIL_CPU_RELAX();
+		}
+		Owner = __atomic_load_n(&Lock->Owner, __ATOMIC_ACQUIRE);
+	}
+}
+
+/****************************************************************************/
+/**
+*
+* @brief	Takes the lock only if it is free and no CPU waits for it.
+*
+* @param    Lock: Initialized lock.
+*
+* @return   XST_SUCCESS if the lock was taken.
+*           XST_DEVICE_BUSY if the lock is held.
+*
+*****************************************************************************/
+u32 Xil_TicketTryLock(XTicketLock *Lock)
+{
+	u32 Status = (u32)XST_DEVICE_BUSY;
+	u32 Owner = __atomic_load_n(&Lock->Owner, __ATOMIC_RELAXED);
+	u32 Expected = Owner;
+
+	/* Lock is free when the next ticket is the one being served */
+	if (__atomic_compare_exchange_n(&Lock->Next, &Expected, Owner + 1U,
+			0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+		Status = (u32)XST_SUCCESS;
+	}
+
+	return Status;
+}
+
+/****************************************************************************/
+/**
+*
+* @brief	Releases the lock to the CPU holding the next ticket.
+*
+* @param    Lock: Lock held by the caller.
+*
+* @return   None.
+*
+*****************************************************************************/
+void Xil_TicketUnlock(XTicketLock *Lock)
+{
+	/* Only the holder writes Owner, plain read is enough */
+	__atomic_store_n(&Lock->Owner, Lock->Owner + 1U, __ATOMIC_RELEASE);
+}
+#endif /* __GNUC__ */
@@ -0,0 +1,115 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xil_ticketlock.h
+*
+* @addtogroup arm_ticketlock_apis ARM Ticket Lock APIs
+*
+* Fair spinlocks for AMP use cases where applications on different CPUs share
+* data structures in shared memory. Unlike Xil_SpinLock, which provides one
+* global test and set lock, any number of XTicketLock instances can be placed
+* in shared memory, each identified by a user chosen 32 bit Id so that every
+* CPU attaches to the lock it expects.
+*
+* A CPU takes a ticket by atomically incrementing Next and owns the lock when
+* Owner reaches its ticket, so CPUs get the lock in the order they asked for
+* it and a CPU can not be starved by a faster neighbour. While waiting, a CPU
+* backs off proportionally to the number of CPUs ahead of it instead of
+* hammering the lock cache line.
+*
+* Usage:
+* - One application calls Xil_TicketLockInit() on the shared lock, others
+*   call Xil_TicketLockAttach() with the same Id and use the lock only after
+*   it returns XST_SUCCESS.
+* - Protect critical sections with Xil_TicketLock()/Xil_TicketUnlock(), or
+*   Xil_TicketTryLock() where blocking is not wanted.
+*
+* The lock must be in memory in which atomic (exclusive) accesses work across
+* the CPUs using it: normal cacheable memory for CPUs of the same coherent
+* cluster (e.g. the A53s), otherwise a non-cacheable shared region set up as
+* for Xil_SpinLock (e.g. R5 and A53). Each lock takes one
+* XIL_SHM_CACHELINE_SIZE line so that two locks never share a line.
+*
+* @{
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -----------------------------------------------
+* 8.0   ant  10/18/26 First release
+* </pre>
+*
+******************************************************************************/
+
+#ifndef XIL_TICKETLOCK_H	/* prevent circular inclusions */
+#define XIL_TICKETLOCK_H	/* by using protection macros */
+
+/***************************** Include Files ********************************/
+#include "xil_types.h"
+#include "xstatus.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#if defined(__GNUC__)
+/************************** Constant Definitions ****************************/
+
+/*
+ * Granule used to pad shared memory objects. Largest cache line of the
+ * processors sharing memory (A53/A72/A78), so that layout is the same for
+ * every CPU in the system.
+ */
+#define XIL_SHM_CACHELINE_SIZE	64U
+
+#define XIL_TICKETLOCK_MAGIC	0x4B434C54U /* "TLCK" */
+
+/* Relax iterations per CPU ahead in the queue while waiting for the lock */
+#ifndef XIL_TICKETLOCK_BACKOFF
+#define XIL_TICKETLOCK_BACKOFF	32U
+#endif
+
+/**************************** Type Definitions ******************************/
+
+/* Lock as laid out in shared memory, same for 32 and 64 bit CPUs */
+typedef struct {
+	volatile u32 Next;	/* Next ticket to be handed out */
+	volatile u32 Owner;	/* Ticket currently holding the lock */
+	volatile u32 Id;	/* User Id of the lock */
+	volatile u32 Magic;	/* XIL_TICKETLOCK_MAGIC once initialized */
+	u8 Pad[XIL_SHM_CACHELINE_SIZE - 16U];
+} __attribute__ ((aligned(XIL_SHM_CACHELINE_SIZE))) XTicketLock;
+
+/***************** Macros (Inline Functions) Definitions ********************/
+
+/* Hint to the CPU that it is spinning */
+#if defined(__aarch64__) || defined(__arm__)
+#define XIL_CPU_RELAX()		__asm__ __volatile__("yield" ::: "memory")
+#elif defined(__x86_64__) || defined(__i386__)
+#define XIL_CPU_RELAX()		__asm__ __volatile__("pause" ::: "memory")
+#else
+#define XIL_CPU_RELAX()		__asm__ __volatile__("" ::: "memory")
+#endif
+
+/************************** Function Prototypes *****************************/
+u32 Xil_TicketLockInit(XTicketLock *Lock, u32 Id);
+u32 Xil_TicketLockAttach(XTicketLock *Lock, u32 Id);
+void Xil_TicketLock(XTicketLock *Lock);
+u32 Xil_TicketTryLock(XTicketLock *Lock);
+void Xil_TicketUnlock(XTicketLock *Lock);
+
+#endif /* __GNUC__ */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* XIL_TICKETLOCK_H */
+/**
+* @} End of "addtogroup arm_ticketlock_apis".
+*/
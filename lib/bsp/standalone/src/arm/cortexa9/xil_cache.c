@@ -85,6 +85,12 @@
 *                     not needed for Zynq architecture.
 *                     Replace dsb with Xil_L2CacheSync as applicable as the latter
 *                     is more efficient while handling L2 cache maintenance.
+* 8.0    ant 10/18/26 Xil_DCacheFlushRange flushes the whole cache from
+*                     Xil_DCacheGetRangeThreshold() bytes on and masks
+*                     interrupts only for XIL_DCACHE_RANGE_CHUNK bytes at a
+*                     time.
+*        ant 10/18/26 The whole cache is only flushed when opted in and
+*                     called with interrupts masked.
 * </pre>
 *
 ******************************************************************************/
@@ -435,17 +441,31 @@ void Xil_DCacheFlushLine(u32 adr)
 *
 * @return	None.
 *
+* @note		Ranges of Xil_DCacheGetRangeThreshold() bytes or more are
+*		handled by flushing the whole Data cache, when called with
+*		IRQ and FIQ masked.
+*
 ****************************************************************************/
 void Xil_DCacheFlushRange(INTPTR opstartadr, u32 len)
 {
 	const u32 cacheline = 32U;
 	u32 opendadr;
+	u32 chunkend;
 	u32 currmask;
 	u32 tempadr;
 
 	volatile u32 *L2CCOffset = (volatile u32 *)(XPS_L2CC_BASEADDR +
 				    XPS_L2CC_CACHE_INV_CLN_PA_OFFSET);
 
+	/*
+	 * Fewer operations for the whole cache, taken only when the caller
+	 * already masks the interrupts the whole cache flush keeps masked
+	 */
+	if (Xil_DCacheRangeUseFlush(len) != 0U) {
+		Xil_DCacheFlush();
+		return;
+	}
+
 	currmask = mfcpsr();
 	mtcpsr(currmask | IRQ_FIQ_MASK);
 
@@ -453,33 +473,49 @@ void Xil_DCacheFlushRange(INTPTR opstartadr, u32 len)
 		opendadr = opstartadr + len;
 		opstartadr &= ~(cacheline - 1U);
 
-		tempadr = opstartadr;
-
-		while (tempadr < opendadr) {
-			/* Flush L1 Data cache line */
+		while ((u32)opstartadr < opendadr) {
+			/* Both levels are done a chunk at a time */
+			chunkend = ((u32)opstartadr + XIL_DCACHE_RANGE_CHUNK) &
+				~(XIL_DCACHE_RANGE_CHUNK - 1U);
+			if ((chunkend > opendadr) || (chunkend < (u32)opstartadr)) {
+				chunkend = opendadr;
+			}
+
+			tempadr = opstartadr;
+			while (tempadr < chunkend) {
+				/* Flush L1 Data cache line */
 #if defined (__GNUC__) || defined (__ICCARM__)
-			asm_cp15_clean_inval_dc_line_mva_poc(tempadr);
+				asm_cp15_clean_inval_dc_line_mva_poc(tempadr);
 #else
-			{ volatile register u32 Reg
-				__asm(XREG_CP15_CLEAN_INVAL_DC_LINE_MVA_POC);
-			  Reg = tempadr; }
+				{ volatile register u32 Reg
+					__asm(XREG_CP15_CLEAN_INVAL_DC_LINE_MVA_POC);
+				  Reg = tempadr; }
 #endif
-			tempadr += cacheline;
-		}
-		/* Wait for L1 cache clean and invalidation to complete */
-		dsb();
+				tempadr += cacheline;
+			}
+			/* Wait for L1 cache clean and invalidation to complete */
+			dsb();
 
 #ifndef USE_AMP
-		/* Disable Write-back and line fills */
-		Xil_L2WriteDebugCtrl(0x3U);
-		while ((u32)opstartadr < opendadr) {
-			/* Flush L2 cache line */
-			*L2CCOffset = opstartadr;
-			Xil_L2CacheSync();
-			opstartadr += cacheline;
-		}
-		Xil_L2WriteDebugCtrl(0x0U);
+			/* Disable Write-back and line fills */
+			Xil_L2WriteDebugCtrl(0x3U);
+			while ((u32)opstartadr < chunkend) {
+				/* Flush L2 cache line */
+				*L2CCOffset = opstartadr;
+				Xil_L2CacheSync();
+				opstartadr += cacheline;
+			}
+			Xil_L2WriteDebugCtrl(0x0U);
 #endif
+			opstartadr = tempadr;
+
+			if ((u32)opstartadr < opendadr) {
+				/* Take pending interrupts between chunks */
+				mtcpsr(currmask);
+				isb();
+				mtcpsr(currmask | IRQ_FIQ_MASK);
+			}
+		}
 	}
 	mtcpsr(currmask);
 }
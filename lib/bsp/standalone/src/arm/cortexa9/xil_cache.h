@@ -26,6 +26,8 @@
 * 3.04a sdm  01/02/12 Remove redundant dsb/dmb instructions in cache maintenance
 *		      APIs.
 * 6.8   aru  09/06/18 Removed compilation warnings for ARMCC toolchain.
+* 8.0   ant  10/18/26 Added XIL_DCACHE_RANGE_THRESHOLD and xil_cache_range.h
+*       ant  10/18/26 XIL_DCACHE_RANGE_THRESHOLD defaults to 0
 * </pre>
 *
 ******************************************************************************/
@@ -38,11 +40,22 @@
 #define XIL_CACHE_H
 
 #include "xil_types.h"
+#include "xil_cache_range.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/*
+ * Default size from which range flush cleans and invalidates the whole data
+ * cache instead, 0 to always flush line by line. Opt in by defining it or
+ * with Xil_DCacheSetRangeThreshold(), e.g. to 0x80000U, the size of
+ * the L2 cache.
+ */
+#ifndef XIL_DCACHE_RANGE_THRESHOLD
+#define XIL_DCACHE_RANGE_THRESHOLD	0U
+#endif
+
 #ifdef __GNUC__
 
 #define asm_cp15_inval_dc_line_mva_poc(param) __asm__ __volatile__("mcr " \
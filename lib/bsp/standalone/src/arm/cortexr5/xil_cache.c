@@ -23,6 +23,12 @@
 * 7.7	sk   01/10/22 Typecast to fix wider essential type misra_c_2012_rule_10_7
 * 		      violation.
 * 8.0   mus  02/21/22 Updated cache API's to support Cortex-R52
+* 8.0   ant  10/18/26 Xil_DCacheFlushRange flushes the whole cache from
+*                     Xil_DCacheGetRangeThreshold() bytes on and masks
+*                     interrupts only for XIL_DCACHE_RANGE_CHUNK bytes at a
+*                     time.
+*       ant  10/18/26 The whole cache is only flushed when opted in and
+*                     called with interrupts masked.
 * </pre>
 *
 ******************************************************************************/
@@ -393,6 +399,10 @@ void Xil_DCacheFlushLine(INTPTR adr)
 *
 * @return	None.
 *
+* @note		Ranges of Xil_DCacheGetRangeThreshold() bytes or more are
+*		handled by flushing the whole Data cache, when called with
+*		IRQ and FIQ masked.
+*
 ****************************************************************************/
 void Xil_DCacheFlushRange(INTPTR adr, u32 len)
 {
@@ -402,6 +412,15 @@ void Xil_DCacheFlushRange(INTPTR adr, u32 len)
 	u32 end;
 	u32 currmask;
 
+	/*
+	 * Fewer operations for the whole cache, taken only when the caller
+	 * already masks the interrupts the whole cache flush keeps masked
+	 */
+	if (Xil_DCacheRangeUseFlush(len) != 0U) {
+		Xil_DCacheFlush();
+		return;
+	}
+
 	currmask = mfcpsr();
 	mtcpsr(currmask | IRQ_FIQ_MASK);
 
@@ -417,6 +436,13 @@ void Xil_DCacheFlushRange(INTPTR adr, u32 len)
 			asm_clean_inval_dc_line_mva_poc(LocalAddr);
 
 			LocalAddr += cacheline;
+			if (((LocalAddr & (XIL_DCACHE_RANGE_CHUNK - 1U)) == 0U) &&
+				(LocalAddr < end)) {
+				/* Take pending interrupts between chunks */
+				mtcpsr(currmask);
+				isb();
+				mtcpsr(currmask | IRQ_FIQ_MASK);
+			}
 		}
 	}
 	dsb();
@@ -32,6 +32,8 @@
 * 7.50  dp       02/12/21 Fix compilation error in Xil_EndianSwap32() that occur
 *                         when -Werror=conversion compiler flag is enabled
 * 7.5   mus      05/17/21 Update the functions with comments. It fixes CR#1067739.
+* 8.0   ant      10/18/26 Route register accesses to xil_hostsim.h register
+*                         models when XIL_HOSTSIM is defined
 *
 * </pre>
 ******************************************************************************/
@@ -49,7 +51,9 @@ extern "C" {
 #include "xil_printf.h"
 #include "xstatus.h"
 
-#if defined (__MICROBLAZE__)
+#if defined (XIL_HOSTSIM)
+#include "xil_hostsim.h"
+#elif defined (__MICROBLAZE__)
 #include "mb_interface.h"
 #else
 #include "xpseudo_asm.h"
@@ -84,6 +88,7 @@ extern u32 XStl_RegUpdate(u32 RegAddr, u32 RegVal);
 #define INLINE __inline
 #endif
 
+#if !defined (XIL_HOSTSIM)
 /*****************************************************************************/
 /**
 *
@@ -235,6 +240,8 @@ static INLINE void Xil_Out64(UINTPTR Addr, u64 Value)
 	*LocalAddr = Value;
 }
 
+#endif /* !XIL_HOSTSIM */
+
 /*****************************************************************************/
 /**
  *
@@ -0,0 +1,329 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xil_log.c
+*
+* Implements the deferred logging backend. For more information, see
+* xil_log.h.
+*
+* Writers reserve record space by compare and swap on Head, fill in the
+* record and publish it by writing its header word last. The drain copies
+* a published record out, zeroes its words so that they never look like a
+* published record again, and only then advances Tail to give the space
+* back to writers.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -----------------------------------------------
+* 8.0   ant  10/18/26 First release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files ********************************/
+#include "xil_log.h"
+#include "xstatus.h"
+
+#if defined(__GNUC__)
+/************************** Constant Definitions ****************************/
+
+#define XIL_LOG_HDR_WORD(NumArgs)	(XIL_LOG_REC_MARK | \
+	((NumArgs) << XIL_LOG_REC_ARGS_SHIFT) | \
+	(XIL_LOG_REC_HDR_WORDS + (NumArgs)))
+
+/**************************** Type Definitions ******************************/
+
+/***************** Macros (Inline Functions) Definitions ********************/
+
+/************************** Function Prototypes *****************************/
+
+static void Xil_LogPrint(const char8 *Fmt, const UINTPTR *Args);
+static u32 Xil_LogTake(UINTPTR *Record);
+
+/************************** Variable Definitions ****************************/
+
+static XLogHdr *LogHdr = NULL;
+static UINTPTR *LogWords = NULL;
+static Xil_LogTimeFn LogTimeFn = NULL;
+static u32 LogDroppedSeen = 0U;
+
+/****************************************************************************/
+/**
+*
+* @brief    Initializes the log buffer. Buffer starts with XLogHdr, rest of it
+*           is used for records, rounded down to a power of 2 words.
+*
+* @param    BufPtr: Buffer aligned to UINTPTR size.
+* @param    Size: Size of the buffer in bytes.
+* @param    TimeFn: Function returning the timestamp for records, NULL to
+*           store 0.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_INVALID_PARAM if the buffer can not hold the largest
+*		  record.
+*
+*****************************************************************************/
+u32 Xil_LogInit(void *BufPtr, u32 Size, Xil_LogTimeFn TimeFn)
+{
+	u32 Status = (u32)XST_INVALID_PARAM;
+	u32 Avail;
+	u32 NumWords = 1U;
+
+	if ((BufPtr == NULL) ||
+		(((UINTPTR)BufPtr & ((UINTPTR)sizeof(UINTPTR) - 1U)) != 0U) ||
+		(Size <= (u32)sizeof(XLogHdr))) {
+		goto END;
+	}
+
+	Avail = (Size - (u32)sizeof(XLogHdr)) / (u32)sizeof(UINTPTR);
+	while ((NumWords << 1U) <= Avail) {
+		NumWords <<= 1U;
+	}
+	if (NumWords < (XIL_LOG_REC_HDR_WORDS + XIL_LOG_MAX_ARGS)) {
+		goto END;
+	}
+
+	/* Stop writers from using the old buffer while setting up */
+	LogHdr = NULL;
+	__atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+	LogWords = (UINTPTR *)(void *)((u8 *)BufPtr + sizeof(XLogHdr));
+	(void)memset(LogWords, 0, NumWords * sizeof(UINTPTR));
+	((XLogHdr *)BufPtr)->Magic = XIL_LOG_MAGIC;
+	((XLogHdr *)BufPtr)->Version = (u16)XIL_LOG_VERSION;
+	((XLogHdr *)BufPtr)->WordSize = (u8)sizeof(UINTPTR);
+	((XLogHdr *)BufPtr)->Reserved = 0U;
+	((XLogHdr *)BufPtr)->NumWords = NumWords;
+	((XLogHdr *)BufPtr)->Dropped = 0U;
+	((XLogHdr *)BufPtr)->Head = 0U;
+	((XLogHdr *)BufPtr)->Tail = 0U;
+	LogTimeFn = TimeFn;
+	LogDroppedSeen = 0U;
+	__atomic_store_n(&LogHdr, (XLogHdr *)BufPtr, __ATOMIC_RELEASE);
+	Status = (u32)XST_SUCCESS;
+
+END:
+	return Status;
+}
+
+/****************************************************************************/
+/**
+*
+* @brief    Stores a record in the log buffer. Use XIL_LOG() instead of
+*           calling this directly, it converts the arguments to UINTPTR
+*           and counts them.
+*
+* @param    Fmt: xil_printf format string.
+* @param    NumArgs: Number of UINTPTR arguments following, at most
+*           XIL_LOG_MAX_ARGS.
+*
+* @return   None.
+*
+*****************************************************************************/
+void Xil_LogWrite(const char8 *Fmt, u32 NumArgs, ...)
+{
+	XLogHdr *Hdr = __atomic_load_n(&LogHdr, __ATOMIC_ACQUIRE);
+	UINTPTR Args[XIL_LOG_MAX_ARGS] = {0U};
+	u32 Count = NumArgs;
+	u32 Len;
+	u32 Head;
+	u32 Mask;
+	u32 Index;
+	va_list Argp;
+
+	if (Count > XIL_LOG_MAX_ARGS) {
+		Count = XIL_LOG_MAX_ARGS;
+	}
+	va_start(Argp, NumArgs);
+	for (Index = 0U; Index < Count; Index++) {
+		Args[Index] = va_arg(Argp, UINTPTR);
+	}
+	va_end(Argp);
+
+	if (Hdr == NULL) {
+		Xil_LogPrint(Fmt, Args);
+		goto END;
+	}
+
+	Len = XIL_LOG_REC_HDR_WORDS + Count;
+	Mask = Hdr->NumWords - 1U;
+	Head = __atomic_load_n(&Hdr->Head, __ATOMIC_RELAXED);
+	do {
+		if ((Head + Len - __atomic_load_n(&Hdr->Tail, __ATOMIC_ACQUIRE)) >
+			Hdr->NumWords) {
+			(void)__atomic_fetch_add(&Hdr->Dropped, 1U,
+				__ATOMIC_RELAXED);
+			goto END;
+		}
+		/* Head is reloaded on failure, an interrupted writer retries */
+	} while (__atomic_compare_exchange_n(&Hdr->Head, &Head, Head + Len, 1,
+		__ATOMIC_RELAXED, __ATOMIC_RELAXED) == 0);
+
+	LogWords[(Head + 1U) & Mask] = (LogTimeFn != NULL) ? LogTimeFn() : 0U;
+	LogWords[(Head + 2U) & Mask] = (UINTPTR)Fmt;
+	for (Index = 0U; Index < Count; Index++) {
+		LogWords[(Head + XIL_LOG_REC_HDR_WORDS + Index) & Mask] =
+			Args[Index];
+	}
+	__atomic_store_n(&LogWords[Head & Mask], (UINTPTR)XIL_LOG_HDR_WORD(Count),
+		__ATOMIC_RELEASE);
+
+END:
+	return;
+}
+
+/****************************************************************************/
+/**
+*
+* @brief    Prints up to MaxRecords records from the log buffer through
+*           xil_printf. Records dropped since the previous drain are
+*           reported in a line of their own.
+*
+* @param    MaxRecords: Maximum records to print, so the caller can bound
+*           the time spent.
+*
+* @return   Number of records printed.
+*
+*****************************************************************************/
+u32 Xil_LogDrain(u32 MaxRecords)
+{
+	UINTPTR Record[XIL_LOG_REC_HDR_WORDS + XIL_LOG_MAX_ARGS];
+	u32 Dropped;
+	u32 Count = 0U;
+
+	if (LogHdr == NULL) {
+		goto END;
+	}
+
+	Dropped = LogHdr->Dropped;
+	if (Dropped != LogDroppedSeen) {
+		xil_printf("xil_log: %u records dropped\r\n",
+			Dropped - LogDroppedSeen);
+		LogDroppedSeen = Dropped;
+	}
+
+	(void)memset(Record, 0, sizeof(Record));
+	while ((Count < MaxRecords) && (Xil_LogTake(Record) != 0U)) {
+		Xil_LogPrint((const char8 *)Record[2U],
+			&Record[XIL_LOG_REC_HDR_WORDS]);
+		(void)memset(Record, 0, sizeof(Record));
+		Count++;
+	}
+
+END:
+	return Count;
+}
+
+/****************************************************************************/
+/**
+*
+* @brief    Moves whole binary records from the log buffer to DstPtr, to be
+*           sent to host and decoded by misc/xil_log. Records dropped since
+*           the previous drain are reported by a record with format string
+*           address 0 and the count as argument.
+*
+* @param    DstPtr: Buffer aligned to UINTPTR size.
+* @param    Size: Size of the buffer in bytes.
+*
+* @return   Number of bytes stored in DstPtr.
+*
+*****************************************************************************/
+u32 Xil_LogDrainRaw(void *DstPtr, u32 Size)
+{
+	UINTPTR *Dst = (UINTPTR *)DstPtr;
+	u32 Avail = Size / (u32)sizeof(UINTPTR);
+	u32 Used = 0U;
+	u32 Len;
+	u32 Dropped;
+	u32 Mask;
+	UINTPTR Word;
+
+	if ((LogHdr == NULL) || (Dst == NULL)) {
+		goto END;
+	}
+
+	Dropped = LogHdr->Dropped;
+	if ((Dropped != LogDroppedSeen) &&
+		(Avail >= (XIL_LOG_REC_HDR_WORDS + 1U))) {
+		Dst[0U] = (UINTPTR)XIL_LOG_HDR_WORD(1U);
+		Dst[1U] = 0U;
+		Dst[2U] = 0U;
+		Dst[3U] = (UINTPTR)Dropped - LogDroppedSeen;
+		Used = XIL_LOG_REC_HDR_WORDS + 1U;
+		LogDroppedSeen = Dropped;
+	}
+
+	/* Copy only records which fit entirely */
+	Mask = LogHdr->NumWords - 1U;
+	Word = __atomic_load_n(&LogWords[LogHdr->Tail & Mask], __ATOMIC_ACQUIRE);
+	Len = (u32)Word & XIL_LOG_REC_LEN_MASK;
+	while ((Word != 0U) && ((Used + Len) <= Avail) &&
+		(Xil_LogTake(&Dst[Used]) != 0U)) {
+		Used += Len;
+		Word = __atomic_load_n(&LogWords[LogHdr->Tail & Mask],
+			__ATOMIC_ACQUIRE);
+		Len = (u32)Word & XIL_LOG_REC_LEN_MASK;
+	}
+
+END:
+	return Used * (u32)sizeof(UINTPTR);
+}
+
+/****************************************************************************/
+/**
+*
+* @brief    Formats a record with xil_printf. Every argument is passed as
+*           UINTPTR, xil_printf picks int sized arguments from the low part
+*           of the argument slot on the little endian ARM and MicroBlaze
+*           ABIs.
+*
+*****************************************************************************/
+static void Xil_LogPrint(const char8 *Fmt, const UINTPTR *Args)
+{
+	xil_printf(Fmt, Args[0U], Args[1U], Args[2U], Args[3U], Args[4U],
+		Args[5U], Args[6U], Args[7U]);
+}
+
+/****************************************************************************/
+/**
+*
+* @brief    Moves the oldest published record to Record and frees its space
+*           in the log buffer.
+*
+* @param    Record: Buffer of XIL_LOG_REC_HDR_WORDS + XIL_LOG_MAX_ARGS
+*           words.
+*
+* @return   Record length in words, 0 if no published record.
+*
+*****************************************************************************/
+static u32 Xil_LogTake(UINTPTR *Record)
+{
+	u32 Tail = LogHdr->Tail;
+	u32 Mask = LogHdr->NumWords - 1U;
+	UINTPTR Word = __atomic_load_n(&LogWords[Tail & Mask], __ATOMIC_ACQUIRE);
+	u32 Len = 0U;
+	u32 Index;
+
+	if (((u32)Word & XIL_LOG_REC_MARK_MASK) != XIL_LOG_REC_MARK) {
+		goto END;
+	}
+
+	Len = (u32)Word & XIL_LOG_REC_LEN_MASK;
+	for (Index = 0U; Index < Len; Index++) {
+		Record[Index] = LogWords[(Tail + Index) & Mask];
+		LogWords[(Tail + Index) & Mask] = 0U;
+	}
+	__atomic_store_n(&LogHdr->Tail, Tail + Len, __ATOMIC_RELEASE);
+
+END:
+	return Len;
+}
+#endif /* __GNUC__ */
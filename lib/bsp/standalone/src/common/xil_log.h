@@ -0,0 +1,159 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xil_log.h
+*
+* @addtogroup common_log_apis Deferred Logging APIs
+*
+* Deferred logging backend for xil_printf style messages. XIL_LOG() does not
+* format anything, it stores the address of the format string and the raw
+* arguments into a lock free ring buffer and returns, so logging from
+* interrupt handlers and time critical loops costs a few tens of cycles
+* instead of stalling on the UART for every character.
+*
+* Records are taken out of the buffer by the application when it has time,
+* e.g. from its idle loop:
+* - Xil_LogDrain() formats the records with xil_printf.
+* - Xil_LogDrainRaw() copies the binary records to a buffer, which can be
+*   sent by a DMA driven UART or any other transport. misc/xil_log on host
+*   decodes the binary records, resolving format strings from the ELF.
+* The whole buffer can also be dumped over JTAG and decoded the same way.
+*
+* Records written while the buffer is full are dropped and counted, never
+* overwriting records not yet drained. Until Xil_LogInit() is called,
+* XIL_LOG() prints synchronously through xil_printf.
+*
+* Each application (and so each core) has its own buffer. Writers may
+* interrupt each other, the drain must be done from one context only.
+*
+* @{
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -----------------------------------------------
+* 8.0   ant  10/18/26 First release
+* </pre>
+*
+* @note
+*
+* Format strings and %s arguments are stored as addresses, so they must be
+* constant strings which remain valid till the record is drained. Like
+* xil_printf, floating point arguments are not supported.
+*
+******************************************************************************/
+
+#ifndef XIL_LOG_H	/* prevent circular inclusions */
+#define XIL_LOG_H	/* by using protection macros */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files ********************************/
+#include "xil_types.h"
+#include "xil_printf.h"
+
+/************************** Constant Definitions ****************************/
+
+#define XIL_LOG_MAGIC		0x474F4C58U /* "XLOG" */
+#define XIL_LOG_VERSION		1U
+#define XIL_LOG_MAX_ARGS	8U
+
+/*
+ * First word of a record: XIL_LOG_REC_MARK, number of arguments and record
+ * length in words. It is written last, a zero word means no record.
+ */
+#define XIL_LOG_REC_MARK	0xA5000000U
+#define XIL_LOG_REC_MARK_MASK	0xFF000000U
+#define XIL_LOG_REC_ARGS_SHIFT	16U
+#define XIL_LOG_REC_ARGS_MASK	0x00FF0000U
+#define XIL_LOG_REC_LEN_MASK	0x0000FFFFU
+/* Record header, timestamp and format string words precede arguments */
+#define XIL_LOG_REC_HDR_WORDS	3U
+
+/**************************** Type Definitions ******************************/
+
+/* Returns the timestamp stored in every record */
+typedef UINTPTR (*Xil_LogTimeFn)(void);
+
+/*
+ * Header at the start of the log buffer, followed by NumWords UINTPTR sized
+ * words of records. Head and Tail are free running word indices.
+ */
+typedef struct {
+	u32 Magic;		/* XIL_LOG_MAGIC */
+	u16 Version;		/* XIL_LOG_VERSION */
+	u8 WordSize;		/* sizeof(UINTPTR) */
+	u8 Reserved;
+	u32 NumWords;		/* Record area size in words, power of 2 */
+	volatile u32 Dropped;	/* Records dropped as buffer was full */
+	volatile u32 Head;	/* Next word to be reserved by writers */
+	volatile u32 Tail;	/* Next word to be drained */
+	u32 Reserved1[2U];
+} XLogHdr;
+
+/***************** Macros (Inline Functions) Definitions ********************/
+
+/**
+ * @cond nocomments
+ */
+#define XIL_LOG0(Fmt)	Xil_LogWrite((Fmt), 0U)
+#define XIL_LOG1(Fmt, A1)	Xil_LogWrite((Fmt), 1U, (UINTPTR)(A1))
+#define XIL_LOG2(Fmt, A1, A2)	Xil_LogWrite((Fmt), 2U, (UINTPTR)(A1), \
+	(UINTPTR)(A2))
+#define XIL_LOG3(Fmt, A1, A2, A3)	Xil_LogWrite((Fmt), 3U, \
+	(UINTPTR)(A1), (UINTPTR)(A2), (UINTPTR)(A3))
+#define XIL_LOG4(Fmt, A1, A2, A3, A4)	Xil_LogWrite((Fmt), 4U, \
+	(UINTPTR)(A1), (UINTPTR)(A2), (UINTPTR)(A3), (UINTPTR)(A4))
+#define XIL_LOG5(Fmt, A1, A2, A3, A4, A5)	Xil_LogWrite((Fmt), 5U, \
+	(UINTPTR)(A1), (UINTPTR)(A2), (UINTPTR)(A3), (UINTPTR)(A4), \
+	(UINTPTR)(A5))
+#define XIL_LOG6(Fmt, A1, A2, A3, A4, A5, A6)	Xil_LogWrite((Fmt), 6U, \
+	(UINTPTR)(A1), (UINTPTR)(A2), (UINTPTR)(A3), (UINTPTR)(A4), \
+	(UINTPTR)(A5), (UINTPTR)(A6))
+#define XIL_LOG7(Fmt, A1, A2, A3, A4, A5, A6, A7)	Xil_LogWrite((Fmt), \
+	7U, (UINTPTR)(A1), (UINTPTR)(A2), (UINTPTR)(A3), (UINTPTR)(A4), \
+	(UINTPTR)(A5), (UINTPTR)(A6), (UINTPTR)(A7))
+#define XIL_LOG8(Fmt, A1, A2, A3, A4, A5, A6, A7, A8)	Xil_LogWrite((Fmt), \
+	8U, (UINTPTR)(A1), (UINTPTR)(A2), (UINTPTR)(A3), (UINTPTR)(A4), \
+	(UINTPTR)(A5), (UINTPTR)(A6), (UINTPTR)(A7), (UINTPTR)(A8))
+#define XIL_LOG_SEL(A0, A1, A2, A3, A4, A5, A6, A7, A8, Name, ...)	Name
+/**
+ * @endcond
+ */
+
+/**
+ * Logs a message with xil_printf format and up to XIL_LOG_MAX_ARGS integer
+ * or pointer arguments. Every argument is converted to UINTPTR at the call
+ * site, so the record holds the raw values.
+ */
+#if defined(__GNUC__)
+#define XIL_LOG(...)	XIL_LOG_SEL(__VA_ARGS__, XIL_LOG8, XIL_LOG7, \
+	XIL_LOG6, XIL_LOG5, XIL_LOG4, XIL_LOG3, XIL_LOG2, XIL_LOG1, \
+	XIL_LOG0, 0)(__VA_ARGS__)
+#else
+/* Atomics needed by the buffer are not available, print synchronously */
+#define XIL_LOG		xil_printf
+#endif
+
+/************************** Function Prototypes *****************************/
+
+u32 Xil_LogInit(void *BufPtr, u32 Size, Xil_LogTimeFn TimeFn);
+void Xil_LogWrite(const char8 *Fmt, u32 NumArgs, ...);
+u32 Xil_LogDrain(u32 MaxRecords);
+u32 Xil_LogDrainRaw(void *DstPtr, u32 Size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XIL_LOG_H */
+/**
+* @} End of "addtogroup common_log_apis".
+*/
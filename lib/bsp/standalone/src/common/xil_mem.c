@@ -8,8 +8,12 @@
 /**
 * @file xil_mem.c
 *
-* This file contains xil mem copy function to use in case of word aligned
-* data copies.
+* This file contains xil mem copy and set functions. Bulk of the data is
+* moved in blocks using LDP/STP on 64 bit ARM, LDM/STM on 32 bit ARM and
+* unrolled word loops on other processors, once the destination is word
+* aligned. When the source is not word aligned then, 64 bit ARM loads it
+* unaligned and other processors merge aligned source words with shifts.
+* Remaining head and tail bytes are copied bytewise.
 *
 * <pre>
 * MODIFICATION HISTORY:
@@ -22,6 +26,10 @@
 * 			  violations.
 * 7.7	sk	 01/10/22 Include xil_mem.h header file to fix Xil_MemCpy
 * 			  prototype misra_c_2012_rule_8_4 violation.
+* 8.0   ant      10/18/26 Copy in blocks with alignment fix up of head and
+* 			  tail bytes and added Xil_MemSet.
+*       ant      10/18/26 Copy in words and blocks also when source and
+* 			  destination differ in word alignment.
 *
 * </pre>
 *
@@ -32,7 +40,210 @@
 #include "xil_types.h"
 #include "xil_mem.h"
 
+/************************** Constant Definitions ****************************/
+
+#define XIL_MEM_WORD_MASK	(sizeof(u32) - 1U) /**< Word alignment mask */
+#define XIL_MEM_BLOCK_SIZE	(32U) /**< Bytes moved per block iteration */
+
+/*
+ * Merges the bytes of two consecutive aligned source words, Lo at the lower
+ * address, starting Rsh / 8 bytes into Lo. Lsh is 32 - Rsh.
+ */
+#if defined (__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+#define XIL_MEM_MERGE(Lo, Hi, Rsh, Lsh)	(((Lo) << (Rsh)) | ((Hi) >> (Lsh)))
+#else
+#define XIL_MEM_MERGE(Lo, Hi, Rsh, Lsh)	(((Lo) >> (Rsh)) | ((Hi) << (Lsh)))
+#endif
+
 /***************** Inline Functions Definitions ********************/
+/*****************************************************************************/
+/**
+* @brief       This function copies given number of 32 byte blocks. Both
+*              source and destination must be word aligned, except on 64 bit
+*              ARM where the source may be unaligned.
+*
+* @param       d: pointer pointing to destination memory
+*
+* @param       s: pointer pointing to source memory
+*
+* @param       Blocks: number of blocks to be copied, must be non zero
+*
+*****************************************************************************/
+static inline void Xil_MemCpyBlocks(u8 *d, const u8 *s, u32 Blocks)
+{
+#if defined (__aarch64__)
+	/*
+	 * 32 bit register pairs keep word alignment sufficient and the bus
+	 * access width same as word copies. LDP from an unaligned source is
+	 * legal on normal memory, as the BSP leaves alignment checks disabled.
+	 */
+	__asm__ __volatile__(
+		"1:\n"
+		"ldp	w3, w4, [%1], #8\n"
+		"ldp	w5, w6, [%1], #8\n"
+		"ldp	w7, w8, [%1], #8\n"
+		"ldp	w9, w10, [%1], #8\n"
+		"stp	w3, w4, [%0], #8\n"
+		"stp	w5, w6, [%0], #8\n"
+		"stp	w7, w8, [%0], #8\n"
+		"stp	w9, w10, [%0], #8\n"
+		"subs	%w2, %w2, #1\n"
+		"b.ne	1b\n"
+		: "+r" (d), "+r" (s), "+r" (Blocks)
+		:
+		: "x3", "x4", "x5", "x6", "x7", "x8", "x9", "x10",
+		  "cc", "memory");
+#elif defined (__arm__) && defined (__GNUC__)
+	__asm__ __volatile__(
+		"1:\n"
+		"ldmia	%1!, {r3, r4, r5, r6}\n"
+		"stmia	%0!, {r3, r4, r5, r6}\n"
+		"ldmia	%1!, {r3, r4, r5, r6}\n"
+		"stmia	%0!, {r3, r4, r5, r6}\n"
+		"subs	%2, %2, #1\n"
+		"bne	1b\n"
+		: "+r" (d), "+r" (s), "+r" (Blocks)
+		:
+		: "r3", "r4", "r5", "r6", "cc", "memory");
+#else
+	u32 *d32 = (u32 *)(void *)d;
+	const u32 *s32 = (const u32 *)(const void *)s;
+	u32 W0, W1, W2, W3, W4, W5, W6, W7;
+
+	/* Loads are grouped ahead of stores to hide the load latency */
+	while (Blocks > 0U) {
+		W0 = s32[0U];
+		W1 = s32[1U];
+		W2 = s32[2U];
+		W3 = s32[3U];
+		W4 = s32[4U];
+		W5 = s32[5U];
+		W6 = s32[6U];
+		W7 = s32[7U];
+		d32[0U] = W0;
+		d32[1U] = W1;
+		d32[2U] = W2;
+		d32[3U] = W3;
+		d32[4U] = W4;
+		d32[5U] = W5;
+		d32[6U] = W6;
+		d32[7U] = W7;
+		d32 += 8U;
+		s32 += 8U;
+		Blocks--;
+	}
+#endif
+}
+
+#if !defined (__aarch64__)
+/*****************************************************************************/
+/**
+* @brief       This function copies given number of words from a source which
+*              is not word aligned to a word aligned destination. Only
+*              aligned words are read from the source, and the words read
+*              never extend past the word holding the last byte copied.
+*
+* @param       d: pointer pointing to word aligned destination memory
+*
+* @param       s: pointer pointing to source memory, not word aligned
+*
+* @param       Words: number of words to be copied, must be non zero
+*
+*****************************************************************************/
+static inline void Xil_MemCpyMerge(u8 *d, const u8 *s, u32 Words)
+{
+	u32 *d32 = (u32 *)(void *)d;
+	const u32 *s32 = (const u32 *)(const void *)((UINTPTR)s &
+				~(UINTPTR)XIL_MEM_WORD_MASK);
+	u32 Rsh = (u32)((UINTPTR)s & XIL_MEM_WORD_MASK) * 8U;
+	u32 Lsh = 32U - Rsh;
+	u32 W0 = s32[0U];
+	u32 W1, W2, W3, W4;
+
+	while (Words >= 4U) {
+		W1 = s32[1U];
+		W2 = s32[2U];
+		W3 = s32[3U];
+		W4 = s32[4U];
+		d32[0U] = XIL_MEM_MERGE(W0, W1, Rsh, Lsh);
+		d32[1U] = XIL_MEM_MERGE(W1, W2, Rsh, Lsh);
+		d32[2U] = XIL_MEM_MERGE(W2, W3, Rsh, Lsh);
+		d32[3U] = XIL_MEM_MERGE(W3, W4, Rsh, Lsh);
+		W0 = W4;
+		d32 += 4U;
+		s32 += 4U;
+		Words -= 4U;
+	}
+
+	while (Words > 0U) {
+		W1 = s32[1U];
+		d32[0U] = XIL_MEM_MERGE(W0, W1, Rsh, Lsh);
+		W0 = W1;
+		d32 += 1U;
+		s32 += 1U;
+		Words -= 1U;
+	}
+}
+#endif
+
+/*****************************************************************************/
+/**
+* @brief       This function fills given number of 32 byte blocks with the
+*              word pattern. Destination must be word aligned.
+*
+* @param       d: pointer pointing to destination memory
+*
+* @param       Pattern: 32 bit pattern to be written
+*
+* @param       Blocks: number of blocks to be filled, must be non zero
+*
+*****************************************************************************/
+static inline void Xil_MemSetBlocks(u8 *d, u32 Pattern, u32 Blocks)
+{
+#if defined (__aarch64__)
+	__asm__ __volatile__(
+		"1:\n"
+		"stp	%w2, %w2, [%0], #8\n"
+		"stp	%w2, %w2, [%0], #8\n"
+		"stp	%w2, %w2, [%0], #8\n"
+		"stp	%w2, %w2, [%0], #8\n"
+		"subs	%w1, %w1, #1\n"
+		"b.ne	1b\n"
+		: "+r" (d), "+r" (Blocks)
+		: "r" (Pattern)
+		: "cc", "memory");
+#elif defined (__arm__) && defined (__GNUC__)
+	__asm__ __volatile__(
+		"mov	r3, %2\n"
+		"mov	r4, %2\n"
+		"mov	r5, %2\n"
+		"mov	r6, %2\n"
+		"1:\n"
+		"stmia	%0!, {r3, r4, r5, r6}\n"
+		"stmia	%0!, {r3, r4, r5, r6}\n"
+		"subs	%1, %1, #1\n"
+		"bne	1b\n"
+		: "+r" (d), "+r" (Blocks)
+		: "r" (Pattern)
+		: "r3", "r4", "r5", "r6", "cc", "memory");
+#else
+	u32 *d32 = (u32 *)(void *)d;
+
+	while (Blocks > 0U) {
+		d32[0U] = Pattern;
+		d32[1U] = Pattern;
+		d32[2U] = Pattern;
+		d32[3U] = Pattern;
+		d32[4U] = Pattern;
+		d32[5U] = Pattern;
+		d32[6U] = Pattern;
+		d32[7U] = Pattern;
+		d32 += 8U;
+		Blocks--;
+	}
+#endif
+}
+
 /*****************************************************************************/
 /**
 * @brief       This  function copies memory from once location to other.
@@ -43,24 +254,57 @@
 *
 * @param       cnt: 32 bit length of bytes to be copied
 *
+* @note        Bytes are copied till the destination is word aligned. When
+*              the source is then not word aligned, 64 bit ARM copies it
+*              with unaligned loads, and other processors read only aligned
+*              source words and merge them with shifts.
+*
 *****************************************************************************/
 void Xil_MemCpy(void* dst, const void* src, u32 cnt)
 {
-	char *d = (char*)(void *)dst;
-	const char *s = src;
-
-	while (cnt >= sizeof (s32)) {
-		*(s32*)d = *(s32*)s;
-		d += sizeof (s32);
-		s += sizeof (s32);
-		cnt -= sizeof (s32);
+	u8 *d = (u8 *)dst;
+	const u8 *s = (const u8 *)src;
+	u32 Blocks;
+#if !defined (__aarch64__)
+	u32 Words;
+#endif
+
+	/* Copy head bytes till the destination is word aligned */
+	while ((cnt > 0U) && (((UINTPTR)d & XIL_MEM_WORD_MASK) != 0U)) {
+		*d = *s;
+		d += 1U;
+		s += 1U;
+		cnt -= 1U;
 	}
-	while (cnt >= sizeof (u16)) {
-		*(u16*)d = *(u16*)s;
-		d += sizeof (u16);
-		s += sizeof (u16);
-		cnt -= sizeof (u16);
+
+#if !defined (__aarch64__)
+	if (((UINTPTR)s & XIL_MEM_WORD_MASK) != 0U) {
+		Words = cnt / sizeof (u32);
+		if (Words > 0U) {
+			Xil_MemCpyMerge(d, s, Words);
+			d += Words * sizeof (u32);
+			s += Words * sizeof (u32);
+			cnt -= Words * sizeof (u32);
+		}
+	} else
+#endif
+	{
+		Blocks = cnt / XIL_MEM_BLOCK_SIZE;
+		if (Blocks > 0U) {
+			Xil_MemCpyBlocks(d, s, Blocks);
+			d += Blocks * XIL_MEM_BLOCK_SIZE;
+			s += Blocks * XIL_MEM_BLOCK_SIZE;
+			cnt -= Blocks * XIL_MEM_BLOCK_SIZE;
+		}
+
+		while (cnt >= sizeof (u32)) {
+			*(u32 *)(void *)d = *(const u32 *)(const void *)s;
+			d += sizeof (u32);
+			s += sizeof (u32);
+			cnt -= sizeof (u32);
+		}
 	}
+
 	while ((cnt) > 0U){
 		*d = *s;
 		d += 1U;
@@ -68,3 +312,48 @@ void Xil_MemCpy(void* dst, const void* src, u32 cnt)
 		cnt -= 1U;
 	}
 }
+
+/*****************************************************************************/
+/**
+* @brief       This  function fills memory with the given byte value.
+*
+* @param       dst: pointer pointing to destination memory
+*
+* @param       val: byte value to be written, only LSB 8 bits are used
+*
+* @param       cnt: 32 bit length of bytes to be filled
+*
+*****************************************************************************/
+void Xil_MemSet(void* dst, s32 val, u32 cnt)
+{
+	u8 *d = (u8 *)dst;
+	u8 Byte = (u8)val;
+	u32 Pattern = (u32)Byte * 0x01010101U;
+	u32 Blocks;
+
+	/* Fill head bytes till the destination is word aligned */
+	while ((cnt > 0U) && (((UINTPTR)d & XIL_MEM_WORD_MASK) != 0U)) {
+		*d = Byte;
+		d += 1U;
+		cnt -= 1U;
+	}
+
+	Blocks = cnt / XIL_MEM_BLOCK_SIZE;
+	if (Blocks > 0U) {
+		Xil_MemSetBlocks(d, Pattern, Blocks);
+		d += Blocks * XIL_MEM_BLOCK_SIZE;
+		cnt -= Blocks * XIL_MEM_BLOCK_SIZE;
+	}
+
+	while (cnt >= sizeof (u32)) {
+		*(u32 *)(void *)d = Pattern;
+		d += sizeof (u32);
+		cnt -= sizeof (u32);
+	}
+
+	while (cnt > 0U) {
+		*d = Byte;
+		d += 1U;
+		cnt -= 1U;
+	}
+}
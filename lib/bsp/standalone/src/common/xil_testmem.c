@@ -34,6 +34,9 @@
 * 		      21_2 violation.
 * 7.7	sk   01/10/22 Remove arithematic operations on pointer varaible to fix
 * 		      misra_c_2012_rule_18_4 violation.
+* 8.0   ant  10/18/26 Added Xil_TestMem64, which tests full range or every
+*                     Nth word with 64 bit accesses, counts all errors and
+*                     reports bytes transferred.
 * </pre>
 *
 *****************************************************************************/
@@ -44,9 +47,29 @@
 #include "xil_assert.h"
 
 /************************** Constant Definitions ****************************/
+#define XIL_TESTMEM64_DEF_PATTERN	0xDEADBEEF5AA5C33CULL
+#define XIL_TESTMEM64_WALK_WORDS	64U
+#define XIL_TESTMEM64_UNROLL		4U
+
+/*
+ * Keeps the compiler from forwarding values of the fill loop to the check
+ * loop, so every word is read back from memory.
+ */
+#if defined(__GNUC__)
+#define XIL_TESTMEM_BARRIER()	__asm__ __volatile__("" ::: "memory")
+#else
+#define XIL_TESTMEM_BARRIER()
+#endif
+
 /************************** Function Prototypes *****************************/
 
 static u32 RotateLeft(u32 Input, u8 Width);
+#if !(defined(__MICROBLAZE__) && !defined(__arch64__) && (XPAR_MICROBLAZE_ADDR_SIZE > 32))
+static void Xil_TestMem64Fill(u64 *Addr, UINTPTR Count, u32 Stride, u64 Start,
+			      u64 Step);
+static void Xil_TestMem64Check(u64 *Addr, UINTPTR Count, u32 Stride, u64 Start,
+			       u64 Step, XTestMem_Result *Result);
+#endif
 
 /* define ROTATE_RIGHT to give access to this functionality */
 #ifdef ROTATE_RIGHT
@@ -1475,6 +1498,233 @@ s32 Xil_TestMem8(u8 *Addr, u32 Words, u8 Pattern, u8 Subtest)
 End_Label:
 	return Status;
 }
+
+/*****************************************************************************/
+/**
+*
+* @brief    Perform a destructive 64-bit wide memory test. Unlike the narrow
+*           tests, it does not stop at the first error, it counts all the
+*           mismatching words and records the first one, so one pass screens
+*           the whole range. Fill and check loops are unrolled for the
+*           compiler to issue paired 64 bit accesses.
+*
+* @param    Addr: pointer to the region of memory to be tested, 8 byte
+*           aligned.
+* @param    Words: length of the block in 64 bit words.
+* @param    Stride: 1 tests every word, N tests every Nth word for a quick
+*           sparse screening of large memories.
+* @param    Pattern: constant used for the constant pattern test, if 0,
+*           0xDEADBEEF5AA5C33C is used.
+* @param    Subtest: test type selected. See xil_testmem.h for possible
+*	        values. The walking ones and zeros tests always use the first
+*	        64 consecutive words to test the data bus.
+* @param    Result: filled with number of errors, first failure and bytes
+*           written and read, which gives bandwidth when the caller times
+*           the test.
+*
+* @return
+*           - 0 is returned for a pass
+*           - -1 is returned for a failure
+*
+*****************************************************************************/
+s32 Xil_TestMem64(u64 *Addr, UINTPTR Words, u32 Stride, u64 Pattern,
+		  u8 Subtest, XTestMem_Result *Result)
+{
+	UINTPTR Count;
+	UINTPTR WalkWords;
+	UINTPTR i;
+	u32 j;
+	u64 Val;
+
+	Xil_AssertNonvoid(Addr != NULL);
+	Xil_AssertNonvoid(Words != (UINTPTR)0);
+	Xil_AssertNonvoid(Stride != (u32)0);
+	Xil_AssertNonvoid(Subtest <= (u8)XIL_TESTMEM_MAXTEST);
+	Xil_AssertNonvoid(Result != NULL);
+
+	Result->Errors = 0U;
+	Result->FailAddr = 0U;
+	Result->Expected = 0U;
+	Result->Actual = 0U;
+	Result->Bytes = 0U;
+
+	Count = ((Words - (UINTPTR)1) / Stride) + (UINTPTR)1;
+	WalkWords = (Words < (UINTPTR)XIL_TESTMEM64_WALK_WORDS) ? Words :
+		    (UINTPTR)XIL_TESTMEM64_WALK_WORDS;
+
+	if ((Subtest == XIL_TESTMEM_ALLMEMTESTS) || (Subtest == XIL_TESTMEM_INCREMENT)) {
+		Xil_TestMem64Fill(Addr, Count, Stride, XIL_TESTMEM_INIT_VALUE, 1U);
+		Xil_TestMem64Check(Addr, Count, Stride, XIL_TESTMEM_INIT_VALUE, 1U,
+				   Result);
+	}
+
+	if ((Subtest == XIL_TESTMEM_ALLMEMTESTS) || (Subtest == XIL_TESTMEM_WALKONES)) {
+		/*
+		 * Walking one moves by one bit every word, so word i holds bit
+		 * i + j; cycling j through all bits tests every data bit in
+		 * every location.
+		 */
+		for (j = 0U; j < (u32)XIL_TESTMEM64_WALK_WORDS; j++) {
+			for (i = 0U; i < WalkWords; i++) {
+				Addr[i] = (u64)1U << ((i + j) & 63U);
+			}
+			XIL_TESTMEM_BARRIER();
+			for (i = 0U; i < WalkWords; i++) {
+				Val = (u64)1U << ((i + j) & 63U);
+				if (Addr[i] != Val) {
+					if (Result->Errors == 0U) {
+						Result->FailAddr = (UINTPTR)&Addr[i];
+						Result->Expected = Val;
+						Result->Actual = Addr[i];
+					}
+					Result->Errors++;
+				}
+			}
+			Result->Bytes += (u64)WalkWords * 16U;
+		}
+	}
+
+	if ((Subtest == XIL_TESTMEM_ALLMEMTESTS) || (Subtest == XIL_TESTMEM_WALKZEROS)) {
+		for (j = 0U; j < (u32)XIL_TESTMEM64_WALK_WORDS; j++) {
+			for (i = 0U; i < WalkWords; i++) {
+				Addr[i] = ~((u64)1U << ((i + j) & 63U));
+			}
+			XIL_TESTMEM_BARRIER();
+			for (i = 0U; i < WalkWords; i++) {
+				Val = ~((u64)1U << ((i + j) & 63U));
+				if (Addr[i] != Val) {
+					if (Result->Errors == 0U) {
+						Result->FailAddr = (UINTPTR)&Addr[i];
+						Result->Expected = Val;
+						Result->Actual = Addr[i];
+					}
+					Result->Errors++;
+				}
+			}
+			Result->Bytes += (u64)WalkWords * 16U;
+		}
+	}
+
+	if ((Subtest == XIL_TESTMEM_ALLMEMTESTS) || (Subtest == XIL_TESTMEM_INVERSEADDR)) {
+		/*
+		 * Inverse of address decreases by the distance between tested
+		 * words, which makes it an arithmetic progression like the
+		 * other patterns
+		 */
+		Val = ~(u64)(UINTPTR)Addr;
+		Xil_TestMem64Fill(Addr, Count, Stride, Val,
+				  (u64)0U - ((u64)Stride * 8U));
+		Xil_TestMem64Check(Addr, Count, Stride, Val,
+				   (u64)0U - ((u64)Stride * 8U), Result);
+	}
+
+	if ((Subtest == XIL_TESTMEM_ALLMEMTESTS) || (Subtest == XIL_TESTMEM_FIXEDPATTERN)) {
+		Val = (Pattern == 0U) ? XIL_TESTMEM64_DEF_PATTERN : Pattern;
+		Xil_TestMem64Fill(Addr, Count, Stride, Val, 0U);
+		Xil_TestMem64Check(Addr, Count, Stride, Val, 0U, Result);
+	}
+
+	return (Result->Errors == 0U) ? 0 : -1;
+}
+
+/*****************************************************************************/
+/**
+*
+* @brief    Writes Start + k * Step to the kth tested word.
+*
+* @param    Addr: first word.
+* @param    Count: number of words to be written.
+* @param    Stride: distance between written words, in words.
+* @param    Start: value of the first word.
+* @param    Step: increment between values of consecutive written words.
+*
+* @return   None.
+*
+*****************************************************************************/
+static void Xil_TestMem64Fill(u64 *Addr, UINTPTR Count, u32 Stride, u64 Start,
+			      u64 Step)
+{
+	UINTPTR i = 0U;
+	UINTPTR Offset = 0U;
+	u64 Val = Start;
+
+	for (; (i + XIL_TESTMEM64_UNROLL) <= Count; i += XIL_TESTMEM64_UNROLL) {
+		Addr[Offset] = Val;
+		Addr[Offset + Stride] = Val + Step;
+		Addr[Offset + (2U * Stride)] = Val + (2U * Step);
+		Addr[Offset + (3U * Stride)] = Val + (3U * Step);
+		Val += XIL_TESTMEM64_UNROLL * Step;
+		Offset += (UINTPTR)XIL_TESTMEM64_UNROLL * Stride;
+	}
+	for (; i < Count; i++) {
+		Addr[Offset] = Val;
+		Val += Step;
+		Offset += Stride;
+	}
+	XIL_TESTMEM_BARRIER();
+}
+
+/*****************************************************************************/
+/**
+*
+* @brief    Checks the words written by Xil_TestMem64Fill. Groups of words
+*           are compared together and only a mismatching group is looked
+*           at word by word, to keep the common case fast.
+*
+* @param    Addr: first word.
+* @param    Count: number of words to be checked.
+* @param    Stride: distance between checked words, in words.
+* @param    Start: expected value of the first word.
+* @param    Step: increment between expected values of consecutive words.
+* @param    Result: errors and first failure are updated.
+*
+* @return   None.
+*
+*****************************************************************************/
+static void Xil_TestMem64Check(u64 *Addr, UINTPTR Count, u32 Stride, u64 Start,
+			       u64 Step, XTestMem_Result *Result)
+{
+	UINTPTR i = 0U;
+	UINTPTR Offset = 0U;
+	UINTPTR Group;
+	UINTPTR j;
+	u64 Val = Start;
+	u64 Diff = 1U;
+	u64 Actual;
+
+	while (i < Count) {
+		Group = Count - i;
+		if (Group >= (UINTPTR)XIL_TESTMEM64_UNROLL) {
+			Group = XIL_TESTMEM64_UNROLL;
+			Diff = (Addr[Offset] ^ Val) |
+			       (Addr[Offset + Stride] ^ (Val + Step)) |
+			       (Addr[Offset + (2U * Stride)] ^ (Val + (2U * Step))) |
+			       (Addr[Offset + (3U * Stride)] ^ (Val + (3U * Step)));
+		}
+
+		if (Diff == 0U) {
+			Val += XIL_TESTMEM64_UNROLL * Step;
+			Offset += (UINTPTR)XIL_TESTMEM64_UNROLL * Stride;
+		} else {
+			for (j = 0U; j < Group; j++) {
+				Actual = Addr[Offset];
+				if (Actual != Val) {
+					if (Result->Errors == 0U) {
+						Result->FailAddr = (UINTPTR)&Addr[Offset];
+						Result->Expected = Val;
+						Result->Actual = Actual;
+					}
+					Result->Errors++;
+				}
+				Val += Step;
+				Offset += Stride;
+			}
+		}
+		i += Group;
+		Diff = 1U;
+	}
+	Result->Bytes += (u64)Count * 16U;
+}
 #endif
 
 /*****************************************************************************/
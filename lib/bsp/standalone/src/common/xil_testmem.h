@@ -86,6 +86,8 @@
 *                     compiled only for 32 bit Microblaze processor, if
 *                     XPAR_MICROBLAZE_ADDR_SIZE is greater than 32.
 *                     It fixes CR#1089129.
+* 8.0   ant  10/18/26 Added Xil_TestMem64 with stride and error statistics
+*                     for fast screening of large memories.
 * </pre>
 *
 ******************************************************************************/
@@ -129,6 +131,18 @@ extern "C" {
 #define XIL_TESTMEM_MAXTEST         XIL_TESTMEM_FIXEDPATTERN
 /* @} */
 
+/**
+ * Result of Xil_TestMem64. Bytes counts both writes and reads, so dividing
+ * it by the test time gives the bandwidth achieved.
+ */
+typedef struct {
+	u64 Errors;		/**< Number of mismatching 64 bit words */
+	UINTPTR FailAddr;	/**< Address of the first mismatching word */
+	u64 Expected;		/**< Value expected at FailAddr */
+	u64 Actual;		/**< Value read from FailAddr */
+	u64 Bytes;		/**< Bytes written and read */
+} XTestMem_Result;
+
 #if !defined(__aarch64__) && !defined(__arch64__)
 #define	NUM_OF_BITS_IN_BYTE	8U
 #define	NUM_OF_BYTES_IN_HW	2U
@@ -153,6 +167,8 @@ extern s32 Xil_TestMem8(u32 AddrLow, u32 AddrHigh, u32 Words, u8 Pattern, u8 Sub
 extern s32 Xil_TestMem32(u32 *Addr, u32 Words, u32 Pattern, u8 Subtest);
 extern s32 Xil_TestMem16(u16 *Addr, u32 Words, u16 Pattern, u8 Subtest);
 extern s32 Xil_TestMem8(u8 *Addr, u32 Words, u8 Pattern, u8 Subtest);
+extern s32 Xil_TestMem64(u64 *Addr, UINTPTR Words, u32 Stride, u64 Pattern,
+			 u8 Subtest, XTestMem_Result *Result);
 #endif
 
 #ifdef __cplusplus
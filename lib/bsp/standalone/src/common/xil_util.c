@@ -79,6 +79,10 @@
 *       adk	 07/15/22 Updated the Xil_WaitForEventSet() API to
 *			  support variable number of events.
 *	ssc	 08/25/22 Added Xil_SecureRMW32 API
+*       ant      10/18/26 Use Xil_MemCpy in Xil_SecureMemCpy
+*       ant      10/18/26 Wait for events with the spin then sleep policy of
+*                         xil_wait.c instead of polling every microsecond
+*       ant      10/18/26 Keep the Timeout 0 behaviour of the event waits
 *
 * </pre>
 *
@@ -86,13 +90,29 @@
 
 /****************************** Include Files *********************************/
 #include "xil_util.h"
-#include "sleep.h"
+#include "xil_mem.h"
+#include "xil_wait.h"
 
 /************************** Constant Definitions ****************************/
 #define MAX_NIBBLES			8U
+#define MASK_ALL_BITS			0xFFFFFFFFU
+/* Timeout used by Xil_WaitForEvents() when called with a Timeout of 0 */
+#define WAIT_FOREVER_US			0xFFFFFFFFU
+
+/**************************** Type Definitions ******************************/
+
+/* Condition of Xil_WaitForEvents() and Xil_WaitForEventSet() */
+typedef struct {
+	UINTPTR Addr;
+	u32 Mask;
+	u32 WaitEvents;
+	u32 Events;	/* Masked register value once an event occurred */
+} XUtilEventsCond;
 
 /************************** Function Prototypes *****************************/
 
+static u32 Xil_EventsCond(void *Arg);
+
 #ifdef __ARMCC_VERSION
 /******************************************************************************/
 /**
@@ -238,6 +258,8 @@ END:
  * @param   EventMask - Mask indicating event(s) to be checked
  * @param   Event     - Specific event(s) value to be checked
  * @param   Timeout   - Max number of microseconds to wait for an event(s).
+ *                      With 0, the register is not read and XST_FAILURE
+ *                      is returned.
  *
  * @return
  *          XST_SUCCESS - On occurrence of the event(s).
@@ -248,18 +270,11 @@ END:
  *****************************************************************************/
 u32 Xil_WaitForEvent(u32 RegAddr, u32 EventMask, u32 Event, u32 Timeout)
 {
-	u32 EventStatus;
-	u32 PollCount = Timeout;
 	u32 Status = XST_FAILURE;
 
-	while(PollCount > 0U) {
-		EventStatus = Xil_In32(RegAddr) & EventMask;
-		if (EventStatus == Event) {
-			Status = XST_SUCCESS;
-			break;
-		}
-		PollCount--;
-		usleep(1U);
+	if ((Timeout != 0U) && (Xil_WaitReg((UINTPTR)RegAddr, EventMask, Event,
+		Timeout, NULL) == (u32)XST_SUCCESS)) {
+		Status = XST_SUCCESS;
 	}
 
 	return Status;
@@ -275,38 +290,58 @@ u32 Xil_WaitForEvent(u32 RegAddr, u32 EventMask, u32 Event, u32 Timeout)
  * @param   EventsMask - Mask indicating event(s) to be checked
  * @param   WaitEvents - Specific event(s) to be checked
  * @param   Timeout    - Max number of microseconds to wait for an event(s).
+ *                       0 waits for 0xFFFFFFFF microseconds, about 71
+ *                       minutes, as the poll counter used to wrap around.
  * @param   Events     - Mask of Events occurred returned in memory pointed by
  *                       this variable
  *
  * @return
  *          XST_SUCCESS - On occurrence of the event(s).
- *          XST_FAILURE - Event did not occur before counter reaches 0
+ *          XST_TIMEOUT - Event did not occur before counter reaches 0
  *
  ******************************************************************************/
 u32 Xil_WaitForEvents(u32 EventsRegAddr, u32 EventsMask, u32 WaitEvents,
 			 u32 Timeout, u32* Events)
 {
-	u32 EventStatus;
-	u32 PollCount = Timeout;
-	u32 Status = XST_TIMEOUT;
-
-	*Events = 0x00;
-	do {
-		EventStatus = Xil_In32(EventsRegAddr);
-		EventStatus &= EventsMask;
-		if((EventStatus & WaitEvents) != 0U) {
-			Status = XST_SUCCESS;
-			*Events = EventStatus;
-			break;
-		}
-		PollCount--;
-		usleep(1U);
-	}
-	while(PollCount > 0U);
+	XUtilEventsCond EventsCond;
+	u32 Status;
+
+	EventsCond.Addr = EventsRegAddr;
+	EventsCond.Mask = EventsMask;
+	EventsCond.WaitEvents = WaitEvents;
+	EventsCond.Events = 0x00U;
+
+	Status = Xil_WaitUntil(Xil_EventsCond, &EventsCond,
+			(Timeout == 0U) ? WAIT_FOREVER_US : Timeout, NULL);
+	*Events = EventsCond.Events;
 
 	return Status;
 }
 
+/******************************************************************************/
+/**
+ * Condition of Xil_WaitForEvents() and Xil_WaitForEventSet(), met when any
+ * of the events occurred.
+ *
+ * @param   Arg - Pointer to XUtilEventsCond
+ *
+ * @return  1 if any event occurred, 0 otherwise
+ *
+ ******************************************************************************/
+static u32 Xil_EventsCond(void *Arg)
+{
+	XUtilEventsCond *EventsCond = (XUtilEventsCond *)Arg;
+	u32 EventStatus = Xil_In32(EventsCond->Addr) & EventsCond->Mask;
+	u32 Occurred = 0U;
+
+	if ((EventStatus & EventsCond->WaitEvents) != 0U) {
+		EventsCond->Events = EventStatus;
+		Occurred = 1U;
+	}
+
+	return Occurred;
+}
+
 /******************************************************************************/
 /**
  * Checks whether the passed character is a valid hex digit
@@ -738,13 +773,7 @@ int Xil_SecureMemCpy(void * DestPtr, u32 DestPtrLen, const void * SrcPtr, u32 Le
 		goto END;
 	}
 
-	/* Loop and copy.  */
-	while (Len != 0U) {
-		*Dest = *Src;
-		Dest++;
-		Src++;
-		Len--;
-	}
+	Xil_MemCpy(Dest, Src, Len);
 	Status = XST_SUCCESS;
 
 END:
@@ -1250,7 +1279,10 @@ int Xil_SMemMove(void *Dest, const u32 DestSize,
  *
  * @param   Timeout     - Max number of microseconds to wait for an event,
  *			  It should be maximum timeout needed among the
- *			  events specified.
+ *			  events specified. Each event is given the full
+ *			  Timeout, counted from the occurrence of the
+ *			  previous event. With 0, no event is read and
+ *			  XST_FAILURE is returned.
  * @param   NumOfEvents - Number of event(s) to be checked.
  * @param   EventAddr   - Pointer to address of event(s) to be set.
  *
@@ -1263,31 +1295,27 @@ int Xil_SMemMove(void *Dest, const u32 DestSize,
  *****************************************************************************/
 u32 Xil_WaitForEventSet(u32 Timeout, u32 NumOfEvents, volatile u32 *EventAddr, ...)
 {
-	u32 PollCount = Timeout;
 	u32 Status = XST_FAILURE;
 	u32 LoopCnt = 0, i;
+	XUtilEventsCond EventsCond;
 	va_list Event;
 
+	EventsCond.Mask = MASK_ALL_BITS;
+	EventsCond.WaitEvents = MASK_ALL_BITS;
+
 	va_start(Event, EventAddr);
 	/* wait for all events to complete */
 	for (i = 0; i < NumOfEvents; i++) {
-		while(PollCount > 0U) {
-			if (Xil_In32((UINTPTR)EventAddr)) {
-				LoopCnt++;
-				break;
-			}
-			PollCount--;
-			usleep(1U);
-		}
-		if (PollCount == 0U) {
-			goto END;
+		EventsCond.Addr = (UINTPTR)EventAddr;
+		if ((Timeout == 0U) || (Xil_WaitUntil(Xil_EventsCond,
+			&EventsCond, Timeout, NULL) != (u32)XST_SUCCESS)) {
+			break;
 		}
+		LoopCnt++;
 		EventAddr = va_arg(Event, volatile u32 *);
-		PollCount = Timeout;
 	}
 	va_end(Event);
 
-END:
 	if (LoopCnt == NumOfEvents) {
 		Status = XST_SUCCESS;
 	}
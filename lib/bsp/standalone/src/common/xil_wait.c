@@ -0,0 +1,457 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xil_wait.c
+*
+* Implements the spin then sleep wait policy, the completion object and the
+* per call site statistics. For more information, see xil_wait.h.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -----------------------------------------------
+* 8.0   ant  10/18/26 First release
+*       ant  10/18/26 Call sites are registered by Xil_WaitStatsRegister()
+*                     instead of on their first wait, which raced between
+*                     interrupt handlers and cores.
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files ********************************/
+#include "xil_wait.h"
+#include "xil_io.h"
+#include "xil_printf.h"
+#include "xstatus.h"
+#include "sleep.h"
+#if defined(__arm__) || defined(__aarch64__)
+#include "xpseudo_asm.h"
+#endif
+#if defined(__aarch64__) && defined(__GNUC__)
+#include "xtime_l.h"
+#endif
+
+/************************** Constant Definitions ****************************/
+
+#define XIL_WAIT_CNTKCTL_EVNTEN		0x4U
+#define XIL_WAIT_CNTKCTL_EVNTI_SHIFT	4U
+#define XIL_WAIT_CNTKCTL_EVNTI_MASK	0xF0U
+
+/**************************** Type Definitions ******************************/
+
+typedef struct {
+	UINTPTR Addr;
+	u32 Mask;
+	u32 Value;
+} XWaitRegCond;
+
+/***************** Macros (Inline Functions) Definitions ********************/
+
+/*
+ * Posts a signal with release semantics and reads the signals with acquire
+ * semantics, so that data written before Xil_WaitEventSignal() on any core
+ * is visible once Xil_WaitEventWait() returns. Other processors run one core
+ * per image, where the interrupted thread sees the writes of its handler.
+ */
+#if defined(__GNUC__) && (defined(__arm__) || defined(__aarch64__))
+#define XIL_WAIT_POST(Evt)	\
+	((void)__atomic_fetch_add(&(Evt)->Posted, 1U, __ATOMIC_RELEASE))
+#define XIL_WAIT_POSTED(Evt)	__atomic_load_n(&(Evt)->Posted, __ATOMIC_ACQUIRE)
+#else
+#define XIL_WAIT_POST(Evt)	((Evt)->Posted = (Evt)->Posted + 1U)
+#define XIL_WAIT_POSTED(Evt)	((Evt)->Posted)
+#endif
+
+/*
+ * Makes the write of Posted visible before waking up cores waiting in WFE.
+ * Cores sleeping in WFI or usleep are woken by the interrupt itself.
+ */
+#if defined(__GNUC__) && (defined(__arm__) || defined(__aarch64__))
+#define XIL_WAIT_SEV()	do { dsb(); __asm__ __volatile__("sev"); } while (0)
+#else
+#define XIL_WAIT_SEV()
+#endif
+
+/************************** Function Prototypes *****************************/
+
+static u32 Xil_WaitSleepDefault(u32 Us);
+static u32 Xil_WaitRegCond(void *Arg);
+static u32 Xil_WaitEventCond(void *Arg);
+static u32 Xil_WaitSatAdd(u32 Val, u32 Inc);
+static void Xil_WaitStatsUpdate(XWaitStats *Stats, u32 Status, u32 Polls,
+	u32 Slept);
+
+/************************** Variable Definitions ****************************/
+
+static u32 WaitSpinPolls = XIL_WAIT_SPIN_POLLS;
+static u32 WaitMaxSleepUs = XIL_WAIT_MAX_SLEEP_US;
+static Xil_WaitSleepFn WaitSleepFn = Xil_WaitSleepDefault;
+static XWaitStats *WaitStatsHead = NULL;
+static XWaitStats *WaitStatsTail = NULL;
+
+/****************************************************************************/
+/**
+*
+* @brief    Sets the number of polls done before the first sleep and the
+*           upper limit of the sleep backoff.
+*
+* @param    SpinPolls: Polls before the first sleep, 0 sleeps after the
+*           first poll.
+* @param    MaxSleepUs: Longest sleep between two polls, in microseconds.
+*           0 is treated as 1.
+*
+* @return   None.
+*
+*****************************************************************************/
+void Xil_WaitSetPolicy(u32 SpinPolls, u32 MaxSleepUs)
+{
+	WaitSpinPolls = SpinPolls;
+	WaitMaxSleepUs = (MaxSleepUs == 0U) ? 1U : MaxSleepUs;
+}
+
+/****************************************************************************/
+/**
+*
+* @brief    Installs the function used to sleep between polls.
+*
+* @param    SleepFn: Sleep function, NULL restores usleep().
+*
+* @return   None.
+*
+*****************************************************************************/
+void Xil_WaitSetSleepFn(Xil_WaitSleepFn SleepFn)
+{
+	WaitSleepFn = (SleepFn == NULL) ? Xil_WaitSleepDefault : SleepFn;
+}
+
+/****************************************************************************/
+/**
+*
+* @brief    Waits till a condition is met or the timeout expires, spinning
+*           first and then sleeping with an exponential backoff.
+*
+* @param    Cond: Function checking the condition.
+* @param    Arg: Argument passed to Cond.
+* @param    Timeout: Max number of microseconds to sleep. With 0, only the
+*           spin polls are done.
+* @param    Stats: Statistics of the call site, or NULL.
+*
+* @return
+*		- XST_SUCCESS if the condition is met.
+*		- XST_TIMEOUT if the condition is not met before the timeout.
+*
+*****************************************************************************/
+u32 Xil_WaitUntil(Xil_WaitCondFn Cond, void *Arg, u32 Timeout,
+	XWaitStats *Stats)
+{
+	u32 Status = (u32)XST_TIMEOUT;
+	u32 Polls = 0U;
+	u32 Slept = 0U;
+	u32 SleepUs = 1U;
+	u32 Step;
+	u32 Done;
+
+	do {
+		Polls++;
+		Done = Cond(Arg);
+		if (Done != 0U) {
+			Status = (u32)XST_SUCCESS;
+		} else if (Polls < WaitSpinPolls) {
+			/* Still spinning */
+		} else if (Slept >= Timeout) {
+			Done = 1U;
+		} else {
+			Step = Timeout - Slept;
+			if (Step > SleepUs) {
+				Step = SleepUs;
+			}
+			Step = WaitSleepFn(Step);
+			Slept = ((Timeout - Slept) > Step) ? (Slept + Step) :
+				Timeout;
+			if (SleepUs < WaitMaxSleepUs) {
+				SleepUs <<= 1U;
+			}
+		}
+	} while (Done == 0U);
+
+	if (Stats != NULL) {
+		Xil_WaitStatsUpdate(Stats, Status, Polls, Slept);
+	}
+
+	return Status;
+}
+
+/****************************************************************************/
+/**
+*
+* @brief    Waits till the masked bits of a 32 bit register read as Value.
+*
+* @param    RegAddr: Address of the register.
+* @param    Mask: Bits to be checked.
+* @param    Value: Expected value of the masked bits.
+* @param    Timeout: Max number of microseconds to sleep.
+* @param    Stats: Statistics of the call site, or NULL.
+*
+* @return
+*		- XST_SUCCESS if the register reads as expected.
+*		- XST_TIMEOUT otherwise.
+*
+*****************************************************************************/
+u32 Xil_WaitReg(UINTPTR RegAddr, u32 Mask, u32 Value, u32 Timeout,
+	XWaitStats *Stats)
+{
+	XWaitRegCond RegCond;
+
+	RegCond.Addr = RegAddr;
+	RegCond.Mask = Mask;
+	RegCond.Value = Value;
+
+	return Xil_WaitUntil(Xil_WaitRegCond, &RegCond, Timeout, Stats);
+}
+
+/****************************************************************************/
+/**
+*
+* @brief    Initializes a completion object, with no pending signal.
+*
+* @param    Evt: Completion object.
+*
+* @return   None.
+*
+*****************************************************************************/
+void Xil_WaitEventInit(XWaitEvent *Evt)
+{
+	Evt->Posted = 0U;
+	Evt->Taken = 0U;
+}
+
+/****************************************************************************/
+/**
+*
+* @brief    Signals a completion object. Can be called from an interrupt
+*           handler or, on ARM, from another core sharing the object.
+*           Signals are counted, each one completes one Xil_WaitEventWait(),
+*           and all writes done before the signal are visible to the waiter
+*           once it returns.
+*
+* @param    Evt: Completion object.
+*
+* @return   None.
+*
+*****************************************************************************/
+void Xil_WaitEventSignal(XWaitEvent *Evt)
+{
+	XIL_WAIT_POST(Evt);
+	XIL_WAIT_SEV();
+}
+
+/****************************************************************************/
+/**
+*
+* @brief    Waits till a completion object is signalled and consumes the
+*           signal.
+*
+* @param    Evt: Completion object.
+* @param    Timeout: Max number of microseconds to sleep.
+* @param    Stats: Statistics of the call site, or NULL.
+*
+* @return
+*		- XST_SUCCESS if a signal was consumed.
+*		- XST_TIMEOUT otherwise.
+*
+*****************************************************************************/
+u32 Xil_WaitEventWait(XWaitEvent *Evt, u32 Timeout, XWaitStats *Stats)
+{
+	u32 Status;
+
+	Status = Xil_WaitUntil(Xil_WaitEventCond, Evt, Timeout, Stats);
+	if (Status == (u32)XST_SUCCESS) {
+		Evt->Taken = Evt->Taken + 1U;
+	}
+
+	return Status;
+}
+
+/****************************************************************************/
+/**
+*
+* @brief    Registers the statistics of a call site, so that they are listed
+*           by Xil_WaitStatsPrint() and cleared by Xil_WaitStatsReset().
+*           Registering the same statistics again has no effect.
+*
+* @param    Stats: Statistics defined with XIL_WAIT_STATS_DEFINE().
+*
+* @return   None.
+*
+* @note     The list of call sites is not locked. Register all of them at
+*           init, before interrupts are enabled and before other cores
+*           wait with them. Waits with unregistered statistics still
+*           update them.
+*
+*****************************************************************************/
+void Xil_WaitStatsRegister(XWaitStats *Stats)
+{
+	if ((Stats->Next != NULL) || (Stats == WaitStatsTail)) {
+		return;
+	}
+
+	if (WaitStatsTail == NULL) {
+		WaitStatsHead = Stats;
+	} else {
+		WaitStatsTail->Next = Stats;
+	}
+	WaitStatsTail = Stats;
+}
+
+/****************************************************************************/
+/**
+*
+* @brief    Clears the statistics of all registered call sites.
+*
+* @return   None.
+*
+*****************************************************************************/
+void Xil_WaitStatsReset(void)
+{
+	XWaitStats *Stats;
+
+	for (Stats = WaitStatsHead; Stats != NULL; Stats = Stats->Next) {
+		Stats->Calls = 0U;
+		Stats->Timeouts = 0U;
+		Stats->Polls = 0U;
+		Stats->TotalUs = 0U;
+		Stats->MaxUs = 0U;
+	}
+}
+
+/****************************************************************************/
+/**
+*
+* @brief    Prints the statistics of all registered call sites.
+*
+* @return   None.
+*
+*****************************************************************************/
+void Xil_WaitStatsPrint(void)
+{
+	const XWaitStats *Stats;
+
+	for (Stats = WaitStatsHead; Stats != NULL; Stats = Stats->Next) {
+		xil_printf("%s: calls %u timeouts %u polls %u slept %u us "
+			"max %u us\n\r", Stats->Name, Stats->Calls,
+			Stats->Timeouts, Stats->Polls, Stats->TotalUs,
+			Stats->MaxUs);
+	}
+}
+
+#if defined(__aarch64__) && defined(__GNUC__)
+/****************************************************************************/
+/**
+*
+* @brief    Sleep function sleeping in WFE, to be installed with
+*           Xil_WaitSetSleepFn(). It returns on the next event: an
+*           interrupt, a SEV from Xil_WaitEventSignal(), or the generic
+*           timer event stream which it enables on first use, so that
+*           timeouts still expire when nothing else happens.
+*
+* @param    Us: Not used, the event stream bounds the sleep to about
+*           2^(XIL_WAIT_EVNTI + 1) timer counts.
+*
+* @return   Microseconds slept, at least 1.
+*
+* @note     The event stream is a per core setting and stays enabled. It
+*           only causes spurious WFE wake ups, which every WFE loop has to
+*           tolerate anyway.
+*
+*****************************************************************************/
+u32 Xil_WaitSleepWfe(u32 Us)
+{
+	static u32 StreamEnabled = 0U;
+	XTime Start;
+	XTime End;
+	u64 Val;
+	u32 Slept;
+
+	(void)Us;
+	if (StreamEnabled == 0U) {
+		Val = mfcp(CNTKCTL_EL1);
+		Val &= ~(u64)XIL_WAIT_CNTKCTL_EVNTI_MASK;
+		Val |= ((u64)XIL_WAIT_EVNTI << XIL_WAIT_CNTKCTL_EVNTI_SHIFT) |
+			XIL_WAIT_CNTKCTL_EVNTEN;
+		mtcp(CNTKCTL_EL1, Val);
+		isb();
+		StreamEnabled = 1U;
+	}
+
+	XTime_GetTime(&Start);
+	__asm__ __volatile__("wfe" ::: "memory");
+	XTime_GetTime(&End);
+
+	Slept = (u32)(((End - Start) * 1000000U) / COUNTS_PER_SECOND);
+
+	return (Slept == 0U) ? 1U : Slept;
+}
+#endif
+
+/****************************************************************************/
+/**
+*
+* @brief    Default sleep function.
+*
+* @param    Us: Microseconds to sleep.
+*
+* @return   Us.
+*
+*****************************************************************************/
+static u32 Xil_WaitSleepDefault(u32 Us)
+{
+	usleep((ULONG)Us);
+
+	return Us;
+}
+
+static u32 Xil_WaitRegCond(void *Arg)
+{
+	const XWaitRegCond *RegCond = (const XWaitRegCond *)Arg;
+
+	return ((Xil_In32(RegCond->Addr) & RegCond->Mask) == RegCond->Value) ?
+		1U : 0U;
+}
+
+static u32 Xil_WaitEventCond(void *Arg)
+{
+	const XWaitEvent *Evt = (const XWaitEvent *)Arg;
+
+	return (XIL_WAIT_POSTED(Evt) != Evt->Taken) ? 1U : 0U;
+}
+
+static u32 Xil_WaitSatAdd(u32 Val, u32 Inc)
+{
+	return ((0xFFFFFFFFU - Val) > Inc) ? (Val + Inc) : 0xFFFFFFFFU;
+}
+
+/****************************************************************************/
+/**
+*
+* @brief    Accounts one wait to its call site.
+*
+*****************************************************************************/
+static void Xil_WaitStatsUpdate(XWaitStats *Stats, u32 Status, u32 Polls,
+	u32 Slept)
+{
+	Stats->Calls = Xil_WaitSatAdd(Stats->Calls, 1U);
+	if (Status != (u32)XST_SUCCESS) {
+		Stats->Timeouts = Xil_WaitSatAdd(Stats->Timeouts, 1U);
+	}
+	Stats->Polls = Xil_WaitSatAdd(Stats->Polls, Polls);
+	Stats->TotalUs = Xil_WaitSatAdd(Stats->TotalUs, Slept);
+	if (Slept > Stats->MaxUs) {
+		Stats->MaxUs = Slept;
+	}
+}
@@ -0,0 +1,159 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xil_wait.h
+*
+* @addtogroup common_wait_apis Wait APIs
+*
+* Wait primitives used by Xil_WaitForEvent() and friends, and available to
+* drivers and applications which wait on hardware or on interrupt handlers.
+*
+* A wait first polls its condition XIL_WAIT_SPIN_POLLS times without
+* sleeping, which catches most hardware completions at the lowest latency.
+* It then sleeps between polls, doubling the sleep from 1 us up to
+* XIL_WAIT_MAX_SLEEP_US. Both limits can be changed at run time with
+* Xil_WaitSetPolicy().
+*
+* Sleeping is done by usleep() unless a sleep function is installed with
+* Xil_WaitSetSleepFn(). An RTOS application installs a function which blocks
+* the calling task, so that other tasks run while drivers wait. On 64 bit
+* ARM, Xil_WaitSleepWfe() sleeps in WFE and is woken early by the
+* Xil_WaitEventSignal() of an interrupt handler or another core.
+*
+* XWaitEvent is a completion object: an interrupt handler calls
+* Xil_WaitEventSignal() and the thread calls Xil_WaitEventWait(). On ARM the
+* signal is a release and the wait an acquire, so the object may also be
+* signalled from other cores, and the data they wrote before signalling is
+* visible to the thread when the wait returns. Elsewhere it may only be
+* signalled from the core of the waiting thread.
+*
+* Passing an XWaitStats, defined at the call site with
+* XIL_WAIT_STATS_DEFINE(), counts the calls, timeouts, polls and time slept
+* of that call site. Xil_WaitStatsPrint() prints all the call sites
+* registered at init with Xil_WaitStatsRegister().
+*
+* @{
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -----------------------------------------------
+* 8.0   ant  10/18/26 First release
+*       ant  10/18/26 Added Xil_WaitStatsRegister()
+* </pre>
+*
+* @note
+*
+* Timeouts are in microseconds of sleep, as returned by the sleep function,
+* the same accounting Xil_WaitForEvent() always used. Time spent polling is
+* not counted, so a wait may last somewhat longer than its timeout but never
+* shorter.
+*
+******************************************************************************/
+
+#ifndef XIL_WAIT_H	/* prevent circular inclusions */
+#define XIL_WAIT_H	/* by using protection macros */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files ********************************/
+#include "xil_types.h"
+
+/************************** Constant Definitions ****************************/
+
+#ifndef XIL_WAIT_SPIN_POLLS
+#define XIL_WAIT_SPIN_POLLS	32U	/* Polls before the first sleep */
+#endif
+#ifndef XIL_WAIT_MAX_SLEEP_US
+#define XIL_WAIT_MAX_SLEEP_US	8U	/* Upper limit of the sleep backoff */
+#endif
+
+#if defined(__aarch64__) && defined(__GNUC__)
+/*
+ * CNTKCTL_EL1.EVNTI used by Xil_WaitSleepWfe(): the generic timer sends an
+ * event every 2^(EVNTI + 1) counts, 2.56 us at 100 MHz.
+ */
+#ifndef XIL_WAIT_EVNTI
+#define XIL_WAIT_EVNTI		7U
+#endif
+#endif
+
+/**************************** Type Definitions ******************************/
+
+/**
+ * Returns non zero when the awaited condition is met.
+ */
+typedef u32 (*Xil_WaitCondFn)(void *Arg);
+
+/**
+ * Sleeps up to Us microseconds and returns the number of microseconds
+ * slept, which must be at least 1.
+ */
+typedef u32 (*Xil_WaitSleepFn)(u32 Us);
+
+/**
+ * Statistics of one call site.
+ */
+typedef struct XWaitStats {
+	const char8 *Name;	/**< Name of the call site */
+	u32 Calls;		/**< Number of waits */
+	u32 Timeouts;		/**< Number of waits that timed out */
+	u32 Polls;		/**< Number of times the condition was checked */
+	u32 TotalUs;		/**< Time slept, saturates at 0xFFFFFFFF */
+	u32 MaxUs;		/**< Longest time slept by one wait */
+	struct XWaitStats *Next;	/**< Next registered call site */
+} XWaitStats;
+
+/**
+ * Completion object, signalled by interrupt handlers or, on ARM, other cores
+ * and waited on by one consumer.
+ */
+typedef struct {
+	volatile u32 Posted;	/**< Written only by Xil_WaitEventSignal() */
+	volatile u32 Taken;	/**< Written only by Xil_WaitEventWait() */
+} XWaitEvent;
+
+/***************** Macros (Inline Functions) Definitions ********************/
+
+/**
+ * Defines the statistics of a call site, named after the variable.
+ */
+#define XIL_WAIT_STATS_DEFINE(Var)	\
+	static XWaitStats Var = { #Var, 0U, 0U, 0U, 0U, 0U, NULL }
+
+/************************** Function Prototypes *****************************/
+
+void Xil_WaitSetPolicy(u32 SpinPolls, u32 MaxSleepUs);
+void Xil_WaitSetSleepFn(Xil_WaitSleepFn SleepFn);
+u32 Xil_WaitUntil(Xil_WaitCondFn Cond, void *Arg, u32 Timeout,
+	XWaitStats *Stats);
+u32 Xil_WaitReg(UINTPTR RegAddr, u32 Mask, u32 Value, u32 Timeout,
+	XWaitStats *Stats);
+
+void Xil_WaitEventInit(XWaitEvent *Evt);
+void Xil_WaitEventSignal(XWaitEvent *Evt);
+u32 Xil_WaitEventWait(XWaitEvent *Evt, u32 Timeout, XWaitStats *Stats);
+
+void Xil_WaitStatsRegister(XWaitStats *Stats);
+void Xil_WaitStatsReset(void);
+void Xil_WaitStatsPrint(void);
+
+#if defined(__aarch64__) && defined(__GNUC__)
+u32 Xil_WaitSleepWfe(u32 Us);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XIL_WAIT_H */
+/**
+* @} End of "addtogroup common_wait_apis".
+*/
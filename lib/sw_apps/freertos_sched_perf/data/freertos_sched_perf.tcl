@@ -0,0 +1,79 @@
+#/******************************************************************************
+#* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+#* SPDX-License-Identifier: MIT
+#******************************************************************************/
+
+
+proc swapp_get_name {} {
+    return "FreeRTOS Scheduler Perf";
+}
+
+proc swapp_get_description {} {
+    return " FreeRTOS scheduler context switch, wakeup latency and tick overhead benchmark";
+}
+
+proc check_freertos_os {} {
+    set oslist [hsi::get_os];
+
+    if { [llength $oslist] != 1 } {
+        return 0;
+    }
+    set os [lindex $oslist 0];
+
+    if { $os != "freertos10_xilinx" } {
+        error "This application is supported only on the freertos10_xilinx.";
+    }
+}
+
+proc swapp_is_supported_sw {} {
+
+    check_freertos_os
+
+    return 1;
+}
+
+proc swapp_is_supported_hw {} {
+
+    # check processor type
+    set proc_instance [::hsi::get_sw_processor];
+    set hw_processor [common::get_property HW_INSTANCE $proc_instance]
+
+    set proc_type [common::get_property IP_NAME [hsi::get_cells -hier $hw_processor]];
+    set procdrv [::hsi::get_sw_processor]
+    if {[string compare -nocase $proc_type "psu_cortexa53"] == 0} {
+	set compiler [common::get_property CONFIG.compiler $procdrv]
+	if {[string compare -nocase $compiler "arm-none-eabi-gcc"] == 0} {
+		error "ERROR: FreeRTOS is not supported for 32bit A53"
+	}
+    }
+    if { $proc_type != "psu_cortexr5" && $proc_type != "psv_cortexr5" && $proc_type != "ps7_cortexa9" && $proc_type != "psu_cortexa53" && $proc_type != "psv_cortexa72"} {
+                error "This application is supported only for CortexR5/CortexA9/CortexA53/CortexA72 processors.";
+    }
+
+    return 1;
+}
+
+
+proc get_stdout {} {
+    return;
+}
+
+proc check_stdout_hw {} {
+    return;
+}
+
+proc swapp_generate {} {
+    return;
+}
+
+proc swapp_get_linker_constraints {} {
+    return "";
+}
+
+proc swapp_get_supported_processors {} {
+    return "psu_cortexr5 psv_cortexr5 ps7_cortexa9 psu_cortexa53 psv_cortexa72";
+}
+
+proc swapp_get_supported_os {} {
+    return "freertos10_xilinx";
+}
@@ -0,0 +1,242 @@
+/*
+    Copyright (c) 2026 Xilinx, Inc. All Rights Reserved.
+	SPDX-License-Identifier: MIT
+
+
+    http://www.FreeRTOS.org
+    http://aws.amazon.com/freertos
+
+
+    1 tab == 4 spaces!
+*/
+
+/*
+ * Scheduler benchmark for the FreeRTOS ports.  It measures:
+ *  - the cost of a task to task switch through taskYIELD() between two
+ *    tasks of the same priority,
+ *  - the latency from xTaskNotifyGive() in a low priority task to the
+ *    notified higher priority task running,
+ *  - the share of CPU time taken by the tick interrupt.
+ * Results are printed as "name: value" lines so they can be collected by a
+ * script.  Times are in XTime counts, COUNTS_PER_SECOND is printed first.
+ */
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+/* Xilinx includes. */
+#include "xil_printf.h"
+#include "xparameters.h"
+#include "xtime_l.h"
+
+#define YIELD_ITERATIONS		10000UL
+#define NOTIFY_ITERATIONS		10000UL
+#define TICK_MEASURE_TICKS		100UL
+#define BENCH_STACK_SIZE		( configMINIMAL_STACK_SIZE * 2 )
+/*-----------------------------------------------------------*/
+
+static void prvControlTask( void *pvParameters );
+static void prvYieldTask( void *pvParameters );
+static void prvNotifyWaitTask( void *pvParameters );
+/*-----------------------------------------------------------*/
+
+static TaskHandle_t xControlTask;
+static TaskHandle_t xNotifyWaitTask;
+
+/* Number of yields done by the two yield tasks. */
+static volatile u32 ulYieldCount;
+
+/* Time stamp taken right before each notification is given. */
+static volatile XTime xNotifyGiveTime;
+static XTime xLatencyMin;
+static XTime xLatencyMax;
+static XTime xLatencySum;
+/*-----------------------------------------------------------*/
+
+int main( void )
+{
+	xil_printf( "FreeRTOS scheduler perf\r\n" );
+
+	xTaskCreate( prvControlTask,
+				 ( const char * ) "Ctrl",
+				 BENCH_STACK_SIZE,
+				 NULL,
+				 tskIDLE_PRIORITY + 1,
+				 &xControlTask );
+
+	vTaskStartScheduler();
+
+	/* Only reached if there was not enough heap for the idle task. */
+	for( ;; );
+}
+/*-----------------------------------------------------------*/
+
+static XTime prvBusyLoop( XTime xDuration, u32 *pulIterations )
+{
+XTime xStart, xNow;
+u32 ulIterations = 0;
+
+	XTime_GetTime( &xStart );
+	do
+	{
+		ulIterations++;
+		XTime_GetTime( &xNow );
+	} while( ( xNow - xStart ) < xDuration );
+
+	*pulIterations = ulIterations;
+	return xNow - xStart;
+}
+/*-----------------------------------------------------------*/
+
+static void prvMeasureYield( void )
+{
+XTime xStart, xEnd;
+
+	ulYieldCount = 0;
+
+	/* Both tasks run above the control task, which only gets to run again
+	when both have completed their iterations.  The scheduler is suspended
+	so that neither task starts before the other one exists. */
+	vTaskSuspendAll();
+	xTaskCreate( prvYieldTask, "Y1", BENCH_STACK_SIZE, NULL, tskIDLE_PRIORITY + 2, NULL );
+	xTaskCreate( prvYieldTask, "Y2", BENCH_STACK_SIZE, NULL, tskIDLE_PRIORITY + 2, NULL );
+	XTime_GetTime( &xStart );
+	( void ) xTaskResumeAll();
+
+	/* One notification from each yield task. */
+	ulTaskNotifyTake( pdFALSE, portMAX_DELAY );
+	ulTaskNotifyTake( pdFALSE, portMAX_DELAY );
+	XTime_GetTime( &xEnd );
+
+	xil_printf( "yield_switches: %u\r\n", ( unsigned int ) ulYieldCount );
+	xil_printf( "yield_switch_counts: %u\r\n",
+				( unsigned int ) ( ( xEnd - xStart ) / ulYieldCount ) );
+}
+/*-----------------------------------------------------------*/
+
+static void prvMeasureNotify( void )
+{
+u32 ulIteration;
+
+	xLatencyMin = ( XTime ) -1;
+	xLatencyMax = 0;
+	xLatencySum = 0;
+
+	xTaskCreate( prvNotifyWaitTask, "NW", BENCH_STACK_SIZE, NULL, tskIDLE_PRIORITY + 2, &xNotifyWaitTask );
+
+	for( ulIteration = 0; ulIteration < NOTIFY_ITERATIONS; ulIteration++ )
+	{
+		XTime_GetTime( ( XTime * ) &xNotifyGiveTime );
+		/* Switches to the waiting task straight away, which records the
+		latency and blocks again. */
+		xTaskNotifyGive( xNotifyWaitTask );
+	}
+
+	vTaskDelete( xNotifyWaitTask );
+
+	xil_printf( "notify_latency_min_counts: %u\r\n", ( unsigned int ) xLatencyMin );
+	xil_printf( "notify_latency_avg_counts: %u\r\n",
+				( unsigned int ) ( xLatencySum / NOTIFY_ITERATIONS ) );
+	xil_printf( "notify_latency_max_counts: %u\r\n", ( unsigned int ) xLatencyMax );
+}
+/*-----------------------------------------------------------*/
+
+static void prvMeasureTick( void )
+{
+const XTime xDuration = ( ( XTime ) COUNTS_PER_SECOND * TICK_MEASURE_TICKS ) / configTICK_RATE_HZ;
+XTime xElapsedNoTick, xElapsedTick;
+u32 ulItersNoTick, ulItersTick;
+u64 ullRateNoTick, ullRateTick;
+TickType_t xTickStart;
+
+	/* Same busy loop, once with interrupts masked and once with the tick
+	running.  The lost iterations are the tick interrupt cost. */
+	taskENTER_CRITICAL();
+	xElapsedNoTick = prvBusyLoop( xDuration, &ulItersNoTick );
+	taskEXIT_CRITICAL();
+
+	xTickStart = xTaskGetTickCount();
+	xElapsedTick = prvBusyLoop( xDuration, &ulItersTick );
+	xTickStart = xTaskGetTickCount() - xTickStart;
+
+	/* Iterations per 2^20 counts, to avoid floating point. */
+	ullRateNoTick = ( ( u64 ) ulItersNoTick << 20 ) / xElapsedNoTick;
+	ullRateTick = ( ( u64 ) ulItersTick << 20 ) / xElapsedTick;
+
+	xil_printf( "tick_count: %u\r\n", ( unsigned int ) xTickStart );
+	if( ( ullRateTick < ullRateNoTick ) && ( xTickStart != 0 ) )
+	{
+		/* Counts lost per tick = elapsed * (1 - rate_tick / rate_notick) / ticks */
+		xil_printf( "tick_overhead_counts: %u\r\n",
+					( unsigned int ) ( ( ( ullRateNoTick - ullRateTick ) * xElapsedTick ) /
+									   ( ullRateNoTick * xTickStart ) ) );
+		xil_printf( "tick_overhead_ppm: %u\r\n",
+					( unsigned int ) ( ( ( ullRateNoTick - ullRateTick ) * 1000000ULL ) / ullRateNoTick ) );
+	}
+	else
+	{
+		xil_printf( "tick_overhead_counts: 0\r\n" );
+		xil_printf( "tick_overhead_ppm: 0\r\n" );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvControlTask( void *pvParameters )
+{
+	( void ) pvParameters;
+
+	xil_printf( "counts_per_second: %u\r\n", ( unsigned int ) COUNTS_PER_SECOND );
+	xil_printf( "tick_rate_hz: %u\r\n", ( unsigned int ) configTICK_RATE_HZ );
+	xil_printf( "port_optimised_task_selection: %u\r\n",
+				( unsigned int ) configUSE_PORT_OPTIMISED_TASK_SELECTION );
+	xil_printf( "tickless_idle: %u\r\n", ( unsigned int ) configUSE_TICKLESS_IDLE );
+
+	prvMeasureYield();
+	prvMeasureNotify();
+	prvMeasureTick();
+
+	xil_printf( "Successfully ran FreeRTOS scheduler perf\r\n" );
+	vTaskDelete( NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvYieldTask( void *pvParameters )
+{
+u32 ulIteration;
+
+	( void ) pvParameters;
+
+	for( ulIteration = 0; ulIteration < YIELD_ITERATIONS; ulIteration++ )
+	{
+		ulYieldCount++;
+		taskYIELD();
+	}
+
+	xTaskNotifyGive( xControlTask );
+	vTaskDelete( NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvNotifyWaitTask( void *pvParameters )
+{
+XTime xNow, xLatency;
+
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+		XTime_GetTime( &xNow );
+
+		xLatency = xNow - xNotifyGiveTime;
+		xLatencySum += xLatency;
+		if( xLatency < xLatencyMin )
+		{
+			xLatencyMin = xLatency;
+		}
+		if( xLatency > xLatencyMax )
+		{
+			xLatencyMax = xLatency;
+		}
+	}
+}
@@ -0,0 +1,95 @@
+#/******************************************************************************
+#* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+#* SPDX-License-Identifier: MIT
+#******************************************************************************/
+
+proc swapp_get_name {} {
+    return "Memory Benchmark";
+}
+
+proc swapp_get_description {} {
+    return "Memory bandwidth, latency, cache maintenance and DMA throughput benchmark for baremetal environment.";
+}
+
+proc check_standalone_os {} {
+    set os [hsi::get_os];
+
+    if { $os == "" } {
+        error "No Operating System specified in the Board Support Package";
+    }
+
+    if { $os != "standalone" } {
+        error "This application is supported only on the Standalone Board Support Package.";
+    }
+}
+
+proc get_stdout {} {
+    set os [hsi::get_os];
+    if { $os == "" } {
+        error "No Operating System specified in the Board Support Package";
+    }
+
+    set stdout [common::get_property CONFIG.STDOUT $os];
+    return $stdout;
+}
+
+proc check_stdout_sw {} {
+    set stdout [get_stdout];
+    if { $stdout == "none" } {
+        error "The STDOUT parameter is not set on the OS. Memory Benchmark requires stdout to be set."
+    }
+}
+
+proc require_memory {memsize} {
+    set proc_instance [hsi::get_sw_processor];
+    set memlist [hsi::get_mem_ranges -of_objects [hsi::get_cells -hier $proc_instance] -filter { IS_DATA == true && MEM_TYPE == "MEMORY" }];
+
+    # check for a memory with required size
+    foreach mem $memlist {
+        set base [common::get_property BASE_VALUE $mem]
+        set high [common::get_property HIGH_VALUE $mem]
+        if { [expr $high - $base + 1] >= $memsize } {
+            return 1;
+        }
+    }
+
+    error "This application requires atleast $memsize bytes of memory. Reduce MEM_BENCH_BUF_SIZE in mem_bench.c for smaller memories.";
+}
+
+proc swapp_is_supported_hw {} {
+    # check processor type
+    set proc_instance [hsi::get_sw_processor];
+    set hw_processor [common::get_property HW_INSTANCE $proc_instance]
+    set proc_type [common::get_property IP_NAME [hsi::get_cells -hier $hw_processor]];
+
+    if { $proc_type != "psu_cortexr5" && $proc_type != "psv_cortexr5" && $proc_type != "ps7_cortexa9" && $proc_type != "psu_cortexa53" && $proc_type != "psv_cortexa72"} {
+        error "This application is supported only for CortexR5/CortexA9/CortexA53/CortexA72 processors.";
+    }
+
+    # 32 MB work area and the program itself
+    require_memory "34603008";
+}
+
+proc swapp_is_supported_sw {} {
+    # check for standalone OS
+    check_standalone_os;
+
+    # check for stdout being set
+    check_stdout_sw;
+}
+
+proc swapp_generate {} {
+    return;
+}
+
+proc swapp_get_linker_constraints {} {
+    return "stack 16k heap 16k"
+}
+
+proc swapp_get_supported_processors {} {
+    return "psu_cortexa53 ps7_cortexa9 psv_cortexa72 psu_cortexr5 psv_cortexr5";
+}
+
+proc swapp_get_supported_os {} {
+    return "standalone";
+}
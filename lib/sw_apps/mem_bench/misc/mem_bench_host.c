@@ -0,0 +1,124 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file mem_bench_host.c
+*
+* Runs the processor independent memory benchmark tests (STREAM, latency and
+* Xil_MemCpy) on host, or under Linux on the target, with the same output
+* format as the standalone application. Useful to check changes to
+* Xil_MemCpy and the benchmark itself without a board, and to compare the
+* standalone numbers with Linux on the same board.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -----------------------------------------------
+* 1.00  ant  10/18/26 Initial release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <time.h>
+#include "mem_bench.h"
+
+/************************** Constant Definitions *****************************/
+#define DEFAULT_SIZE_MB		(32U)
+#define DEFAULT_MIN_MS		(20U)
+
+/*****************************************************************************/
+void MemBench_Result(const char8 *Test, u32 Param, const char8 *Metric,
+	u32 Value)
+{
+	printf("mem_bench,%s,%u,%s,%u\n", Test, Param, Metric, Value);
+	fflush(stdout);
+}
+
+/*****************************************************************************/
+static u64 NowNs(void)
+{
+	struct timespec Ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &Ts);
+	return ((u64)Ts.tv_sec * 1000000000ULL) + (u64)Ts.tv_nsec;
+}
+
+/*****************************************************************************/
+static void Usage(const char *Prog)
+{
+	fprintf(stderr, "Usage: %s [-s work area MB] [-m min ms per measurement] "
+		"[-t tests: s=stream l=latency c=memcpy]\n", Prog);
+}
+
+/*****************************************************************************/
+int main(int argc, char *argv[])
+{
+	MemBench Bench;
+	const char *Tests = "slc";
+	u32 SizeMb = DEFAULT_SIZE_MB;
+	u32 MinMs = DEFAULT_MIN_MS;
+	int Opt;
+
+	while ((Opt = getopt(argc, argv, "s:m:t:")) != -1) {
+		switch (Opt) {
+		case 's':
+			SizeMb = (u32)strtoul(optarg, NULL, 0);
+			break;
+		case 'm':
+			MinMs = (u32)strtoul(optarg, NULL, 0);
+			break;
+		case 't':
+			Tests = optarg;
+			break;
+		default:
+			Usage(argv[0]);
+			return 1;
+		}
+	}
+	if ((SizeMb == 0U) || (SizeMb > 2048U)) {
+		fprintf(stderr, "Work area must be 1 to 2048 MB\n");
+		return 1;
+	}
+
+	Bench.GetTime = NowNs;
+	Bench.Freq = 1000000000ULL;
+	Bench.Size = SizeMb << 20U;
+	Bench.MinMs = MinMs;
+	Bench.Buf = aligned_alloc(MEM_BENCH_LINE_SIZE, Bench.Size);
+	if (Bench.Buf == NULL) {
+		fprintf(stderr, "Can not allocate %u MB\n", SizeMb);
+		return 1;
+	}
+
+	MemBench_Result("info", 0U, "counts_per_second", (u32)Bench.Freq);
+	MemBench_Result("info", 0U, "buf_size", Bench.Size);
+	for (; *Tests != '\0'; Tests++) {
+		switch (*Tests) {
+		case 's':
+			MemBench_Stream(&Bench);
+			break;
+		case 'l':
+			MemBench_Latency(&Bench);
+			break;
+		case 'c':
+			MemBench_MemCpy(&Bench);
+			break;
+		default:
+			Usage(argv[0]);
+			free(Bench.Buf);
+			return 1;
+		}
+	}
+
+	free(Bench.Buf);
+	return 0;
+}
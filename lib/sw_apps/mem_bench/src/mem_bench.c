@@ -0,0 +1,529 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file mem_bench.c
+*
+* Memory and cache benchmark for the standalone BSP. Besides the processor
+* independent tests of mem_bench_core.c it measures:
+*
+* - dcache_flush_dirty/dcache_flush_clean/dcache_invalidate: cost of
+*   Xil_DCacheFlushRange and Xil_DCacheInvalidateRange per call, for
+*   ranges with dirty or clean lines in the cache, and dcache_flush_all
+*   for Xil_DCacheFlush with MEM_BENCH_CACHE_MAX bytes dirty. The range
+*   size from which flushing the whole cache is cheaper is reported as
+*   dcache_range_threshold, to be passed to Xil_DCacheSetRangeThreshold()
+*   by applications on the same design.
+* - zdma/cdma/axidma: throughput of the ZDMA, AXI CDMA and AXI DMA engines
+*   in the design, with the existing drivers in polled simple mode and the
+*   cache maintenance left out of the timing. AXI DMA needs its MM2S
+*   stream looped back to S2MM in the design, so it is only measured when
+*   MEM_BENCH_AXIDMA_LOOPBACK is defined.
+*
+* Results are printed as "mem_bench,<test>,<param>,<metric>,<value>"
+* lines, see mem_bench.h. The work area is MEM_BENCH_BUF_SIZE bytes of
+* .bss, make it smaller for designs without DDR.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -----------------------------------------------
+* 1.00  ant  10/18/26 Initial release
+* 1.01  ant  10/18/26 Report the range to whole cache flush threshold
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "xparameters.h"
+#include "xil_printf.h"
+#include "xil_cache.h"
+#include "xil_mem.h"
+#include "xstatus.h"
+#include "xtime_l.h"
+#include "mem_bench.h"
+#if defined(XPAR_XZDMA_NUM_INSTANCES)
+#include "xzdma.h"
+#endif
+#if defined(XPAR_XAXICDMA_NUM_INSTANCES)
+#include "xaxicdma.h"
+#endif
+#if defined(XPAR_XAXIDMA_NUM_INSTANCES) && defined(MEM_BENCH_AXIDMA_LOOPBACK)
+#include "xaxidma.h"
+#endif
+
+/************************** Constant Definitions *****************************/
+#ifndef MEM_BENCH_BUF_SIZE
+#define MEM_BENCH_BUF_SIZE	0x2000000U
+#endif
+#ifndef MEM_BENCH_MIN_MS
+#define MEM_BENCH_MIN_MS	20U
+#endif
+/* Largest range of the cache tests, bigger than any cache level */
+#define MEM_BENCH_CACHE_MAX	0x400000U
+/* Small ranges are timed in batches which stay in the L1 cache */
+#define MEM_BENCH_CACHE_BATCH	0x4000U
+#define MEM_BENCH_DMA_MIN	0x1000U
+
+#if defined(XPAR_XZDMA_NUM_INSTANCES) && !defined(MEM_BENCH_ZDMA_DEVICE_ID)
+#define MEM_BENCH_ZDMA_DEVICE_ID	XPAR_XZDMA_0_DEVICE_ID
+#endif
+#if defined(XPAR_XAXICDMA_NUM_INSTANCES) && !defined(MEM_BENCH_CDMA_DEVICE_ID)
+#define MEM_BENCH_CDMA_DEVICE_ID	XPAR_AXICDMA_0_DEVICE_ID
+#endif
+#if defined(XPAR_XAXIDMA_NUM_INSTANCES) && \
+	defined(MEM_BENCH_AXIDMA_LOOPBACK) && \
+	!defined(MEM_BENCH_AXIDMA_DEVICE_ID)
+#define MEM_BENCH_AXIDMA_DEVICE_ID	XPAR_AXIDMA_0_DEVICE_ID
+#endif
+
+/**************************** Type Definitions *******************************/
+typedef struct {
+	UINTPTR Src;
+	UINTPTR Dst;
+	u32 Len;
+} MemBench_DmaArgs;
+
+/************************** Function Prototypes ******************************/
+static u64 MemBench_GetTime(void);
+static void MemBench_Touch(const u8 *Addr, u32 Len);
+static void MemBench_Cache(const MemBench *Bench);
+static void MemBench_Dma(const MemBench *Bench, const char8 *Test,
+	MemBench_Fn Fn, void *Inst, u32 MaxLen);
+#if defined(XPAR_XZDMA_NUM_INSTANCES)
+static s32 MemBench_ZDma(const MemBench *Bench);
+static void MemBench_ZDmaCopy(void *Arg);
+#endif
+#if defined(XPAR_XAXICDMA_NUM_INSTANCES)
+static s32 MemBench_Cdma(const MemBench *Bench);
+static void MemBench_CdmaCopy(void *Arg);
+#endif
+#if defined(XPAR_XAXIDMA_NUM_INSTANCES) && defined(MEM_BENCH_AXIDMA_LOOPBACK)
+static s32 MemBench_AxiDma(const MemBench *Bench);
+static void MemBench_AxiDmaCopy(void *Arg);
+#endif
+
+/************************** Variable Definitions *****************************/
+static u8 BenchBuf[MEM_BENCH_BUF_SIZE] __attribute__((aligned(64)));
+static MemBench_DmaArgs DmaArgs;
+static volatile u32 TouchSum;
+
+#if defined(XPAR_XZDMA_NUM_INSTANCES)
+static XZDma ZDma;
+#endif
+#if defined(XPAR_XAXICDMA_NUM_INSTANCES)
+static XAxiCdma Cdma;
+#endif
+#if defined(XPAR_XAXIDMA_NUM_INSTANCES) && defined(MEM_BENCH_AXIDMA_LOOPBACK)
+static XAxiDma AxiDma;
+#endif
+
+/*****************************************************************************/
+int main(void)
+{
+	MemBench Bench;
+
+	Bench.GetTime = MemBench_GetTime;
+	Bench.Freq = COUNTS_PER_SECOND;
+	Bench.Buf = BenchBuf;
+	Bench.Size = MEM_BENCH_BUF_SIZE;
+	Bench.MinMs = MEM_BENCH_MIN_MS;
+
+	xil_printf("Memory benchmark\r\n");
+	MemBench_Result("info", 0U, "counts_per_second",
+		(u32)COUNTS_PER_SECOND);
+	MemBench_Result("info", 0U, "buf_size", MEM_BENCH_BUF_SIZE);
+
+	MemBench_Stream(&Bench);
+	MemBench_Latency(&Bench);
+	MemBench_MemCpy(&Bench);
+	MemBench_Cache(&Bench);
+#if defined(XPAR_XZDMA_NUM_INSTANCES)
+	if (MemBench_ZDma(&Bench) != XST_SUCCESS) {
+		xil_printf("ZDMA benchmark failed\r\n");
+	}
+#endif
+#if defined(XPAR_XAXICDMA_NUM_INSTANCES)
+	if (MemBench_Cdma(&Bench) != XST_SUCCESS) {
+		xil_printf("AXI CDMA benchmark failed\r\n");
+	}
+#endif
+#if defined(XPAR_XAXIDMA_NUM_INSTANCES) && defined(MEM_BENCH_AXIDMA_LOOPBACK)
+	if (MemBench_AxiDma(&Bench) != XST_SUCCESS) {
+		xil_printf("AXI DMA benchmark failed\r\n");
+	}
+#endif
+
+	xil_printf("Successfully ran memory benchmark\r\n");
+	return 0;
+}
+
+/*****************************************************************************/
+void MemBench_Result(const char8 *Test, u32 Param, const char8 *Metric,
+	u32 Value)
+{
+	xil_printf("mem_bench,%s,%u,%s,%u\r\n", Test, Param, Metric, Value);
+}
+
+/*****************************************************************************/
+static u64 MemBench_GetTime(void)
+{
+	XTime Now;
+
+	XTime_GetTime(&Now);
+	return (u64)Now;
+}
+
+/*****************************************************************************/
+/**
+*
+* Reads one word of every cache line, so the range is in the cache and clean
+* when it was flushed before.
+*
+******************************************************************************/
+static void MemBench_Touch(const u8 *Addr, u32 Len)
+{
+	u32 Sum = 0U;
+	u32 Offset;
+
+	for (Offset = 0U; Offset < Len; Offset += MEM_BENCH_LINE_SIZE) {
+		Sum += *(const volatile u32 *)(const void *)(Addr + Offset);
+	}
+	TouchSum = Sum;
+}
+
+/*****************************************************************************/
+/**
+*
+* Measures the cost of the range cache maintenance APIs per call, from one
+* cache line up to MEM_BENCH_CACHE_MAX, and of Xil_DCacheFlush. Ranges
+* smaller than MEM_BENCH_CACHE_BATCH are timed as a batch of adjacent ranges
+* to be independent of the time stamp resolution.
+*
+* @param	Bench is the benchmark configuration.
+*
+* @return	None.
+*
+******************************************************************************/
+static void MemBench_Cache(const MemBench *Bench)
+{
+	u64 Best[3U];
+	u64 Start;
+	u64 Counts;
+	u64 RangeCounts = 0U;
+	u32 RangeLen = 0U;
+	u32 Threshold = Xil_DCacheGetRangeThreshold();
+	u32 Len;
+	u32 Batch;
+	u32 Run;
+	u32 Index;
+	u32 Test;
+
+	/* Always line by line while measuring the range APIs */
+	Xil_DCacheSetRangeThreshold(0U);
+	for (Len = MEM_BENCH_LINE_SIZE; (Len <= MEM_BENCH_CACHE_MAX) &&
+		(Len <= Bench->Size); Len <<= 2U) {
+		Batch = (Len < MEM_BENCH_CACHE_BATCH) ?
+			(MEM_BENCH_CACHE_BATCH / Len) : 1U;
+		Best[0U] = ~0ULL;
+		Best[1U] = ~0ULL;
+		Best[2U] = ~0ULL;
+		for (Run = 0U; Run < MEM_BENCH_REPEAT; Run++) {
+			for (Test = 0U; Test < 3U; Test++) {
+				if (Test == 0U) {
+					Xil_MemSet(Bench->Buf, (s32)Run, Len * Batch);
+				} else {
+					MemBench_Touch(Bench->Buf, Len * Batch);
+				}
+				Start = MemBench_GetTime();
+				for (Index = 0U; Index < Batch; Index++) {
+					if (Test == 2U) {
+						Xil_DCacheInvalidateRange(
+							(INTPTR)(Bench->Buf + (Index * Len)), Len);
+					} else {
+						Xil_DCacheFlushRange(
+							(INTPTR)(Bench->Buf + (Index * Len)), Len);
+					}
+				}
+				Counts = MemBench_GetTime() - Start;
+				if (Counts < Best[Test]) {
+					Best[Test] = Counts;
+				}
+			}
+		}
+		MemBench_Result("dcache_flush_dirty", Len, "ns",
+			MemBench_Ns(Bench, Best[0U], Batch));
+		MemBench_Result("dcache_flush_clean", Len, "ns",
+			MemBench_Ns(Bench, Best[1U], Batch));
+		MemBench_Result("dcache_invalidate", Len, "ns",
+			MemBench_Ns(Bench, Best[2U], Batch));
+		RangeLen = Len;
+		RangeCounts = Best[0U];
+	}
+	Xil_DCacheSetRangeThreshold(Threshold);
+
+	Len = (Bench->Size < MEM_BENCH_CACHE_MAX) ? Bench->Size :
+		MEM_BENCH_CACHE_MAX;
+	Best[0U] = ~0ULL;
+	for (Run = 0U; Run < MEM_BENCH_REPEAT; Run++) {
+		Xil_MemSet(Bench->Buf, (s32)Run, Len);
+		Start = MemBench_GetTime();
+		Xil_DCacheFlush();
+		Counts = MemBench_GetTime() - Start;
+		if (Counts < Best[0U]) {
+			Best[0U] = Counts;
+		}
+	}
+	MemBench_Result("dcache_flush_all", Len, "ns",
+		MemBench_Ns(Bench, Best[0U], 1U));
+
+	/*
+	 * Range flush cost grows linearly with the size, break even is where
+	 * it reaches the cost of flushing the whole, fully dirty, cache. 0 if
+	 * the largest range measured is still cheaper.
+	 */
+	Threshold = 0U;
+	if ((RangeCounts > Best[0U]) && (RangeLen != 0U)) {
+		Threshold = (u32)(((u64)RangeLen * Best[0U]) / RangeCounts) &
+			~(MEM_BENCH_LINE_SIZE - 1U);
+	}
+	MemBench_Result("dcache_range_threshold", 0U, "bytes", Threshold);
+	MemBench_Result("dcache_range_threshold_default", 0U, "bytes",
+		Xil_DCacheGetRangeThreshold());
+}
+
+/*****************************************************************************/
+/**
+*
+* Measures a DMA engine copying from the lower to the upper half of the work
+* area, for power of 4 sizes from MEM_BENCH_DMA_MIN up to MaxLen. Both halves
+* are flushed before and the destination invalidated after, outside of the
+* timing.
+*
+* @param	Bench is the benchmark configuration.
+* @param	Test is the name of the test in the results.
+* @param	Fn starts a transfer of DmaArgs and polls for its completion.
+* @param	Inst is passed to Fn.
+* @param	MaxLen is the largest transfer the engine supports.
+*
+* @return	None.
+*
+******************************************************************************/
+static void MemBench_Dma(const MemBench *Bench, const char8 *Test,
+	MemBench_Fn Fn, void *Inst, u32 MaxLen)
+{
+	u32 Half = (Bench->Size >> 1U) & ~(MEM_BENCH_LINE_SIZE - 1U);
+	u32 Iters;
+	u64 Counts;
+
+	Xil_MemSet(Bench->Buf, 0xA5, Half);
+	Xil_DCacheFlushRange((INTPTR)Bench->Buf, Bench->Size);
+	DmaArgs.Src = (UINTPTR)Bench->Buf;
+	DmaArgs.Dst = (UINTPTR)Bench->Buf + Half;
+	for (DmaArgs.Len = MEM_BENCH_DMA_MIN; (DmaArgs.Len <= Half) &&
+		(DmaArgs.Len <= MaxLen); DmaArgs.Len <<= 2U) {
+		Counts = MemBench_Measure(Bench, Fn, Inst, &Iters);
+		MemBench_Result(Test, DmaArgs.Len, "mbps",
+			MemBench_Mbps(Bench, (u64)DmaArgs.Len * Iters, Counts));
+	}
+	Xil_DCacheInvalidateRange((INTPTR)DmaArgs.Dst, Half);
+}
+
+#if defined(XPAR_XZDMA_NUM_INSTANCES)
+/*****************************************************************************/
+/**
+*
+* Sets up MEM_BENCH_ZDMA_DEVICE_ID in simple normal mode without interrupts
+* and measures it.
+*
+* @param	Bench is the benchmark configuration.
+*
+* @return	XST_SUCCESS if measured, otherwise XST_FAILURE.
+*
+******************************************************************************/
+static s32 MemBench_ZDma(const MemBench *Bench)
+{
+	XZDma_Config *Config;
+	XZDma_DataConfig Configure;
+	s32 Status = XST_FAILURE;
+
+	Config = XZDma_LookupConfig(MEM_BENCH_ZDMA_DEVICE_ID);
+	if (Config == NULL) {
+		goto END;
+	}
+	Status = XZDma_CfgInitialize(&ZDma, Config, Config->BaseAddress);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+	Status = XZDma_SetMode(&ZDma, FALSE, XZDMA_NORMAL_MODE);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
+	Configure.OverFetch = 1;
+	Configure.SrcIssue = 0x1F;
+	Configure.SrcBurstType = XZDMA_INCR_BURST;
+	Configure.SrcBurstLen = 0xF;
+	Configure.DstBurstType = XZDMA_INCR_BURST;
+	Configure.DstBurstLen = 0xF;
+	Configure.SrcCache = 0x2;
+	Configure.DstCache = 0x2;
+	if (Config->IsCacheCoherent) {
+		Configure.SrcCache = 0xF;
+		Configure.DstCache = 0xF;
+	}
+	Configure.SrcQos = 0;
+	Configure.DstQos = 0;
+	XZDma_SetChDataConfig(&ZDma, &Configure);
+	XZDma_DisableIntr(&ZDma, XZDMA_IXR_ALL_INTR_MASK);
+
+	MemBench_Dma(Bench, "zdma", MemBench_ZDmaCopy, &ZDma, 0x40000000U);
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+static void MemBench_ZDmaCopy(void *Arg)
+{
+	XZDma *InstancePtr = Arg;
+	XZDma_Transfer Data;
+
+	Data.SrcAddr = DmaArgs.Src;
+	Data.DstAddr = DmaArgs.Dst;
+	Data.Size = DmaArgs.Len;
+	Data.SrcCoherent = 1;
+	Data.DstCoherent = 1;
+	Data.Pause = 0;
+	(void)XZDma_Start(InstancePtr, &Data, 1U);
+	/* Checks the channel done status, also for simple mode transfers */
+	while (XZDma_ChainPollDone(InstancePtr, NULL) != XST_SUCCESS) {
+		/* Wait */
+	}
+}
+#endif
+
+#if defined(XPAR_XAXICDMA_NUM_INSTANCES)
+/*****************************************************************************/
+/**
+*
+* Sets up MEM_BENCH_CDMA_DEVICE_ID without interrupts, checks that it can
+* reach the work area and measures it.
+*
+* @param	Bench is the benchmark configuration.
+*
+* @return	XST_SUCCESS if measured, otherwise XST_FAILURE.
+*
+******************************************************************************/
+static s32 MemBench_Cdma(const MemBench *Bench)
+{
+	XAxiCdma_Config *Config;
+	s32 Status = XST_FAILURE;
+
+	Config = XAxiCdma_LookupConfig(MEM_BENCH_CDMA_DEVICE_ID);
+	if (Config == NULL) {
+		goto END;
+	}
+	if (XAxiCdma_CfgInitialize(&Cdma, Config, Config->BaseAddress) !=
+		(u32)XST_SUCCESS) {
+		goto END;
+	}
+	XAxiCdma_IntrDisable(&Cdma, XAXICDMA_XR_IRQ_ALL_MASK);
+
+	/* A decode error here means the work area is not mapped for the CDMA */
+	DmaArgs.Src = (UINTPTR)Bench->Buf;
+	DmaArgs.Dst = (UINTPTR)Bench->Buf + (Bench->Size >> 1U);
+	DmaArgs.Len = MEM_BENCH_DMA_MIN;
+	Xil_DCacheFlushRange((INTPTR)Bench->Buf, Bench->Size);
+	MemBench_CdmaCopy(&Cdma);
+	if (XAxiCdma_GetError(&Cdma) != 0U) {
+		XAxiCdma_Reset(&Cdma);
+		goto END;
+	}
+
+	MemBench_Dma(Bench, "cdma", MemBench_CdmaCopy, &Cdma,
+		XAXICDMA_MAX_TRANSFER_LEN);
+	Status = XST_SUCCESS;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+static void MemBench_CdmaCopy(void *Arg)
+{
+	XAxiCdma *InstancePtr = Arg;
+
+	(void)XAxiCdma_SimpleTransfer(InstancePtr, DmaArgs.Src, DmaArgs.Dst,
+		(int)DmaArgs.Len, NULL, NULL);
+	while (XAxiCdma_IsBusy(InstancePtr)) {
+		/* Wait */
+	}
+}
+#endif
+
+#if defined(XPAR_XAXIDMA_NUM_INSTANCES) && defined(MEM_BENCH_AXIDMA_LOOPBACK)
+/*****************************************************************************/
+/**
+*
+* Sets up MEM_BENCH_AXIDMA_DEVICE_ID in simple mode without interrupts and
+* measures it. The MM2S stream must be looped back to S2MM in the design.
+*
+* @param	Bench is the benchmark configuration.
+*
+* @return	XST_SUCCESS if measured, otherwise XST_FAILURE.
+*
+******************************************************************************/
+static s32 MemBench_AxiDma(const MemBench *Bench)
+{
+	XAxiDma_Config *Config;
+	u32 MaxLen;
+	s32 Status = XST_FAILURE;
+
+	Config = XAxiDma_LookupConfig(MEM_BENCH_AXIDMA_DEVICE_ID);
+	if (Config == NULL) {
+		goto END;
+	}
+	if (XAxiDma_CfgInitialize(&AxiDma, Config) != XST_SUCCESS) {
+		goto END;
+	}
+	if (XAxiDma_HasSg(&AxiDma)) {
+		goto END;
+	}
+	XAxiDma_IntrDisable(&AxiDma, XAXIDMA_IRQ_ALL_MASK,
+		XAXIDMA_DEVICE_TO_DMA);
+	XAxiDma_IntrDisable(&AxiDma, XAXIDMA_IRQ_ALL_MASK,
+		XAXIDMA_DMA_TO_DEVICE);
+
+	MaxLen = AxiDma.TxBdRing.MaxTransferLen;
+	if (AxiDma.RxBdRing[0].MaxTransferLen < MaxLen) {
+		MaxLen = AxiDma.RxBdRing[0].MaxTransferLen;
+	}
+	MemBench_Dma(Bench, "axidma", MemBench_AxiDmaCopy, &AxiDma, MaxLen);
+	Status = XST_SUCCESS;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+static void MemBench_AxiDmaCopy(void *Arg)
+{
+	XAxiDma *InstancePtr = Arg;
+
+	/* Receive side first, so the looped back stream is never stalled */
+	(void)XAxiDma_SimpleTransfer(InstancePtr, DmaArgs.Dst, DmaArgs.Len,
+		XAXIDMA_DEVICE_TO_DMA);
+	(void)XAxiDma_SimpleTransfer(InstancePtr, DmaArgs.Src, DmaArgs.Len,
+		XAXIDMA_DMA_TO_DEVICE);
+	while ((XAxiDma_Busy(InstancePtr, XAXIDMA_DMA_TO_DEVICE) != 0U) ||
+		(XAxiDma_Busy(InstancePtr, XAXIDMA_DEVICE_TO_DMA) != 0U)) {
+		/* Wait */
+	}
+}
+#endif
@@ -0,0 +1,83 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file mem_bench.h
+*
+* Processor independent core of the memory benchmark. It only needs
+* xil_types.h and Xil_MemCpy, so it is built unchanged for the target by
+* mem_bench.c and for host or Linux by misc/mem_bench_host.c.
+*
+* Every result is reported through MemBench_Result(), which the platform
+* prints as one line:
+*
+*	mem_bench,<test>,<param>,<metric>,<value>
+*
+* param is the working set or transfer size in bytes. All values are
+* integers so that xil_printf can print them and the lines can be compared
+* with a script across boards and BSP versions.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -----------------------------------------------
+* 1.00  ant  10/18/26 Initial release
+* </pre>
+*
+******************************************************************************/
+
+#ifndef MEM_BENCH_H
+#define MEM_BENCH_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+#include "xil_types.h"
+
+/************************** Constant Definitions *****************************/
+#define MEM_BENCH_LINE_SIZE	64U	/* Stride of the latency test */
+#define MEM_BENCH_REPEAT	5U	/* Best of, as STREAM does */
+#define MEM_BENCH_MIN_SIZE	4096U	/* Smallest working set */
+
+/**************************** Type Definitions *******************************/
+
+/* Returns a free running time stamp */
+typedef u64 (*MemBench_TimeFn)(void);
+
+/* Work timed by MemBench_Measure() */
+typedef void (*MemBench_Fn)(void *Arg);
+
+typedef struct {
+	MemBench_TimeFn GetTime;
+	u64 Freq;		/* Time stamp counts per second */
+	u8 *Buf;		/* Work area, MEM_BENCH_LINE_SIZE aligned */
+	u32 Size;		/* Work area size in bytes */
+	u32 MinMs;		/* Minimum duration of a measurement */
+} MemBench;
+
+/************************** Function Prototypes ******************************/
+
+/* Implemented by the platform */
+void MemBench_Result(const char8 *Test, u32 Param, const char8 *Metric,
+	u32 Value);
+
+u64 MemBench_Measure(const MemBench *Bench, MemBench_Fn Fn, void *Arg,
+	u32 *Iters);
+u32 MemBench_Mbps(const MemBench *Bench, u64 Bytes, u64 Counts);
+u32 MemBench_Ns(const MemBench *Bench, u64 Counts, u64 Ops);
+void MemBench_Stream(const MemBench *Bench);
+void MemBench_Latency(const MemBench *Bench);
+void MemBench_MemCpy(const MemBench *Bench);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MEM_BENCH_H */
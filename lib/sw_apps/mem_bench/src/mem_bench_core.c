@@ -0,0 +1,409 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file mem_bench_core.c
+*
+* Processor independent part of the memory benchmark:
+*
+* - stream_copy/scale/add/triad: STREAM kernels on double arrays, for
+*   working sets from MEM_BENCH_MIN_SIZE up to the whole work area, so
+*   that every cache level and the DDR show up. Bytes moved are counted
+*   the way STREAM counts them, the best of MEM_BENCH_REPEAT runs is kept.
+* - latency: pointer chase through a random cyclic permutation of
+*   MEM_BENCH_LINE_SIZE lines, so every load depends on the previous one
+*   and prefetchers can not guess the next line. Reported in ps per load.
+* - memcpy_*: Xil_MemCpy for sizes from 16 bytes up, aligned and with
+*   source, destination or both misaligned, and the C library memcpy
+*   aligned as a reference.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -----------------------------------------------
+* 1.00  ant  10/18/26 Initial release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <string.h>
+#include "mem_bench.h"
+#include "xil_mem.h"
+
+/************************** Constant Definitions *****************************/
+#define MEM_BENCH_MAX_ITERS	(1UL << 24U)
+#define MEM_BENCH_MIN_STEPS	1024U
+#define MEM_BENCH_MEMCPY_MIN	16U
+#define MEM_BENCH_MEMCPY_MAX	(1U << 20U)
+#define MEM_BENCH_SCALAR	3.0
+
+/**************************** Type Definitions *******************************/
+typedef struct {
+	double *A;
+	double *B;
+	double *C;
+	UINTPTR Count;
+} MemBench_StreamArgs;
+
+typedef struct {
+	UINTPTR *Next;
+	u32 Steps;
+} MemBench_ChaseArgs;
+
+typedef struct {
+	u8 *Dst;
+	const u8 *Src;
+	u32 Len;
+} MemBench_CopyArgs;
+
+typedef struct {
+	const char8 *Test;
+	MemBench_Fn Fn;
+	u32 Arrays;	/* Arrays read or written per element */
+} MemBench_Kernel;
+
+typedef struct {
+	const char8 *Test;
+	u32 DstOffset;
+	u32 SrcOffset;
+} MemBench_Align;
+
+/************************** Function Prototypes ******************************/
+static void MemBench_Copy(void *Arg);
+static void MemBench_Scale(void *Arg);
+static void MemBench_Add(void *Arg);
+static void MemBench_Triad(void *Arg);
+static void MemBench_Chase(void *Arg);
+static void MemBench_XilCopy(void *Arg);
+static void MemBench_LibcCopy(void *Arg);
+
+/************************** Variable Definitions *****************************/
+static const MemBench_Kernel StreamKernels[] = {
+	{ "stream_copy", MemBench_Copy, 2U },
+	{ "stream_scale", MemBench_Scale, 2U },
+	{ "stream_add", MemBench_Add, 3U },
+	{ "stream_triad", MemBench_Triad, 3U },
+};
+
+static const MemBench_Align CopyAligns[] = {
+	{ "memcpy_aligned", 0U, 0U },
+	{ "memcpy_dst_unaligned", 1U, 0U },
+	{ "memcpy_src_unaligned", 0U, 3U },
+	{ "memcpy_both_unaligned", 5U, 5U },
+};
+
+/*****************************************************************************/
+/**
+*
+* Runs Fn repeatedly and returns the time of the fastest run. The number of
+* calls in a run is doubled until a run takes at least MinMs, so that the
+* time stamp resolution does not matter for small working sets.
+*
+* @param	Bench is the benchmark configuration.
+* @param	Fn is the work to time.
+* @param	Arg is passed to Fn.
+* @param	Iters returns the number of calls in a run.
+*
+* @return	Time stamp counts of the fastest of MEM_BENCH_REPEAT runs.
+*
+******************************************************************************/
+u64 MemBench_Measure(const MemBench *Bench, MemBench_Fn Fn, void *Arg,
+	u32 *Iters)
+{
+	u64 MinCounts = (Bench->Freq * Bench->MinMs) / 1000U;
+	u64 Best = ~0ULL;
+	u64 Start;
+	u64 Counts;
+	u32 Count = 1U;
+	u32 Index;
+	u32 Run;
+
+	/* Calibrate, this also warms up the caches */
+	for (;;) {
+		Start = Bench->GetTime();
+		for (Index = 0U; Index < Count; Index++) {
+			Fn(Arg);
+		}
+		Counts = Bench->GetTime() - Start;
+		if ((Counts >= MinCounts) || (Count >= MEM_BENCH_MAX_ITERS)) {
+			break;
+		}
+		Count <<= 1U;
+	}
+
+	for (Run = 0U; Run < MEM_BENCH_REPEAT; Run++) {
+		Start = Bench->GetTime();
+		for (Index = 0U; Index < Count; Index++) {
+			Fn(Arg);
+		}
+		Counts = Bench->GetTime() - Start;
+		if (Counts < Best) {
+			Best = Counts;
+		}
+	}
+
+	*Iters = Count;
+	return (Best != 0U) ? Best : 1U;
+}
+
+/*****************************************************************************/
+/**
+*
+* Converts bytes moved in Counts time stamp counts to MB/s (10^6 bytes).
+*
+******************************************************************************/
+u32 MemBench_Mbps(const MemBench *Bench, u64 Bytes, u64 Counts)
+{
+	return (u32)((Bytes * (Bench->Freq / 1000U)) / (Counts * 1000U));
+}
+
+/*****************************************************************************/
+/**
+*
+* Converts Counts time stamp counts taken by Ops operations to ns per
+* operation.
+*
+******************************************************************************/
+u32 MemBench_Ns(const MemBench *Bench, u64 Counts, u64 Ops)
+{
+	return (u32)(((Counts * 1000000U) / Ops) * 1000U / Bench->Freq);
+}
+
+/*****************************************************************************/
+/**
+*
+* Runs the STREAM kernels. The work area is split in three arrays, the
+* working set is the size of the three together.
+*
+* @param	Bench is the benchmark configuration.
+*
+* @return	None.
+*
+******************************************************************************/
+void MemBench_Stream(const MemBench *Bench)
+{
+	MemBench_StreamArgs Args;
+	UINTPTR Max = Bench->Size / (3U * sizeof(double));
+	UINTPTR Index;
+	u32 Set;
+	u32 Kernel;
+	u32 Iters;
+	u64 Counts;
+
+	for (Set = MEM_BENCH_MIN_SIZE; Set <= Bench->Size; Set <<= 1U) {
+		Args.Count = Set / (3U * sizeof(double));
+		Args.A = (double *)(void *)Bench->Buf;
+		Args.B = Args.A + Max;
+		Args.C = Args.B + Max;
+		for (Index = 0U; Index < Args.Count; Index++) {
+			Args.A[Index] = 1.0;
+			Args.B[Index] = 2.0;
+			Args.C[Index] = 0.0;
+		}
+
+		for (Kernel = 0U; Kernel < (sizeof(StreamKernels) /
+			sizeof(StreamKernels[0])); Kernel++) {
+			Counts = MemBench_Measure(Bench, StreamKernels[Kernel].Fn,
+				&Args, &Iters);
+			MemBench_Result(StreamKernels[Kernel].Test, Set, "mbps",
+				MemBench_Mbps(Bench, (u64)Args.Count * Iters *
+				StreamKernels[Kernel].Arrays * sizeof(double),
+				Counts));
+		}
+
+		if (Set > (Bench->Size >> 1U)) {
+			break;
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* Measures the load to use latency for working sets from MEM_BENCH_MIN_SIZE
+* up to the whole work area.
+*
+* Every line holds the address of the next line in the chase. Sattolo's
+* shuffle of the line indices gives a single cycle through all the lines,
+* the indices are then replaced with addresses in place.
+*
+* @param	Bench is the benchmark configuration.
+*
+* @return	None.
+*
+******************************************************************************/
+void MemBench_Latency(const MemBench *Bench)
+{
+	MemBench_ChaseArgs Args;
+	const u32 Stride = MEM_BENCH_LINE_SIZE / sizeof(UINTPTR);
+	UINTPTR *Lines = (UINTPTR *)(void *)Bench->Buf;
+	u32 Seed = 0x2545F491U;
+	u32 NumLines;
+	u32 Set;
+	u32 Index;
+	u32 Other;
+	u32 Iters;
+	UINTPTR Tmp;
+	u64 Counts;
+
+	for (Set = MEM_BENCH_MIN_SIZE; Set <= Bench->Size; Set <<= 1U) {
+		NumLines = Set / MEM_BENCH_LINE_SIZE;
+		for (Index = 0U; Index < NumLines; Index++) {
+			Lines[Index * Stride] = Index;
+		}
+		for (Index = NumLines - 1U; Index > 0U; Index--) {
+			/* Same seed every run, so every run chases the same cycle */
+			Seed = (Seed * 1664525U) + 1013904223U;
+			Other = (u32)(((u64)Seed * Index) >> 32U);
+			Tmp = Lines[Index * Stride];
+			Lines[Index * Stride] = Lines[Other * Stride];
+			Lines[Other * Stride] = Tmp;
+		}
+		for (Index = 0U; Index < NumLines; Index++) {
+			Lines[Index * Stride] =
+				(UINTPTR)&Lines[Lines[Index * Stride] * Stride];
+		}
+
+		Args.Next = Lines;
+		Args.Steps = (NumLines < MEM_BENCH_MIN_STEPS) ?
+			MEM_BENCH_MIN_STEPS : NumLines;
+		Counts = MemBench_Measure(Bench, MemBench_Chase, &Args, &Iters);
+		/* Counts per 10^6 loads first, keeps ps within 64 bits */
+		MemBench_Result("latency", Set, "ps", (u32)((((Counts * 1000000U) /
+			((u64)Args.Steps * Iters)) * 1000000U) / Bench->Freq));
+
+		if (Set > (Bench->Size >> 1U)) {
+			break;
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* Measures Xil_MemCpy for power of 4 sizes and the alignments in CopyAligns.
+* Source is the lower half of the work area and destination the upper half.
+*
+* @param	Bench is the benchmark configuration.
+*
+* @return	None.
+*
+******************************************************************************/
+void MemBench_MemCpy(const MemBench *Bench)
+{
+	MemBench_CopyArgs Args;
+	u32 Half = (Bench->Size >> 1U) & ~(MEM_BENCH_LINE_SIZE - 1U);
+	u32 Len;
+	u32 Align;
+	u32 Iters;
+	u64 Counts;
+
+	Xil_MemSet(Bench->Buf, 0x5A, Bench->Size);
+	for (Len = MEM_BENCH_MEMCPY_MIN; (Len <= MEM_BENCH_MEMCPY_MAX) &&
+		((Len + MEM_BENCH_LINE_SIZE) <= Half); Len <<= 2U) {
+		Args.Len = Len;
+		for (Align = 0U; Align < (sizeof(CopyAligns) /
+			sizeof(CopyAligns[0])); Align++) {
+			Args.Dst = Bench->Buf + Half + CopyAligns[Align].DstOffset;
+			Args.Src = Bench->Buf + CopyAligns[Align].SrcOffset;
+			Counts = MemBench_Measure(Bench, MemBench_XilCopy, &Args,
+				&Iters);
+			MemBench_Result(CopyAligns[Align].Test, Len, "mbps",
+				MemBench_Mbps(Bench, (u64)Len * Iters, Counts));
+		}
+
+		Args.Dst = Bench->Buf + Half;
+		Args.Src = Bench->Buf;
+		Counts = MemBench_Measure(Bench, MemBench_LibcCopy, &Args, &Iters);
+		MemBench_Result("memcpy_libc", Len, "mbps",
+			MemBench_Mbps(Bench, (u64)Len * Iters, Counts));
+	}
+}
+
+/*****************************************************************************/
+static void MemBench_Copy(void *Arg)
+{
+	const MemBench_StreamArgs *Args = Arg;
+	UINTPTR Index;
+
+	for (Index = 0U; Index < Args->Count; Index++) {
+		Args->C[Index] = Args->A[Index];
+	}
+}
+
+/*****************************************************************************/
+static void MemBench_Scale(void *Arg)
+{
+	const MemBench_StreamArgs *Args = Arg;
+	UINTPTR Index;
+
+	for (Index = 0U; Index < Args->Count; Index++) {
+		Args->B[Index] = MEM_BENCH_SCALAR * Args->C[Index];
+	}
+}
+
+/*****************************************************************************/
+static void MemBench_Add(void *Arg)
+{
+	const MemBench_StreamArgs *Args = Arg;
+	UINTPTR Index;
+
+	for (Index = 0U; Index < Args->Count; Index++) {
+		Args->C[Index] = Args->A[Index] + Args->B[Index];
+	}
+}
+
+/*****************************************************************************/
+static void MemBench_Triad(void *Arg)
+{
+	const MemBench_StreamArgs *Args = Arg;
+	UINTPTR Index;
+
+	for (Index = 0U; Index < Args->Count; Index++) {
+		Args->A[Index] = Args->B[Index] + (MEM_BENCH_SCALAR *
+			Args->C[Index]);
+	}
+}
+
+/*****************************************************************************/
+static void MemBench_Chase(void *Arg)
+{
+	MemBench_ChaseArgs *Args = Arg;
+	UINTPTR *Next = Args->Next;
+	u32 Steps;
+
+	for (Steps = Args->Steps; Steps >= 4U; Steps -= 4U) {
+		Next = (UINTPTR *)*Next;
+		Next = (UINTPTR *)*Next;
+		Next = (UINTPTR *)*Next;
+		Next = (UINTPTR *)*Next;
+	}
+	for (; Steps > 0U; Steps--) {
+		Next = (UINTPTR *)*Next;
+	}
+
+	/* Continue from here on the next call, also keeps the loads alive */
+	Args->Next = Next;
+}
+
+/*****************************************************************************/
+static void MemBench_XilCopy(void *Arg)
+{
+	const MemBench_CopyArgs *Args = Arg;
+
+	Xil_MemCpy(Args->Dst, Args->Src, Args->Len);
+}
+
+/*****************************************************************************/
+static void MemBench_LibcCopy(void *Arg)
+{
+	const MemBench_CopyArgs *Args = Arg;
+
+	(void)memcpy(Args->Dst, Args->Src, Args->Len);
+}
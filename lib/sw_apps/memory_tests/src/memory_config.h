@@ -16,6 +16,26 @@ struct memory_range_s {
 
 #define UPPER_4BYTES_MASK	0xFFFFFFFF00000000LL
 #define LOWER_4BYTES_MASK	0xFFFFFFFFUL
+
+/*
+ * 64-bit test covers the whole region, testing every MEMTEST_STRIDE th
+ * 64-bit word. Set MEMTEST_STRIDE to 0 to skip it.
+ */
+#ifndef MEMTEST_STRIDE
+#define MEMTEST_STRIDE		1U
+#endif
+
+/*
+ * To screen memory faster, build this application for several cores with
+ * the same MEMTEST_NUM_PARTS and a different MEMTEST_PART on each, every core
+ * then tests its own part of each region in parallel.
+ */
+#ifndef MEMTEST_NUM_PARTS
+#define MEMTEST_NUM_PARTS	1U
+#endif
+#ifndef MEMTEST_PART
+#define MEMTEST_PART		0U
+#endif
 /* generated memory ranges defined in memory_ranges_g.c */
 extern struct memory_range_s memory_ranges[];
 extern int n_memory_ranges;
@@ -12,6 +12,9 @@
 #include "platform.h"
 #include "memory_config.h"
 #include "xil_printf.h"
+#if defined(__arm__) || defined(__aarch64__)
+#include "xtime_l.h"
+#endif
 
 /*
  * memory_test.c: Test memory ranges present in the Hardware Design.
@@ -26,8 +29,52 @@
 
 void putnum(unsigned int num);
 
+#if !(defined(__MICROBLAZE__) && !defined(__arch64__) && (XPAR_MICROBLAZE_ADDR_SIZE > 32))
+/*
+ * Full range test with 64-bit accesses. All errors are counted, the first one
+ * is reported along with the bandwidth achieved on ARM.
+ */
+static void test_memory_range_64(UINTPTR base, u32 size) {
+    XTestMem_Result result;
+    s32 status;
+#if defined(__arm__) || defined(__aarch64__)
+    XTime start;
+    XTime end;
+    u64 usecs;
+#endif
+
+    if (size < 8U) {
+        return;
+    }
+
+#if defined(__arm__) || defined(__aarch64__)
+    XTime_GetTime(&start);
+#endif
+    status = Xil_TestMem64((u64 *)base, size / 8U, MEMTEST_STRIDE,
+                           0xAAAA5555AAAA5555ULL, XIL_TESTMEM_ALLMEMTESTS,
+                           &result);
+    print("          64-bit test: "); print(status == 0 ? "PASSED!":"FAILED!");
+#if defined(__arm__) || defined(__aarch64__)
+    XTime_GetTime(&end);
+    usecs = ((u64)(end - start) * 1000000U) / COUNTS_PER_SECOND;
+    if (usecs != 0U) {
+        xil_printf(" %d MB/s", (u32)(result.Bytes / usecs));
+    }
+#endif
+    print("\n\r");
+    if (status != 0) {
+        xil_printf("               Errors: %d, first at 0x%lx, expected 0x%08x%08x read 0x%08x%08x\n\r",
+                   (u32)result.Errors, result.FailAddr,
+                   (u32)(result.Expected >> 32U), (u32)result.Expected,
+                   (u32)(result.Actual >> 32U), (u32)result.Actual);
+    }
+}
+#endif
+
 void test_memory_range(struct memory_range_s *range) {
     XStatus status;
+    u64 base;
+    u32 size;
 
     /* This application uses print statements instead of xil_printf/printf
      * to reduce the text size.
@@ -53,24 +100,38 @@ void test_memory_range(struct memory_range_s *range) {
         xil_printf("                 Size: 0x%lx bytes \n\r",range->size);
     #endif
 
+    /* Each core running this application tests its own 8 byte aligned part */
+    size = (range->size / MEMTEST_NUM_PARTS) & ~7U;
+    base = range->base + ((u64)size * MEMTEST_PART);
+    if (MEMTEST_PART == (MEMTEST_NUM_PARTS - 1U)) {
+        size = range->size - (size * MEMTEST_PART);
+    }
+    if (MEMTEST_NUM_PARTS > 1U) {
+        print("                 Part: "); putnum(MEMTEST_PART); print("\n\r");
+    }
+
 #if defined(__MICROBLAZE__) && !defined(__arch64__) && (XPAR_MICROBLAZE_ADDR_SIZE > 32)
-    status = Xil_TestMem32((range->base & LOWER_4BYTES_MASK), ((range->base & UPPER_4BYTES_MASK) >> 32), 1024, 0xAAAA5555, XIL_TESTMEM_ALLMEMTESTS);
+    status = Xil_TestMem32((base & LOWER_4BYTES_MASK), ((base & UPPER_4BYTES_MASK) >> 32), 1024, 0xAAAA5555, XIL_TESTMEM_ALLMEMTESTS);
     print("          32-bit test: "); print(status == XST_SUCCESS? "PASSED!":"FAILED!"); print("\n\r");
 
-    status = Xil_TestMem16((range->base & LOWER_4BYTES_MASK), ((range->base & UPPER_4BYTES_MASK) >> 32), 2048, 0xAA55, XIL_TESTMEM_ALLMEMTESTS);
+    status = Xil_TestMem16((base & LOWER_4BYTES_MASK), ((base & UPPER_4BYTES_MASK) >> 32), 2048, 0xAA55, XIL_TESTMEM_ALLMEMTESTS);
     print("          16-bit test: "); print(status == XST_SUCCESS? "PASSED!":"FAILED!"); print("\n\r");
 
-    status = Xil_TestMem8((range->base & LOWER_4BYTES_MASK), ((range->base & UPPER_4BYTES_MASK) >> 32), 4096, 0xA5, XIL_TESTMEM_ALLMEMTESTS);
+    status = Xil_TestMem8((base & LOWER_4BYTES_MASK), ((base & UPPER_4BYTES_MASK) >> 32), 4096, 0xA5, XIL_TESTMEM_ALLMEMTESTS);
     print("           8-bit test: "); print(status == XST_SUCCESS? "PASSED!":"FAILED!"); print("\n\r");
 #else
-    status = Xil_TestMem32((u32*)range->base, 1024, 0xAAAA5555, XIL_TESTMEM_ALLMEMTESTS);
+    status = Xil_TestMem32((u32*)(UINTPTR)base, 1024, 0xAAAA5555, XIL_TESTMEM_ALLMEMTESTS);
     print("          32-bit test: "); print(status == XST_SUCCESS? "PASSED!":"FAILED!"); print("\n\r");
 
-    status = Xil_TestMem16((u16*)range->base, 2048, 0xAA55, XIL_TESTMEM_ALLMEMTESTS);
+    status = Xil_TestMem16((u16*)(UINTPTR)base, 2048, 0xAA55, XIL_TESTMEM_ALLMEMTESTS);
     print("          16-bit test: "); print(status == XST_SUCCESS? "PASSED!":"FAILED!"); print("\n\r");
 
-    status = Xil_TestMem8((u8*)range->base, 4096, 0xA5, XIL_TESTMEM_ALLMEMTESTS);
+    status = Xil_TestMem8((u8*)(UINTPTR)base, 4096, 0xA5, XIL_TESTMEM_ALLMEMTESTS);
     print("           8-bit test: "); print(status == XST_SUCCESS? "PASSED!":"FAILED!"); print("\n\r");
+
+    if (MEMTEST_STRIDE != 0U) {
+        test_memory_range_64((UINTPTR)base, size);
+    }
 #endif
 
 }
@@ -0,0 +1,324 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file plm_trace_decode.c
+*
+* Host utility which decodes a dump of the PLM Trace Log buffer and prints the
+* boot timeline. Boot trace event records (XPLMI_TRACE_LOG_EVENT) carry raw
+* PIT cycles which are converted to time with the PMC IRO frequency logged by
+* PLM, BEGIN and END events are paired to report durations.
+*
+* The dump is a little endian binary file of the buffer, as written by the
+* retrieve trace data event logging command or read from the Trace Log buffer
+* in PMC RAM.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date        Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.00  ant  10/18/2026 Initial release
+*
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+/************************** Constant Definitions *****************************/
+/* Must match xplmi_event_logging.h */
+#define TRACE_LOG_LOAD_IMAGE	(0x1U)
+#define TRACE_LOG_TASK_STATS	(0x2U)
+#define TRACE_LOG_EVENT		(0x3U)
+#define TRACE_LOG_LEN_SHIFT	(16U)
+#define TRACE_LOG_HDR_LEN	(3U)
+#define TRACE_LOG_MAX_LEN	(64U)
+#define TRACE_EVENT_LEN		(6U)
+
+#define TRACE_INSTANT		(0x0U)
+#define TRACE_BEGIN		(0x1U)
+#define TRACE_END		(0x2U)
+#define TRACE_SPAN		(0x3U)
+
+#define MODULE_GENERIC_ID	(1U)
+#define MODULE_XILPM_ID		(2U)
+#define MODULE_LOADER_ID	(7U)
+
+#define TRACE_EVT_CLOCK		(0x1U)
+
+#define DEFAULT_IRO_FREQ	(320000000U)
+#define MAX_OPEN_EVENTS		(32U)
+
+/**************************** Type Definitions *******************************/
+typedef struct {
+	uint32_t Module;
+	uint32_t Event;
+	const char *Name;
+} EventName;
+
+typedef struct {
+	uint32_t Id;
+	uint32_t Arg1;
+	uint64_t Time;
+} OpenEvent;
+
+/************************** Variable Definitions *****************************/
+static const EventName EventNames[] = {
+	{MODULE_GENERIC_ID, 0x1U, "clock"},
+	{MODULE_GENERIC_ID, 0x2U, "cdo_chunk"},
+	{MODULE_GENERIC_ID, 0x3U, "cdo_cmd"},
+	{MODULE_GENERIC_ID, 0x4U, "dma_wait"},
+	{MODULE_XILPM_ID, 0x1U, "node_state"},
+	{MODULE_LOADER_ID, 0x1U, "image"},
+	{MODULE_LOADER_ID, 0x2U, "partition"},
+	{MODULE_LOADER_ID, 0x3U, "sign_verify"},
+	{MODULE_LOADER_ID, 0x4U, "aes_decrypt"},
+	{MODULE_LOADER_ID, 0x5U, "flash_read"},
+};
+
+static const char *ModuleNames[] = {
+	"", "plmi", "pm", "sem", "", "secure", "psm", "loader", "error", "",
+	"stl", "nvm", "puf",
+};
+
+static const char *PhaseNames[] = {"", "begin", "end", "span"};
+
+static OpenEvent OpenEvents[MAX_OPEN_EVENTS];
+static uint32_t NumOpenEvents;
+static double IroFreq = DEFAULT_IRO_FREQ;
+
+/*****************************************************************************/
+static const char *GetModuleName(uint32_t Module)
+{
+	const char *Name = "?";
+
+	if ((Module < (sizeof(ModuleNames) / sizeof(ModuleNames[0]))) &&
+	    (ModuleNames[Module][0] != '\0')) {
+		Name = ModuleNames[Module];
+	}
+
+	return Name;
+}
+
+/*****************************************************************************/
+static const char *GetEventName(uint32_t Module, uint32_t Event)
+{
+	uint32_t Index;
+
+	for (Index = 0U; Index < (sizeof(EventNames) / sizeof(EventNames[0]));
+	     Index++) {
+		if ((EventNames[Index].Module == Module) &&
+		    (EventNames[Index].Event == Event)) {
+			return EventNames[Index].Name;
+		}
+	}
+
+	return "?";
+}
+
+/*****************************************************************************/
+static double CyclesToMs(uint64_t Cycles)
+{
+	return ((double)Cycles * 1000.0) / IroFreq;
+}
+
+/*****************************************************************************/
+/**
+ * Returns the duration of the matching BEGIN event in PIT cycles and removes
+ * it, or -1 if the BEGIN event is not present in the dump.
+ *****************************************************************************/
+static int64_t CloseEvent(uint32_t Id, uint32_t Arg1, uint64_t Time)
+{
+	uint32_t Index = NumOpenEvents;
+
+	while (Index > 0U) {
+		Index--;
+		if ((OpenEvents[Index].Id == Id) &&
+		    (OpenEvents[Index].Arg1 == Arg1)) {
+			int64_t Duration = (int64_t)(Time - OpenEvents[Index].Time);
+
+			memmove(&OpenEvents[Index], &OpenEvents[Index + 1U],
+				(NumOpenEvents - Index - 1U) * sizeof(OpenEvent));
+			NumOpenEvents--;
+			return Duration;
+		}
+	}
+
+	return -1;
+}
+
+/*****************************************************************************/
+static void DecodeEvent(const uint32_t *Record)
+{
+	uint64_t Time = ((uint64_t)Record[1U] << 32U) | Record[2U];
+	uint32_t Module = Record[3U] >> 24U;
+	uint32_t Phase = (Record[3U] >> 16U) & 0xFFU;
+	uint32_t Event = Record[3U] & 0xFFFFU;
+	uint32_t Arg1 = Record[4U];
+	uint32_t Arg2 = Record[5U];
+	uint32_t Depth = NumOpenEvents;
+	int64_t Duration = -1;
+
+	if ((Module == MODULE_GENERIC_ID) && (Event == TRACE_EVT_CLOCK) &&
+	    (Arg1 != 0U)) {
+		IroFreq = (double)Arg1;
+	}
+
+	if (Phase == TRACE_BEGIN) {
+		if (NumOpenEvents < MAX_OPEN_EVENTS) {
+			OpenEvents[NumOpenEvents].Id = Record[3U] & 0xFF00FFFFU;
+			OpenEvents[NumOpenEvents].Arg1 = Arg1;
+			OpenEvents[NumOpenEvents].Time = Time;
+			NumOpenEvents++;
+		}
+	}
+	else if (Phase == TRACE_END) {
+		Duration = CloseEvent(Record[3U] & 0xFF00FFFFU, Arg1, Time);
+		Depth = NumOpenEvents;
+	}
+	else if (Phase == TRACE_SPAN) {
+		Duration = Arg2;
+	}
+
+	printf("%12.3f ", CyclesToMs(Time));
+	if (Duration >= 0) {
+		printf("%10.3f ", CyclesToMs((uint64_t)Duration));
+	}
+	else {
+		printf("%10s ", "");
+	}
+	printf("%*s%-6s %-12s %-5s 0x%08x 0x%08x\n", (int)(Depth * 2U), "",
+		GetModuleName(Module), GetEventName(Module, Event),
+		(Phase < 4U) ? PhaseNames[Phase] : "?", Arg1, Arg2);
+}
+
+/*****************************************************************************/
+static void DecodeLegacy(const uint32_t *Record, uint32_t Len)
+{
+	uint32_t Id = Record[0U] & 0xFFFFU;
+	uint32_t Index;
+
+	printf("%8u.%03u %10s %-6s %-12s", Record[1U], Record[2U], "", "plmi",
+		(Id == TRACE_LOG_LOAD_IMAGE) ? "load_image" : "task_stats");
+	for (Index = TRACE_LOG_HDR_LEN; Index < Len; Index++) {
+		printf(" 0x%08x", Record[Index]);
+	}
+	printf("\n");
+}
+
+/*****************************************************************************/
+static void Decode(const uint32_t *Buf, uint32_t NumWords)
+{
+	uint32_t Offset = 0U;
+	uint32_t Skipped = 0U;
+	uint32_t Id;
+	uint32_t Len;
+
+	printf("%12s %10s %-6s %-12s %-5s %-10s %-10s\n", "time(ms)", "dur(ms)",
+		"module", "event", "phase", "arg1", "arg2");
+	while (Offset < NumWords) {
+		Id = Buf[Offset] & 0xFFFFU;
+		Len = Buf[Offset] >> TRACE_LOG_LEN_SHIFT;
+
+		/*
+		 * Oldest record of a wrapped buffer can be partial and unused
+		 * buffer is not cleared, skip words till a valid header
+		 */
+		if ((Id < TRACE_LOG_LOAD_IMAGE) || (Id > TRACE_LOG_EVENT) ||
+		    (Len < TRACE_LOG_HDR_LEN) || (Len > TRACE_LOG_MAX_LEN) ||
+		    ((Id == TRACE_LOG_EVENT) && (Len != TRACE_EVENT_LEN)) ||
+		    ((Offset + Len) > NumWords)) {
+			Offset++;
+			Skipped++;
+			continue;
+		}
+
+		if (Id == TRACE_LOG_EVENT) {
+			DecodeEvent(&Buf[Offset]);
+		}
+		else {
+			DecodeLegacy(&Buf[Offset], Len);
+		}
+		Offset += Len;
+	}
+
+	if (Skipped != 0U) {
+		fprintf(stderr, "Skipped %u words without valid record\n",
+			Skipped);
+	}
+}
+
+/*****************************************************************************/
+int main(int argc, char *argv[])
+{
+	FILE *File;
+	long Size;
+	uint8_t *Bytes;
+	uint32_t *Buf;
+	uint32_t NumWords;
+	uint32_t Index;
+
+	if ((argc < 2) || (argc > 3)) {
+		fprintf(stderr, "Usage: %s <trace dump> [PMC IRO freq in Hz]\n"
+			"Frequency is taken from the trace if present, "
+			"default %u Hz\n", argv[0], DEFAULT_IRO_FREQ);
+		return 1;
+	}
+	if (argc == 3) {
+		IroFreq = strtod(argv[2], NULL);
+		if (IroFreq <= 0.0) {
+			fprintf(stderr, "Invalid frequency %s\n", argv[2]);
+			return 1;
+		}
+	}
+
+	File = fopen(argv[1], "rb");
+	if (File == NULL) {
+		perror(argv[1]);
+		return 1;
+	}
+	fseek(File, 0L, SEEK_END);
+	Size = ftell(File);
+	rewind(File);
+	if (Size <= 0) {
+		fprintf(stderr, "Empty trace dump\n");
+		fclose(File);
+		return 1;
+	}
+
+	NumWords = (uint32_t)Size / 4U;
+	Bytes = malloc((size_t)NumWords * 4U);
+	Buf = malloc((size_t)NumWords * sizeof(uint32_t));
+	if ((Bytes == NULL) || (Buf == NULL) ||
+	    (fread(Bytes, 4U, NumWords, File) != NumWords)) {
+		fprintf(stderr, "Failed to read %s\n", argv[1]);
+		fclose(File);
+		free(Bytes);
+		free(Buf);
+		return 1;
+	}
+	fclose(File);
+
+	/* Buffer is little endian irrespective of the host */
+	for (Index = 0U; Index < NumWords; Index++) {
+		Buf[Index] = (uint32_t)Bytes[Index * 4U] |
+			((uint32_t)Bytes[(Index * 4U) + 1U] << 8U) |
+			((uint32_t)Bytes[(Index * 4U) + 2U] << 16U) |
+			((uint32_t)Bytes[(Index * 4U) + 3U] << 24U);
+	}
+
+	Decode(Buf, NumWords);
+
+	free(Bytes);
+	free(Buf);
+	return 0;
+}
@@ -21,6 +21,7 @@
  *                     section
  * 3.0   bsv  05/03/21 Add provision to load bitstream from OCM with DDR
  *                     present in design
+ *       ant  10/18/26 Split XFsbl_WriteToPcap in start and wait steps
  *
  * </pre>
  *
@@ -167,8 +168,26 @@ u32 XFsbl_PcapWaitForDone(void) {
  *
  *****************************************************************************/
 u32 XFsbl_WriteToPcap(u32 WrSize, u8 *WrAddr) {
+	XFsbl_WriteToPcapStart(WrSize, WrAddr);
+
+	return XFsbl_WriteToPcapWait();
+}
+
+/*****************************************************************************/
+/** This function starts the CSU DMA transfer to PCAP interface and returns
+ * without waiting for it to complete. CSU DMA and SSS must not be used
+ * until XFsbl_WriteToPcapWait is called.
+ *
+ * @param	WrSize: Number of 32bit words that the DMA should write to
+ *          the PCAP interface
+ * @param   WrAddr: Linear memory space from where CSUDMA will read
+ *	        the data to be written to PCAP interface
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+void XFsbl_WriteToPcapStart(u32 WrSize, u8 *WrAddr) {
 	u32 RegVal;
-	u32 Status;
 
 	/*
 	 * Setup the  SSS, setup the PCAP to receive from DMA source
@@ -180,6 +199,19 @@ u32 XFsbl_WriteToPcap(u32 WrSize, u8 *WrAddr) {
 
 	/* Setup the source DMA channel */
 	XCsuDma_Transfer(&CsuDma, XCSUDMA_SRC_CHANNEL, (PTRSIZE) WrAddr, WrSize, 0);
+}
+
+/*****************************************************************************/
+/** This function waits for the CSU DMA transfer started by
+ * XFsbl_WriteToPcapStart to complete and for PCAP to be idle.
+ *
+ * @param	None
+ *
+ * @return	error status based on implemented functionality (SUCCESS by default)
+ *
+ *****************************************************************************/
+u32 XFsbl_WriteToPcapWait(void) {
+	u32 Status;
 
 	/* wait for the SRC_DMA to complete and the pcap to be IDLE */
 	XCsuDma_WaitForDone(&CsuDma, XCSUDMA_SRC_CHANNEL){}
@@ -19,6 +19,7 @@
 * 1.00  ba   11/17/14 Initial release
 * 2.0   bv   12/05/16 Made compliance to MISRAC 2012 guidelines
 *                     Modified bitstream chunk size to 56KB
+*       ant  10/18/26 Added XFsbl_WriteToPcapStart and XFsbl_WriteToPcapWait
 *
 * </pre>
 *
@@ -72,6 +73,8 @@ u32 XFsbl_ChunkedBSTxfer(XFsblPs *FsblInstancePtr, u32 PartitionNum);
 u32 XFsbl_PcapInit(void);
 u32 XFsbl_PLWaitForDone(void);
 u32 XFsbl_WriteToPcap(u32 WrSize, u8 *WrAddr);
+void XFsbl_WriteToPcapStart(u32 WrSize, u8 *WrAddr);
+u32 XFsbl_WriteToPcapWait(void);
 u32 XFsbl_PLCheckForDone(void);
 
 /************************** Variable Definitions *****************************/
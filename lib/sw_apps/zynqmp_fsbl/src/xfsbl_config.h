@@ -30,6 +30,10 @@
 *       bsv  05/15/21 Support to ensure authenticated images boot as
 *                     non-secure when RSA_EN is not programmed is disabled by
 *                     default
+*       ant  10/18/26 Added FSBL_PL_BACKGROUND_LOAD_EXCLUDE_VAL configuration
+*       ant  10/18/26 Added FSBL_PL_SIGNED_HASH_TABLE_EXCLUDE_VAL configuration
+*       ant  10/18/26 Added FSBL_COPY_HASH_OVERLAP_EXCLUDE_VAL configuration
+*                     and XFSBL_COPY_HASH_CHUNK_SIZE
 *
 *</pre>
 *
@@ -52,6 +56,14 @@ extern "C" {
 /* This is the address in DDR where boot.bin will be copied in USB boot mode */
 #define XFSBL_DDR_TEMP_BUFFER_ADDRESS			(0x4000000U)
 
+/**
+ * Size of the chunks in which a partition with SHA3 checksum is copied and
+ * hashed. It must be a multiple of SHA3 block length (104 bytes).
+ */
+#ifndef XFSBL_COPY_HASH_CHUNK_SIZE
+#define XFSBL_COPY_HASH_CHUNK_SIZE			(0xFFF0U)
+#endif
+
 /**************************** Type Definitions *******************************/
 
 /***************** Macros (Inline Functions) Definitions *********************/
@@ -138,6 +150,16 @@ extern "C" {
  *     - FSBL_UNPROVISIONED_AUTH_SIGN_EXCLUDE_VAL Code to "load authenticated
  *       partitions as non secure when EFUSEs are not programmed and when boot
  *       header is not authenticated" is excluded
+ *     - FSBL_PL_BACKGROUND_LOAD_EXCLUDE_VAL Code to load the following
+ *       partitions while a non secure bitstream is written to PCAP is
+ *       excluded
+ *     - FSBL_PL_SIGNED_HASH_TABLE_EXCLUDE_VAL Code to authenticate bitstream
+ *       blocks using the signed chunk hash table placed after each block's
+ *       authentication certificate is excluded. When included, boot image
+ *       must carry the hash tables and each block is read only once
+ *     - FSBL_COPY_HASH_OVERLAP_EXCLUDE_VAL Code to calculate SHA3 checksum
+ *       of a partition chunk while the next chunk is copied from the boot
+ *       device is excluded
  */
 #ifndef FSBL_NAND_EXCLUDE_VAL
 #define FSBL_NAND_EXCLUDE_VAL			(0U)
@@ -211,6 +233,18 @@ extern "C" {
 #define FSBL_UNPROVISIONED_AUTH_SIGN_EXCLUDE_VAL	(1U)
 #endif
 
+#ifndef FSBL_PL_BACKGROUND_LOAD_EXCLUDE_VAL
+#define FSBL_PL_BACKGROUND_LOAD_EXCLUDE_VAL	(1U)
+#endif
+
+#ifndef FSBL_PL_SIGNED_HASH_TABLE_EXCLUDE_VAL
+#define FSBL_PL_SIGNED_HASH_TABLE_EXCLUDE_VAL	(1U)
+#endif
+
+#ifndef FSBL_COPY_HASH_OVERLAP_EXCLUDE_VAL
+#define FSBL_COPY_HASH_OVERLAP_EXCLUDE_VAL	(0U)
+#endif
+
 #if (FSBL_NAND_EXCLUDE_VAL) && (!defined(FSBL_NAND_EXCLUDE))
 #define FSBL_NAND_EXCLUDE
 #endif
@@ -286,6 +320,21 @@ extern "C" {
 #define FSBL_UNPROVISIONED_AUTH_SIGN_EXCLUDE
 #endif
 
+#if (FSBL_PL_BACKGROUND_LOAD_EXCLUDE_VAL == 1U) && \
+	(!defined(FSBL_PL_BACKGROUND_LOAD_EXCLUDE))
+#define FSBL_PL_BACKGROUND_LOAD_EXCLUDE
+#endif
+
+#if (FSBL_PL_SIGNED_HASH_TABLE_EXCLUDE_VAL == 1U) && \
+	(!defined(FSBL_PL_SIGNED_HASH_TABLE_EXCLUDE))
+#define FSBL_PL_SIGNED_HASH_TABLE_EXCLUDE
+#endif
+
+#if (FSBL_COPY_HASH_OVERLAP_EXCLUDE_VAL == 1U) && \
+	(!defined(FSBL_COPY_HASH_OVERLAP_EXCLUDE))
+#define FSBL_COPY_HASH_OVERLAP_EXCLUDE
+#endif
+
 /************************** Function Prototypes ******************************/
 
 /************************** Variable Definitions *****************************/
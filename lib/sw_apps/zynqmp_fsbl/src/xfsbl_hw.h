@@ -28,6 +28,9 @@
 *       bsv  05/03/21 Add provision to load bitstream from OCM with DDR
 *                     present in design
 * 6.0   bsv  08/03/22 Fix ECC error count for R5 FSBL
+*       ant  10/18/26 Added XFSBL_PL_BACKGROUND_LOAD
+*       ant  10/18/26 Added XFSBL_PL_SIGNED_HASH_TABLE
+*       ant  10/18/26 Added XFSBL_COPY_HASH_OVERLAP
 *
 * </pre>
 *
@@ -930,6 +933,32 @@ extern "C" {
 #define XFSBL_PROT_BYPASS
 #endif
 
+/*
+ * Definition for loading partitions while non secure bitstream is written
+ * to PCAP. Bitstream must be staged in DDR and not be measured by TPM.
+ */
+#if !defined(FSBL_PL_BACKGROUND_LOAD_EXCLUDE) && defined(XFSBL_BS) \
+	&& (!defined(XFSBL_PL_LOAD_FROM_OCM)) && (!defined(XFSBL_TPM))
+#define XFSBL_PL_BACKGROUND_LOAD
+#endif
+
+/*
+ * Definition for authenticating bitstream blocks with the signed chunk hash
+ * table from boot image instead of reading every block twice
+ */
+#if !defined(FSBL_PL_SIGNED_HASH_TABLE_EXCLUDE) && defined(XFSBL_BS) \
+	&& defined(XFSBL_SECURE)
+#define XFSBL_PL_SIGNED_HASH_TABLE
+#endif
+
+/*
+ * Definition for calculating SHA3 checksum of a partition chunk while next
+ * chunk is copied. Not used for DDR less systems.
+ */
+#if !defined(FSBL_COPY_HASH_OVERLAP_EXCLUDE) && defined(XFSBL_PS_DDR)
+#define XFSBL_COPY_HASH_OVERLAP
+#endif
+
 #define XFSBL_PS_DDR_INIT_START_ADDRESS XFSBL_PS_DDR_START_ADDRESS
 #ifdef ARMR5
 #if defined(XPAR_PSU_R5_DDR_1_S_AXI_BASEADDR)
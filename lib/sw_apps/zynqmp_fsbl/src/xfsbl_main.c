@@ -23,6 +23,8 @@
 * 3.0   bv   03/03/21 Print multiboot offset in FSBL banner
 *       bsv  04/28/21 Added support to ensure authenticated images boot as
 *                     non-secure when RSA_EN is not programmed
+*       ant  10/18/26 Added XFsbl_PrintPerfTime
+*       ant  10/18/26 Complete background bitstream download before handoff
 *
 * </pre>
 *
@@ -252,6 +254,22 @@ int main(void )
 				XFsbl_Printf(DEBUG_INFO,
 						"================= In Stage 4 ============ \n\r");
 
+				/**
+				 * Complete the bitstream download which is
+				 * in progress, if any
+				 */
+				FsblStatus = XFsbl_PLLoadComplete();
+				if (XFSBL_SUCCESS != FsblStatus) {
+					XFsbl_Printf(DEBUG_GENERAL,"PL Load Failed 0x%0lx\n\r", FsblStatus);
+					FsblStatus += XFSBL_ERROR_STAGE_4;
+					FsblStage = XFSBL_STAGE_ERR;
+					break;
+				}
+
+#ifdef XFSBL_PERF
+				XFsbl_PrintBootTimeline(FsblInstance.PerfTime.tFsblStart);
+#endif
+
 				/**
 				 * Handoff to the applications
 				 * Handoff address
@@ -565,14 +583,27 @@ static void XFsbl_UpdateMultiBoot(u32 MultiBootValue)
 void XFsbl_MeasurePerfTime(XTime tCur)
 {
 	XTime tEnd = 0;
-	XTime tDiff = 0;
+
+	XTime_GetTime(&tEnd);
+	XFsbl_PrintPerfTime(tEnd - tCur);
+}
+
+/*****************************************************************************/
+/**
+ * This function prints a time interval measured in timer counts.
+ *
+ * @param Number of timer counts
+ *
+ * @return none
+ *
+ * @note none
+ *****************************************************************************/
+void XFsbl_PrintPerfTime(XTime tDiff)
+{
 	u64 tPerfNs;
 	u64 tPerfMs = 0;
 	u64 tPerfMsFrac = 0;
 
-	XTime_GetTime(&tEnd);
-	tDiff = tEnd - tCur;
-
 	/* Convert tPerf into nanoseconds */
 	tPerfNs = ((double)tDiff / (double)COUNTS_PER_SECOND) * 1e9;
 
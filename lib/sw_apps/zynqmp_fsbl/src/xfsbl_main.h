@@ -23,6 +23,7 @@
 *                     non-secure when RSA_EN is not programmed
 * 4.00  bsv  10/15/21 Fixed bug to support secondary boot with non-zero
 *                     multiboot offset
+*       ant  10/18/26 Added XFsbl_PLLoadComplete and XFsbl_PrintBootTimeline
 *
 * </pre>
 *
@@ -182,6 +183,7 @@ void XFsbl_ErrorLockDown(u32 ErrorStatus);
 
 #if defined(XFSBL_PERF)
 void XFsbl_MeasurePerfTime(XTime tCur);
+void XFsbl_PrintPerfTime(XTime tDiff);
 #endif
 
 /**
@@ -197,6 +199,10 @@ void XFsbl_MarkDdrAsReserved(u8 Cond);
  */
 u32 XFsbl_PartitionLoad(XFsblPs * FsblInstancePtr, u32 PartitionNum);
 u32 XFsbl_PowerUpMemory(u32 MemoryType);
+u32 XFsbl_PLLoadComplete(void);
+#if defined(XFSBL_PERF)
+void XFsbl_PrintBootTimeline(XTime tStart);
+#endif
 /**
  * Functions defined in xfsbl_handoff.c
  */
@@ -50,6 +50,10 @@
 *       bsv  05/15/21 Support to ensure authenticated images boot as
 *                     non-secure when RSA_EN is not programmed and boot header
 *                     is not authenticated is disabled by default
+*       ant  10/18/26 Load partitions while non secure bitstream is written
+*                     to PCAP and added boot timeline for XFSBL_PERF
+*       ant  10/18/26 Calculate SHA3 checksum of a partition chunk while the
+*                     next chunk is copied
 *
 * </pre>
 *
@@ -72,6 +76,32 @@
 /************************** Constant Definitions *****************************/
 
 /**************************** Type Definitions *******************************/
+#ifdef XFSBL_PL_BACKGROUND_LOAD
+/**
+ * This stores the non secure bitstream which is written to PCAP while the
+ * following partitions are loaded
+ */
+typedef struct {
+	u32 IsPending; /**< TRUE if PCAP transfer is not yet completed */
+	u32 PartitionNum; /**< Partition number of the bitstream */
+	u64 StartAddress; /**< Start of the bitstream in DDR */
+	u64 EndAddress; /**< End of the bitstream in DDR, exclusive */
+#ifdef XFSBL_PERF
+	XTime tStart; /**< Time at which PCAP transfer is started */
+#endif
+} XFsblPs_PlLoad;
+#endif
+
+#ifdef XFSBL_PERF
+/**
+ * This stores an event of the boot timeline
+ */
+typedef struct {
+	XTime Time; /**< Time of the event */
+	u32 PartitionNum; /**< Partition number */
+	u32 Event; /**< One of XFSBL_TIMELINE_* */
+} XFsblPs_TimelineEvent;
+#endif
 
 /***************** Macros (Inline Functions) Definitions *********************/
 #define XFSBL_IVT_LENGTH	(u32)(0x20U)
@@ -90,6 +120,21 @@
 #define XFSBL_EL2_VAL		(4U)
 #define XFSBL_EL3_VAL		(6U)
 #endif
+#ifdef XFSBL_PERF
+#define XFSBL_TIMELINE_MAX_EVENTS	(64U)
+#define XFSBL_TIMELINE_PARTITION_START	(0U)
+#define XFSBL_TIMELINE_COPY_DONE	(1U)
+#define XFSBL_TIMELINE_VALIDATED	(2U)
+#define XFSBL_TIMELINE_PL_START		(3U)
+#define XFSBL_TIMELINE_PL_DONE		(4U)
+#endif
+#ifdef XFSBL_COPY_HASH_OVERLAP
+#define XFSBL_INVALID_PARTITION_NUM	(0xFFFFFFFFU)
+#if ((XFSBL_COPY_HASH_CHUNK_SIZE % XSECURE_SHA3_BLOCK_LEN) != 0U) || \
+	(XFSBL_COPY_HASH_CHUNK_SIZE == 0U)
+#error "XFSBL_COPY_HASH_CHUNK_SIZE must be a multiple of SHA3 block length"
+#endif
+#endif
 
 /************************** Function Prototypes ******************************/
 static u32 XFsbl_PartitionHeaderValidation(XFsblPs * FsblInstancePtr,
@@ -110,8 +155,20 @@ static u32 XFsbl_ValidateCheckSum(XFsblPs * FsblInstancePtr,
 	PTRSIZE LoadAddress, u32 PartitionNum, u8 * PartitionHash);
 static void XFsbl_CalculateSHA(const XFsblPs * FsblInstancePtr,
 	PTRSIZE LoadAddress, u32 PartitionNum, u8* PartitionHash);
+#ifdef XFSBL_COPY_HASH_OVERLAP
+static u32 XFsbl_PartitionCopyAndHash(const XFsblPs * FsblInstancePtr,
+	u32 SrcAddress, PTRSIZE LoadAddress, u32 Length, u32 PartitionNum);
+#endif
 #ifdef XFSBL_BS
 static void XFsbl_SetBSSecureState(u32 State);
+static u32 XFsbl_PLPostConfig(u32 PartitionNum, u32 BsSecureState);
+#endif
+#ifdef XFSBL_PL_BACKGROUND_LOAD
+static u32 XFsbl_IsPLLoadDependency(XFsblPs * FsblInstancePtr,
+	u32 PartitionNum);
+#endif
+#ifdef XFSBL_PERF
+static void XFsbl_TimelineRecord(u32 PartitionNum, u32 Event);
 #endif
 
 #ifdef XFSBL_ENABLE_DDR_SR
@@ -146,6 +203,25 @@ u8 HashsOfChunks[HASH_BUFFER_SIZE] __attribute__((section (".bitstream_buffer"))
 #endif
 #endif
 
+#ifdef XFSBL_PL_BACKGROUND_LOAD
+static XFsblPs_PlLoad PlLoad = {0};
+#endif
+
+#ifdef XFSBL_PERF
+static XFsblPs_TimelineEvent Timeline[XFSBL_TIMELINE_MAX_EVENTS];
+static u32 TimelineCount = 0U;
+#endif
+
+#ifdef XFSBL_COPY_HASH_OVERLAP
+/**
+ * SHA3 checksum calculated while copying the partition CopyHashPartitionNum.
+ * It is used by the partition validation instead of reading the partition
+ * again from memory.
+ */
+static u8 CopyHash[XFSBL_HASH_TYPE_SHA3] __attribute__ ((aligned (4U)));
+static u32 CopyHashPartitionNum = XFSBL_INVALID_PARTITION_NUM;
+#endif
+
 /* buffer for storing chunks for bitstream */
 #if defined(XFSBL_BS)
 extern u8 ReadBuffer[READ_BUFFER_SIZE];
@@ -205,6 +281,26 @@ u32 XFsbl_PartitionLoad(XFsblPs * FsblInstancePtr, u32 PartitionNum)
 		 */
 	}
 
+#ifdef XFSBL_PERF
+	XFsbl_TimelineRecord(PartitionNum, XFSBL_TIMELINE_PARTITION_START);
+#endif
+
+#ifdef XFSBL_PL_BACKGROUND_LOAD
+	/**
+	 * Complete the bitstream download in progress if this partition
+	 * can not be loaded in parallel with it
+	 */
+	if ((PlLoad.IsPending == TRUE) &&
+		(XFsbl_IsPLLoadDependency(FsblInstancePtr, PartitionNum) == TRUE))
+	{
+		Status = XFsbl_PLLoadComplete();
+		if (XFSBL_SUCCESS != Status)
+		{
+			goto END;
+		}
+	}
+#endif
+
 	/**
 	 * Partition Copy
 	 */
@@ -214,6 +310,10 @@ u32 XFsbl_PartitionLoad(XFsblPs * FsblInstancePtr, u32 PartitionNum)
 		goto END;
 	}
 
+#ifdef XFSBL_PERF
+	XFsbl_TimelineRecord(PartitionNum, XFSBL_TIMELINE_COPY_DONE);
+#endif
+
 	/**
 	 * Partition Validation
 	 */
@@ -223,6 +323,10 @@ u32 XFsbl_PartitionLoad(XFsblPs * FsblInstancePtr, u32 PartitionNum)
 		goto END;
 	}
 
+#ifdef XFSBL_PERF
+	XFsbl_TimelineRecord(PartitionNum, XFSBL_TIMELINE_VALIDATED);
+#endif
+
 #ifdef ARMR5
 	if(IsR5IvtBackup == TRUE) {
 		XFsbl_Printf(DEBUG_DETAILED,"XFsbl_PartitionLoad:After Partition Validation\n\r"
@@ -871,6 +975,9 @@ static u32 XFsbl_PartitionCopy(XFsblPs * FsblInstancePtr, u32 PartitionNum)
 		&FsblInstancePtr->ImageHeader.PartitionHeader[PartitionNum];
 
 	RunningCpu = FsblInstancePtr->ProcessorID;
+#ifdef XFSBL_COPY_HASH_OVERLAP
+	CopyHashPartitionNum = XFSBL_INVALID_PARTITION_NUM;
+#endif
 
 	/**
 	 * Check for XIP image
@@ -1101,6 +1208,24 @@ static u32 XFsbl_PartitionCopy(XFsblPs * FsblInstancePtr, u32 PartitionNum)
 		} while (1);
 	}
 
+#ifdef XFSBL_COPY_HASH_OVERLAP
+	/**
+	 * Calculate the SHA3 checksum of each chunk while the next chunk is
+	 * copied, if the copied data is all that the checksum covers.
+	 * USB boot mode uses CSU DMA for the copy, so it is done serially.
+	 */
+	if ((FsblInstancePtr->PrimaryBootDevice != XFSBL_USB_BOOT_MODE) &&
+		(FsblInstancePtr->SecondaryBootDevice != XFSBL_USB_BOOT_MODE) &&
+		(XFsbl_GetChecksumType(PartitionHeader) == XIH_PH_ATTRB_HASH_SHA3) &&
+		(Length == (PartitionHeader->TotalDataWordLength *
+				XIH_PARTITION_WORD_LENGTH)) &&
+		((LoadAddress % XIH_PARTITION_WORD_LENGTH) == 0U)) {
+		Status = XFsbl_PartitionCopyAndHash(FsblInstancePtr, SrcAddress,
+					LoadAddress, Length, PartitionNum);
+		goto END;
+	}
+#endif
+
 #ifdef XFSBL_PERF
 	XTime tCur = 0;
 	XTime_GetTime(&tCur);
@@ -1169,6 +1294,9 @@ static u32 XFsbl_PartitionValidation(XFsblPs * FsblInstancePtr,
 #if defined(XFSBL_BS) && (!defined(XFSBL_PL_LOAD_FROM_OCM))
 	u32 BitstreamWordSize;
 #endif
+#ifdef XFSBL_BS
+	u32 BsSecureState;
+#endif
 #ifdef XFSBL_PERF
 	XTime tCur = 0;
 #endif
@@ -1326,8 +1454,20 @@ static u32 XFsbl_PartitionValidation(XFsblPs * FsblInstancePtr,
 
 	/* Checksum verification */
 	if (IsChecksumEnabled == TRUE) {
-		Status = XFsbl_CalculateCheckSum(FsblInstancePtr,
-			LoadAddress, PartitionNum, PartitionHash);
+#ifdef XFSBL_COPY_HASH_OVERLAP
+		if (CopyHashPartitionNum == PartitionNum) {
+			/* Checksum is already calculated during the copy */
+			(void)XFsbl_MemCpy(PartitionHash, CopyHash,
+				XFSBL_HASH_TYPE_SHA3);
+			CopyHashPartitionNum = XFSBL_INVALID_PARTITION_NUM;
+			Status = XFSBL_SUCCESS;
+		}
+		else
+#endif
+		{
+			Status = XFsbl_CalculateCheckSum(FsblInstancePtr,
+				LoadAddress, PartitionNum, PartitionHash);
+		}
 		if (Status != XFSBL_SUCCESS) {
 			XFsbl_Printf(DEBUG_GENERAL,
 					"XFSBL_ERROR_PARTITION_CHECKSUM_FAILED \r\n");
@@ -1590,6 +1730,7 @@ static u32 XFsbl_PartitionValidation(XFsblPs * FsblInstancePtr,
 #ifdef XFSBL_PERF
 			/* Start time for non sec. bitstream download */
 			XTime_GetTime(&tCur);
+			XFsbl_TimelineRecord(PartitionNum, XFSBL_TIMELINE_PL_START);
 #endif
 
 #ifndef XFSBL_PL_LOAD_FROM_OCM
@@ -1597,10 +1738,31 @@ static u32 XFsbl_PartitionValidation(XFsblPs * FsblInstancePtr,
 			BitstreamWordSize =
 				PartitionHeader->UnEncryptedDataWordLength;
 
+#ifdef XFSBL_PL_BACKGROUND_LOAD
+			/**
+			 * Start the PCAP transfer and continue with the next
+			 * partitions. PL configuration is completed by
+			 * XFsbl_PLLoadComplete
+			 */
+			XFsbl_WriteToPcapStart(BitstreamWordSize, (u8 *) LoadAddress);
+			PlLoad.IsPending = TRUE;
+			PlLoad.PartitionNum = PartitionNum;
+			PlLoad.StartAddress = (u64)LoadAddress;
+			PlLoad.EndAddress = (u64)LoadAddress +
+				((u64)BitstreamWordSize * XIH_PARTITION_WORD_LENGTH);
+#ifdef XFSBL_PERF
+			PlLoad.tStart = tCur;
+#endif
+			XFsbl_Printf(DEBUG_INFO,
+				"P%d bitstream download started\r\n", PartitionNum);
+			Status = XFSBL_SUCCESS;
+			goto END;
+#else
 			Status = XFsbl_WriteToPcap(BitstreamWordSize, (u8 *) LoadAddress);
 			if (Status != XFSBL_SUCCESS) {
 				goto END;
 			}
+#endif
 #else
 			/* In case of PL load from OCM, do the chunked transfer */
 			Status = XFsbl_ChunkedBSTxfer(FsblInstancePtr,
@@ -1622,40 +1784,17 @@ static u32 XFsbl_PartitionValidation(XFsblPs * FsblInstancePtr,
 
 #ifdef XFSBL_BS
 	if (DestinationDevice == XIH_PH_ATTRB_DEST_DEVICE_PL) {
-		Status = XFsbl_PLWaitForDone();
-		if (Status != XFSBL_SUCCESS) {
-			goto END;
-		}
-
-		/**
-		 * PL is powered-up before its configuration, but will be in isolation.
-		 * Now since PL configuration is done, just remove the isolation
-		 */
-		psu_ps_pl_isolation_removal_data();
-
-		/* Reset PL, if configured for */
-		(void)psu_ps_pl_reset_config_data();
-
 		/* Update PMU_GLOBAL_GEN_STORE Register */
+		BsSecureState = XFSBL_FIRMWARE_STATE_NONSECURE;
 #ifdef XFSBL_SECURE
 		if ((IsAuthenticationEnabled == TRUE) || (IsEncryptionEnabled == TRUE))
 		{
-			XFsbl_SetBSSecureState(XFSBL_FIRMWARE_STATE_SECURE);
-		} else
-#endif
-		{
-			XFsbl_SetBSSecureState(XFSBL_FIRMWARE_STATE_NONSECURE);
+			BsSecureState = XFSBL_FIRMWARE_STATE_SECURE;
 		}
+#endif
 
-		/**
-		 * Fsbl hook after bit stream download
-		 */
-		Status = XFsbl_HookAfterBSDownload();
-		if (Status != XFSBL_SUCCESS)
-		{
-			Status = XFSBL_ERROR_HOOK_AFTER_BITSTREAM_DOWNLOAD;
-			XFsbl_Printf(DEBUG_GENERAL,
-			 "XFSBL_ERROR_HOOK_AFTER_BITSTREAM_DOWNLOAD\r\n");
+		Status = XFsbl_PLPostConfig(PartitionNum, BsSecureState);
+		if (Status != XFSBL_SUCCESS) {
 			goto END;
 		}
 	}
@@ -1798,6 +1937,250 @@ static void XFsbl_SetBSSecureState(u32 State)
 	RegVal |= State << XFSBL_STATE_SHIFT;
 	Xil_Out32(PMU_GLOBAL_GLOB_GEN_STORAGE5, RegVal);
 }
+/*****************************************************************************/
+/**
+ * This function waits for PL configuration to be done and enables the PS-PL
+ * interface once the bitstream is written to PCAP
+ *
+ * @param	PartitionNum is the partition number of the bitstream
+ *
+ * @param	BsSecureState is the BS firmware state to be updated
+ *
+ * @return	returns the error codes described in xfsbl_error.h on any error
+ * 			returns XFSBL_SUCCESS on success
+ *****************************************************************************/
+static u32 XFsbl_PLPostConfig(u32 PartitionNum, u32 BsSecureState)
+{
+	u32 Status;
+
+	Status = XFsbl_PLWaitForDone();
+	if (Status != XFSBL_SUCCESS) {
+		goto END;
+	}
+
+#ifdef XFSBL_PERF
+	XFsbl_TimelineRecord(PartitionNum, XFSBL_TIMELINE_PL_DONE);
+#endif
+	XFsbl_Printf(DEBUG_INFO, "P%d PL configuration done\r\n", PartitionNum);
+
+	/**
+	 * PL is powered-up before its configuration, but will be in isolation.
+	 * Now since PL configuration is done, just remove the isolation
+	 */
+	psu_ps_pl_isolation_removal_data();
+
+	/* Reset PL, if configured for */
+	(void)psu_ps_pl_reset_config_data();
+
+	/* Update PMU_GLOBAL_GEN_STORE Register */
+	XFsbl_SetBSSecureState(BsSecureState);
+
+	/**
+	 * Fsbl hook after bit stream download
+	 */
+	Status = XFsbl_HookAfterBSDownload();
+	if (Status != XFSBL_SUCCESS)
+	{
+		Status = XFSBL_ERROR_HOOK_AFTER_BITSTREAM_DOWNLOAD;
+		XFsbl_Printf(DEBUG_GENERAL,
+		 "XFSBL_ERROR_HOOK_AFTER_BITSTREAM_DOWNLOAD\r\n");
+		goto END;
+	}
+
+END:
+	return Status;
+}
+
+#endif
+
+/*****************************************************************************/
+/**
+ * This function completes the non secure bitstream download started in
+ * the background, if any. It must be called before CSU DMA is used again
+ * and before handoff to the applications.
+ *
+ * @param	None
+ *
+ * @return	returns the error codes described in xfsbl_error.h on any error
+ * 			returns XFSBL_SUCCESS on success or if no download is pending
+ *****************************************************************************/
+u32 XFsbl_PLLoadComplete(void)
+{
+	u32 Status = XFSBL_SUCCESS;
+
+#ifdef XFSBL_PL_BACKGROUND_LOAD
+	if (PlLoad.IsPending == FALSE) {
+		goto END;
+	}
+	PlLoad.IsPending = FALSE;
+
+	Status = XFsbl_WriteToPcapWait();
+	if (Status != XFSBL_SUCCESS) {
+		goto END;
+	}
+
+#ifdef XFSBL_PERF
+	XFsbl_MeasurePerfTime(PlLoad.tStart);
+	XFsbl_Printf(DEBUG_PRINT_ALWAYS, ": P%d "
+			"(nsec. bitstream) dwnld Time \r\n", PlLoad.PartitionNum);
+#endif
+
+	Status = XFsbl_PLPostConfig(PlLoad.PartitionNum,
+			XFSBL_FIRMWARE_STATE_NONSECURE);
+
+END:
+#endif
+	return Status;
+}
+
+#ifdef XFSBL_PL_BACKGROUND_LOAD
+/*****************************************************************************/
+/**
+ * This function checks if a partition can be loaded while the bitstream is
+ * written to PCAP. The partition must wait for the bitstream if
+ *  - it is for PL
+ *  - it uses CSU DMA or SSS for checksum, decryption or authentication
+ *  - boot device uses CSU DMA to copy it (USB)
+ *  - it is not loaded to PS DDR, as PL and PMU RAM are not yet ready and
+ *    TCM and OCM are left to the synchronous flow
+ *  - it overlaps the bitstream in DDR
+ *
+ * @param	FsblInstancePtr is pointer to the XFsbl Instance
+ *
+ * @param	PartitionNum is the partition number in the image to be loaded
+ *
+ * @return	TRUE if partition has to wait for the bitstream, FALSE otherwise
+ *****************************************************************************/
+static u32 XFsbl_IsPLLoadDependency(XFsblPs * FsblInstancePtr,
+	u32 PartitionNum)
+{
+	u32 IsDependent = TRUE;
+	XFsblPs_PartitionHeader * PartitionHeader;
+	u32 DestinationCpu;
+	PTRSIZE LoadAddress;
+	u32 Length;
+	u64 StartAddress;
+	u64 EndAddress;
+
+	PartitionHeader =
+		&FsblInstancePtr->ImageHeader.PartitionHeader[PartitionNum];
+
+	if ((FsblInstancePtr->PrimaryBootDevice == XFSBL_USB_BOOT_MODE) ||
+		(FsblInstancePtr->SecondaryBootDevice == XFSBL_USB_BOOT_MODE)) {
+		goto END;
+	}
+
+	if ((XFsbl_GetDestinationDevice(PartitionHeader) ==
+			XIH_PH_ATTRB_DEST_DEVICE_PL) ||
+		(XFsbl_GetChecksumType(PartitionHeader) !=
+			XIH_PH_ATTRB_NOCHECKSUM) ||
+		(XFsbl_IsEncrypted(PartitionHeader) ==
+			XIH_PH_ATTRB_ENCRYPTION) ||
+		(XFsbl_IsRsaSignaturePresent(PartitionHeader) ==
+			XIH_PH_ATTRB_RSA_SIGNATURE)) {
+		goto END;
+	}
+
+	DestinationCpu = XFsbl_GetDestinationCpu(PartitionHeader);
+	if (DestinationCpu == XIH_PH_ATTRB_DEST_CPU_NONE) {
+		DestinationCpu = FsblInstancePtr->ProcessorID;
+	}
+	if (DestinationCpu == XIH_PH_ATTRB_DEST_CPU_PMU) {
+		goto END;
+	}
+
+	LoadAddress = (PTRSIZE) PartitionHeader->DestinationLoadAddress;
+	Length = PartitionHeader->TotalDataWordLength * XIH_PARTITION_WORD_LENGTH;
+	if (XFsbl_GetLoadAddress(DestinationCpu, &LoadAddress, Length) !=
+			XFSBL_SUCCESS) {
+		goto END;
+	}
+	StartAddress = (u64)LoadAddress;
+	EndAddress = StartAddress + Length;
+
+	/* Partition must be within low or high PS DDR */
+	if (EndAddress > ((u64)XFSBL_PS_DDR_END_ADDRESS + 1U)) {
+#ifdef XFSBL_PS_HI_DDR_START_ADDRESS
+		if ((StartAddress < (u64)XFSBL_PS_HI_DDR_START_ADDRESS) ||
+			(EndAddress > ((u64)XFSBL_PS_HI_DDR_END_ADDRESS + 1U))) {
+			goto END;
+		}
+#else
+		goto END;
+#endif
+	}
+
+	/* Partition must not overwrite the bitstream being read by CSU DMA */
+	if ((StartAddress < PlLoad.EndAddress) &&
+		(EndAddress > PlLoad.StartAddress)) {
+		goto END;
+	}
+
+	IsDependent = FALSE;
+
+END:
+	return IsDependent;
+}
+#endif
+
+#ifdef XFSBL_PERF
+/*****************************************************************************/
+/**
+ * This function records an event of the boot timeline. Events beyond
+ * XFSBL_TIMELINE_MAX_EVENTS are dropped.
+ *
+ * @param	PartitionNum is the partition number of the event
+ *
+ * @param	Event is one of XFSBL_TIMELINE_*
+ *
+ * @return	None
+ *****************************************************************************/
+static void XFsbl_TimelineRecord(u32 PartitionNum, u32 Event)
+{
+	if (TimelineCount < XFSBL_TIMELINE_MAX_EVENTS) {
+		XTime_GetTime(&Timeline[TimelineCount].Time);
+		Timeline[TimelineCount].PartitionNum = PartitionNum;
+		Timeline[TimelineCount].Event = Event;
+		TimelineCount++;
+	}
+}
+
+/*****************************************************************************/
+/**
+ * This function prints the boot timeline recorded so far relative to
+ * the given start time and clears it
+ *
+ * @param	tStart is the start time of the timeline
+ *
+ * @return	None
+ *****************************************************************************/
+void XFsbl_PrintBootTimeline(XTime tStart)
+{
+	u32 Index;
+	static const char *EventName[] = {
+		"load start",
+		"copy done",
+		"validated",
+		"PL download start",
+		"PL done",
+	};
+
+	if (TimelineCount == 0U) {
+		goto END;
+	}
+
+	XFsbl_Printf(DEBUG_PRINT_ALWAYS, "Boot timeline:\r\n");
+	for (Index = 0U; Index < TimelineCount; Index++) {
+		XFsbl_PrintPerfTime(Timeline[Index].Time - tStart);
+		XFsbl_Printf(DEBUG_PRINT_ALWAYS, " : P%d %s\r\n",
+			Timeline[Index].PartitionNum,
+			EventName[Timeline[Index].Event]);
+	}
+	TimelineCount = 0U;
+
+END:
+	return;
+}
 #endif
 
 /*****************************************************************************/
@@ -1955,6 +2338,155 @@ static void XFsbl_CalculateSHA(const XFsblPs * FsblInstancePtr,
 		XFSBL_HASH_TYPE_SHA3);
 }
 
+#ifdef XFSBL_COPY_HASH_OVERLAP
+/*****************************************************************************/
+/**
+ * This function copies the partition in chunks of XFSBL_COPY_HASH_CHUNK_SIZE
+ * and calculates its SHA3 checksum. While CSU DMA sends chunk N to the SHA3
+ * engine, chunk N+1 is copied from the boot device to the memory following
+ * chunk N, so the two stages run in parallel. The resulting hash is used by
+ * XFsbl_PartitionValidation for this partition.
+ *
+ * @param	FsblInstancePtr is pointer to the XFsbl Instance
+ * @param	SrcAddress is the flash offset of the partition
+ * @param	LoadAddress is the word aligned address to which the partition
+ *		is copied
+ * @param	Length is the number of bytes to be copied
+ * @param	PartitionNum is the partition number in the image to be loaded
+ *
+ * @return	returns the error codes described in xfsbl_error.h on any error
+ * 			returns XFSBL_SUCCESS on success
+ *
+ *****************************************************************************/
+static u32 XFsbl_PartitionCopyAndHash(const XFsblPs * FsblInstancePtr,
+	u32 SrcAddress, PTRSIZE LoadAddress, u32 Length, u32 PartitionNum)
+{
+	u32 Status;
+	u32 Offset = 0U;
+	u32 ChunkLen;
+	u32 NextLen;
+	u32 IsHashPending = FALSE;
+#ifdef XFSBL_PERF
+	XTime tFetch = 0;
+	XTime tHash = 0;
+	XTime tBegin = 0;
+	XTime tStart = 0;
+	XTime tEnd = 0;
+
+	XTime_GetTime(&tBegin);
+	tStart = tBegin;
+#endif
+
+	XFsbl_ShaStart(NULL, XFSBL_HASH_TYPE_SHA3);
+
+	/* First chunk is copied alone as there is nothing to hash yet */
+	ChunkLen = Length;
+	if (ChunkLen > XFSBL_COPY_HASH_CHUNK_SIZE) {
+		ChunkLen = XFSBL_COPY_HASH_CHUNK_SIZE;
+	}
+	Status = FsblInstancePtr->DeviceOps.DeviceCopy(SrcAddress,
+				LoadAddress, ChunkLen);
+	if (XFSBL_SUCCESS != Status) {
+		goto END;
+	}
+#ifdef XFSBL_PERF
+	XTime_GetTime(&tEnd);
+	tFetch += tEnd - tStart;
+#endif
+
+	while (Offset < Length) {
+		NextLen = Length - Offset - ChunkLen;
+		if (NextLen > XFSBL_COPY_HASH_CHUNK_SIZE) {
+			NextLen = XFSBL_COPY_HASH_CHUNK_SIZE;
+		}
+
+		if (NextLen == 0U) {
+			/**
+			 * Last chunk need not be a multiple of SHA3 block length
+			 * and there is nothing left to copy, so hash it in
+			 * foreground
+			 */
+#ifdef XFSBL_PERF
+			XTime_GetTime(&tStart);
+#endif
+			XFsbl_ShaUpdate(NULL, (u8 *)(LoadAddress + Offset),
+				ChunkLen, XFSBL_HASH_TYPE_SHA3);
+#ifdef XFSBL_PERF
+			XTime_GetTime(&tEnd);
+			tHash += tEnd - tStart;
+#endif
+		}
+		else {
+			Status = XFsbl_ShaUpdateStart(
+					(u8 *)(LoadAddress + Offset), ChunkLen);
+			if (XFSBL_SUCCESS != Status) {
+				Status = XFSBL_ERROR_PARTITION_CHECKSUM_FAILED;
+				goto END;
+			}
+			IsHashPending = TRUE;
+
+			/**
+			 * Copy chunk N+1 while chunk N is hashed. Chunks are
+			 * copied to consecutive regions at the load address, so
+			 * the chunk being hashed is never overwritten.
+			 */
+#ifdef XFSBL_PERF
+			XTime_GetTime(&tStart);
+#endif
+			Status = FsblInstancePtr->DeviceOps.DeviceCopy(
+					SrcAddress + Offset + ChunkLen,
+					LoadAddress + Offset + ChunkLen, NextLen);
+			if (XFSBL_SUCCESS != Status) {
+				goto END;
+			}
+#ifdef XFSBL_PERF
+			XTime_GetTime(&tEnd);
+			tFetch += tEnd - tStart;
+			tStart = tEnd;
+#endif
+
+			/* Time spent here is the hashing not hidden by the copy */
+			IsHashPending = FALSE;
+			Status = XFsbl_ShaUpdateWait();
+			if (XFSBL_SUCCESS != Status) {
+				Status = XFSBL_ERROR_PARTITION_CHECKSUM_FAILED;
+				goto END;
+			}
+#ifdef XFSBL_PERF
+			XTime_GetTime(&tEnd);
+			tHash += tEnd - tStart;
+#endif
+		}
+
+		Offset += ChunkLen;
+		ChunkLen = NextLen;
+	}
+
+	XFsbl_ShaFinish(NULL, CopyHash, XFSBL_HASH_TYPE_SHA3);
+	CopyHashPartitionNum = PartitionNum;
+
+#ifdef XFSBL_PERF
+	XFsbl_PrintPerfTime(tFetch);
+	XFsbl_Printf(DEBUG_PRINT_ALWAYS, ": P%u Copy time, Size: %0u \r\n",
+				PartitionNum, Length);
+	XFsbl_PrintPerfTime(tHash);
+	XFsbl_Printf(DEBUG_PRINT_ALWAYS, ": P%u Checksum wait time \r\n",
+				PartitionNum);
+	XTime_GetTime(&tEnd);
+	XFsbl_PrintPerfTime(tEnd - tBegin);
+	XFsbl_Printf(DEBUG_PRINT_ALWAYS, ": P%u Copy and checksum time \r\n",
+				PartitionNum);
+#endif
+
+END:
+	if (IsHashPending == TRUE) {
+		/* Do not leave CSU DMA running on error */
+		(void)XFsbl_ShaUpdateWait();
+	}
+	return Status;
+}
+#endif
+
 #ifdef XFSBL_ENABLE_DDR_SR
 /*****************************************************************************/
 /**
@@ -20,6 +20,10 @@
 * and compares with the stored hash. If matched each chunk will be sent to AES
 * if decryption exists or to PCAP throught CSUDMA.
 * The above process will be repeated for all the blocks of bitstream.
+* When XFSBL_PL_SIGNED_HASH_TABLE is defined, chunk hashes are not calculated
+* by FSBL, instead they are read from the hash table placed after each AC
+* which is signed along with the AC. So block is read only once and each
+* chunk is verified against the table while it is sent to AES/PCAP.
 *
 * <pre>
 * MODIFICATION HISTORY:
@@ -52,6 +56,9 @@
 *       bsv     05/03/21 Add provision to load bitstream from OCM with DDR
 *                        present in design
 * 7.0   bsv     07/23/21 Reset SHA engine in failure cases
+*       ant     10/18/26 Added single pass block authentication using signed
+*                        chunk hash table of boot image and moved RSA
+*                        signature verification to XFsbl_PlVerifySign
 *
 * </pre>
 *
@@ -87,10 +94,19 @@ static u32 XFsbl_DecrypSecureHdr(XSecure_Aes *InstancePtr, u64 SrcAddr,
 		u32 Size);
 static u32 XFsbl_ReAuthenticationBlock(XFsblPs_PlPartition *PartitionParams,
 				UINTPTR Address, u32 BlockLen, u32 NoOfChunks);
+#ifndef XFSBL_PL_SIGNED_HASH_TABLE
 static u32 XFsbl_PlSignVer(XFsblPs_PlPartition *PartitionParams,
 		UINTPTR BlockAdrs, u32 BlockSize, u8 *AcOffset, u32 NoOfChunks);
+#endif
 static u32 XFsbl_DecrptSetUpNextBlk(XFsblPs_PlPartition *PartitionParams,
 		UINTPTR ChunkAdrs, u32 ChunkSize);
+static u32 XFsbl_PlVerifySign(const XFsblPs_PlPartition *PartitionParams,
+		u8 *AcOffset, u8 *PartitionHash);
+#ifdef XFSBL_PL_SIGNED_HASH_TABLE
+static u32 XFsbl_PlHashTblSize(const XFsblPs_PlPartition *PartitionParams);
+static u32 XFsbl_PlHashTblSignVer(XFsblPs_PlPartition *PartitionParams,
+		u8 *AcOffset, u32 NoOfChunks);
+#endif
 
 /************************** Variable Definitions *****************************/
 
@@ -123,6 +139,7 @@ u32 XFsbl_SecPlPartition(XFsblPs * FsblInstancePtr,
 	UINTPTR CurrentAcOffset = PartitionParams->PlAuth.AcOfset;
 	u8 IsLastBlock = FALSE;
 	u32 RegVal;
+	u32 AcStride = XFSBL_AUTH_CERT_MIN_SIZE;
 
 	if (PartitionParams->IsAuthenticated != TRUE) {
 		XFsbl_Printf(DEBUG_GENERAL,"XFSBL_ERROR_SECURE_NOT_ENABLED"
@@ -158,6 +175,11 @@ u32 XFsbl_SecPlPartition(XFsblPs * FsblInstancePtr,
 			ADMA_CH0_ZDMA_CH_CTRL0_MODE_MASK);
 	XFsbl_Out32(ADMA_CH0_ZDMA_CH_CTRL0, RegVal);
 
+#ifdef XFSBL_PL_SIGNED_HASH_TABLE
+	/* Each AC is followed by hash table of its block */
+	AcStride += XFsbl_PlHashTblSize(PartitionParams);
+#endif
+
 	Xil_DCacheDisable();
 	/* Loop for traversing all blocks */
 	for (Len = PartitionParams->PlAuth.BlockSize, Index = 1;
@@ -183,10 +205,14 @@ u32 XFsbl_SecPlPartition(XFsblPs * FsblInstancePtr,
 			 * (NoofBlocks)*(AC size) - (NoOfBlocks - 1)*BlockSize
 			 */
 			Len = (PartitionParams->TotalLen) -
-				(Index) * (XFSBL_AUTH_CERT_MIN_SIZE) -
+				(Index) * (AcStride) -
 				(Index -1)*(PartitionParams->PlAuth.BlockSize);
 			IsLastBlock = TRUE;
 		}
+#ifdef XFSBL_PL_SIGNED_HASH_TABLE
+		PartitionParams->PlAuth.HashTblAdrs =
+			CurrentAcOffset + XFSBL_AUTH_CERT_MIN_SIZE;
+#endif
 
 		Status = XFsbl_PlBlockAuthentication(FsblInstancePtr,
 				PartitionParams, SrcAddress, Len,
@@ -196,8 +222,7 @@ u32 XFsbl_SecPlPartition(XFsblPs * FsblInstancePtr,
 		}
 
 		if (IsLastBlock == FALSE) {
-			CurrentAcOffset =
-				CurrentAcOffset + XFSBL_AUTH_CERT_MIN_SIZE;
+			CurrentAcOffset = CurrentAcOffset + AcStride;
 			SrcAddress =
 				SrcAddress + PartitionParams->PlAuth.BlockSize;
 		}
@@ -276,12 +301,20 @@ static u32 XFsbl_PlBlockAuthentication(XFsblPs * FsblInstancePtr,
 		goto END;
 	}
 
+#ifdef XFSBL_PL_SIGNED_HASH_TABLE
+	/*
+	 * Do Partition Signature verification of block's hash table,
+	 * block data is verified against it while loading
+	 */
+	Status = XFsbl_PlHashTblSignVer(PartitionParams, AuthCer, NoOfChunks);
+#else
 	/*
 	 * Do Partition Signature verification
 	 * of block in chunks and store each chunk's hash
 	 */
 	Status = XFsbl_PlSignVer(PartitionParams, SrcAddress,
 				Length, AuthCer, NoOfChunks);
+#endif
 	if (XFSBL_SUCCESS != Status) {
 	 goto END;
 	}
@@ -422,6 +455,7 @@ END:
 	return Status;
 }
 
+#ifndef XFSBL_PL_SIGNED_HASH_TABLE
 /******************************************************************************
 *
 * This function performs authentication and RSA signature verification for
@@ -445,17 +479,10 @@ static u32 XFsbl_PlSignVer(XFsblPs_PlPartition *PartitionParams,
 {
 
 	u8 PartitionHash[XFSBL_HASH_TYPE_SHA3]={0U};
-	u8 * SpkModular;
-	u8* SpkModularEx;
-	u32 SpkExp;
-	u8 * AcPtr = (u8*)AcOffset;
 	u32 Status;
 	u32 HashDataLen = BlockSize;
-	u8 XFsbl_RsaSha3Array[512] = {0U};
-	s32 SStatus;
 	u8 *ChunksHash = PartitionParams->PlAuth.HashsOfChunks;
 	XSecure_Sha3 SecureSha3={0U};
-	XSecure_Rsa SecureRsa={0U};
 	u32 Index;
 	u32 Len = PartitionParams->ChunkSize;
 	u64 Offset;
@@ -515,6 +542,40 @@ static u32 XFsbl_PlSignVer(XFsblPs_PlPartition *PartitionParams,
 		(XFSBL_AUTH_CERT_MIN_SIZE - XFSBL_FSBL_SIG_SIZE));
 	XSecure_Sha3Finish(&SecureSha3, (u8 *)PartitionHash);
 
+	Status = XFsbl_PlVerifySign(PartitionParams, AcOffset, PartitionHash);
+
+	return Status;
+}
+#endif
+
+/******************************************************************************
+*
+* This function verifies the partition signature of the block's AC with the
+* SPK of the same AC against the provided hash.
+*
+* @param	PartitionParams is a pointer to XFsblPs_PlPartition
+* @param	AcOffset holds authentication certificate's address
+* @param	PartitionHash holds the calculated hash of block
+*
+* @return
+* 		Error code on failure
+* 		XFSBL_SUCESS on success
+*
+* @note		None
+*
+******************************************************************************/
+static u32 XFsbl_PlVerifySign(const XFsblPs_PlPartition *PartitionParams,
+		u8 *AcOffset, u8 *PartitionHash)
+{
+	u8 * SpkModular;
+	u8* SpkModularEx;
+	u32 SpkExp;
+	u8 * AcPtr = (u8*)AcOffset;
+	u32 Status;
+	u8 XFsbl_RsaSha3Array[512] = {0U};
+	s32 SStatus;
+	XSecure_Rsa SecureRsa={0U};
+
 	/* Set SPK pointer */
 	AcPtr += (XFSBL_RSA_AC_ALIGN + XFSBL_PPK_SIZE);
 	SpkModular = AcPtr;
@@ -572,6 +633,122 @@ END:
 	return Status;
 }
 
+#ifdef XFSBL_PL_SIGNED_HASH_TABLE
+/******************************************************************************
+*
+* This function returns the size of hash table placed after each block's
+* authentication certificate. Table is always sized for a full block.
+*
+* @param	PartitionParams is a pointer to XFsblPs_PlPartition
+*
+* @return	Size of the hash table in bytes
+*
+* @note		None
+*
+******************************************************************************/
+static u32 XFsbl_PlHashTblSize(const XFsblPs_PlPartition *PartitionParams)
+{
+	u32 NoOfHashs = PartitionParams->PlAuth.BlockSize /
+				PartitionParams->ChunkSize;
+
+	if ((PartitionParams->PlAuth.BlockSize %
+			PartitionParams->ChunkSize) != 0U) {
+		NoOfHashs++;
+	}
+
+	return XFSBL_PL_HASH_TBL_HDR_SIZE +
+		(NoOfHashs * PartitionParams->PlAuth.AuthType);
+}
+
+/******************************************************************************
+*
+* This function copies the block's chunk hash table from boot image to
+* HashsOfChunks buffer and verifies the partition signature calculated on
+* hash table and (AC - signature size). Once verified, chunks are compared
+* against these hashes by XFsbl_ReAuthenticationBlock while sending them
+* to AES/PCAP, so the block data is read only once.
+*
+* @param	PartitionParams is a pointer to XFsblPs_PlPartition
+* @param	AcOffset holds authentication certificate's address
+* @param	NoOfChunks for the provided block
+*
+* @return
+* 		Error code on failure
+* 		XFSBL_SUCESS on success
+*
+* @note		None
+*
+******************************************************************************/
+static u32 XFsbl_PlHashTblSignVer(XFsblPs_PlPartition *PartitionParams,
+		u8 *AcOffset, u32 NoOfChunks)
+{
+	u8 PartitionHash[XFSBL_HASH_TYPE_SHA3]={0U};
+	u32 TblHdr[XFSBL_PL_HASH_TBL_HDR_SIZE / 4U] = {0U};
+	u32 HashsLen = NoOfChunks * PartitionParams->PlAuth.AuthType;
+	UINTPTR TblAdrs = PartitionParams->PlAuth.HashTblAdrs;
+	XSecure_Sha3 SecureSha3={0U};
+	XCsuDma_Configure ConfigurValues = {0};
+	u32 Status;
+
+	Status = XFsbl_CopyData(PartitionParams, (u8 *)TblHdr,
+			(u8 *)TblAdrs, XFSBL_PL_HASH_TBL_HDR_SIZE);
+	if (Status != XFSBL_SUCCESS) {
+		goto END;
+	}
+
+	/*
+	 * Table should be generated for the chunk size used by FSBL and
+	 * should have a hash for every chunk of the block
+	 */
+	if ((TblHdr[XFSBL_PL_HASH_TBL_CHUNK_SIZE_IDX] !=
+			PartitionParams->ChunkSize) ||
+		(TblHdr[XFSBL_PL_HASH_TBL_NO_OF_HASHS_IDX] != NoOfChunks)) {
+		XFsbl_Printf(DEBUG_GENERAL, "XFsbl_PlHashTblSignVer:"
+			" XFSBL_ERROR_PL_HASH_TABLE Chunk size = %d \t"
+			" Hashes = %d\r\n",
+			TblHdr[XFSBL_PL_HASH_TBL_CHUNK_SIZE_IDX],
+			TblHdr[XFSBL_PL_HASH_TBL_NO_OF_HASHS_IDX]);
+		Status = XFSBL_ERROR_PL_HASH_TABLE;
+		goto END;
+	}
+
+	Status = XFsbl_CopyData(PartitionParams,
+			PartitionParams->PlAuth.HashsOfChunks,
+			(u8 *)(TblAdrs + XFSBL_PL_HASH_TBL_HDR_SIZE), HashsLen);
+	if (Status != XFSBL_SUCCESS) {
+		goto END;
+	}
+
+	XCsuDma_GetConfig(PartitionParams->CsuDmaPtr,
+		XCSUDMA_SRC_CHANNEL, &ConfigurValues);
+	ConfigurValues.EndianType = 0U;
+	XCsuDma_SetConfig(PartitionParams->CsuDmaPtr,
+		XCSUDMA_SRC_CHANNEL, &ConfigurValues);
+
+	/* Calculate hash for hash table and (AC - signature size) */
+	(void)XSecure_Sha3Initialize(&SecureSha3,
+		PartitionParams->CsuDmaPtr);
+	XSecure_Sha3Start(&SecureSha3);
+	XSecure_Sha3Update(&SecureSha3, (u8 *)TblHdr,
+		XFSBL_PL_HASH_TBL_HDR_SIZE);
+	XSecure_Sha3Update(&SecureSha3,
+		PartitionParams->PlAuth.HashsOfChunks, HashsLen);
+	XSecure_Sha3Update(&SecureSha3, (u8 *)AcOffset,
+		(XFSBL_AUTH_CERT_MIN_SIZE - XFSBL_FSBL_SIG_SIZE));
+	Status = XSecure_Sha3Finish(&SecureSha3, (u8 *)PartitionHash);
+	if (Status != XFSBL_SUCCESS) {
+		XSecure_SetReset(SecureSha3.BaseAddress,
+			XSECURE_CSU_SHA3_RESET_OFFSET);
+		goto END;
+	}
+
+	Status = XFsbl_PlVerifySign(PartitionParams, AcOffset, PartitionHash);
+
+END:
+	return Status;
+}
+#endif
+
 /******************************************************************************
 *
 * This function is used to copy data to AES/PL.
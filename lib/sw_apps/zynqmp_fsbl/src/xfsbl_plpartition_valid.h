@@ -26,6 +26,8 @@
 * 5.0   har     01/16/20 Added checks for Status of SSS configuration when AES
 *                        engine is the Resource
 * 6.0   bsv     04/01/21 Added TPM support
+* 7.0   ant     10/18/26 Added chunk hash table layout and HashTblAdrs member
+*                        to XFsblPs_PlAuthentication
 *
 * </pre>
 *
@@ -47,6 +49,20 @@ extern "C" {
 
 #define XFSBL_CSU_SSS_SRC_SRC_DMA    0x5U
 
+#ifdef XFSBL_PL_SIGNED_HASH_TABLE
+/*
+ * Chunk hash table placed by bootgen after each block's authentication
+ * certificate. Header is followed by running SHA3 state of block after every
+ * chunk, table is sized for a full block and signed along with the AC.
+ */
+#define XFSBL_PL_HASH_TBL_HDR_SIZE		(64U)
+					/**< Hash table header size */
+#define XFSBL_PL_HASH_TBL_CHUNK_SIZE_IDX	(0U)
+					/**< Chunk size word in header */
+#define XFSBL_PL_HASH_TBL_NO_OF_HASHS_IDX	(1U)
+					/**< Number of hashes word in header */
+#endif
+
 /**************************** Type Definitions *******************************/
 #if defined(XFSBL_SECURE) && defined(XFSBL_BS)
 /** @name XFsblPs_PlAuthentication
@@ -60,6 +76,10 @@ typedef struct {
 	u8 *HashsOfChunks;/** To store hashes of all chunks of block */
 	u32 NoOfHashs;	/**< HashsOfChunks buffer size provided */
 	u32 BlockSize;	/**< Block size of bitstream */
+#ifdef XFSBL_PL_SIGNED_HASH_TABLE
+	UINTPTR HashTblAdrs; /**< Not required for user, used for storing
+			  *  current block's hash table address */
+#endif
 } XFsblPs_PlAuthentication;
 /*@}*/
 
@@ -23,6 +23,8 @@
  * 4.0   har  06/17/20  Removed references to unused algorithms
  * 5.0   bsv  03/11/21  Fixed build issues
  *       kpt  03/16/21  Updated function headers with appropriate description
+ *       ant  10/18/26  Added XFsbl_ShaUpdateStart() and XFsbl_ShaUpdateWait()
+ *                      to hash data in background of partition copy
  *
  * </pre>
  *
@@ -131,6 +133,85 @@ void XFsbl_ShaUpdate(void * Ctx, u8 * Data, u32 Size, u32 HashLen)
 	}
 }
 
+#ifdef XFSBL_COPY_HASH_OVERLAP
+/*****************************************************************************
+ * This function starts CSU DMA transfer of the input data to SHA3 engine and
+ * returns without waiting for the transfer to complete.
+ * XFsbl_ShaUpdateWait() must be called before the input data is modified or
+ * CSU DMA and SHA3 engine are used again.
+ *
+ * @param       Data     Pointer to the word aligned input data that is used
+ *                       for hash calculation
+ * @param       Size     Size of the input data, must be a multiple of SHA3
+ *                       block length
+ *
+ * @return      XFSBL_SUCCESS if transfer is started
+ *              XFSBL_FAILURE if SHA3 engine holds partial data from previous
+ *              update, input is not aligned or SSS configuration fails
+ *
+ ******************************************************************************/
+u32 XFsbl_ShaUpdateStart(const u8 * Data, u32 Size)
+{
+	u32 Status = XFSBL_FAILURE;
+
+	/**
+	 * Only complete SHA3 blocks from word aligned address can be sent
+	 * directly, partial data is handled by XFsbl_ShaUpdate()
+	 */
+	if ((SecureSha3.Sha3State != XSECURE_SHA3_ENGINE_STARTED) ||
+		(SecureSha3.PartialLen != 0U) ||
+		((Size % XSECURE_SHA3_BLOCK_LEN) != 0U) ||
+		(((UINTPTR)Data & XCSUDMA_ADDR_LSB_MASK) != 0U)) {
+		goto END;
+	}
+
+	/* Configure the SSS for SHA3 hashing */
+	Status = XSecure_SssSha(&SecureSha3.SssInstance,
+			CsuDma.Config.DeviceId);
+	if (Status != XST_SUCCESS) {
+		Status = XFSBL_FAILURE;
+		goto END;
+	}
+
+	SecureSha3.Sha3Len += Size;
+	XCsuDma_Transfer(&CsuDma, XCSUDMA_SRC_CHANNEL, (UINTPTR)Data,
+			Size / XFSBL_WORD_LEN_IN_BYTES, 0U);
+	Status = XFSBL_SUCCESS;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************
+ * This function waits for the CSU DMA transfer started by
+ * XFsbl_ShaUpdateStart() to complete.
+ *
+ * @param       None
+ *
+ * @return      XFSBL_SUCCESS on completion
+ *              XFSBL_FAILURE on CSU DMA timeout
+ *
+ ******************************************************************************/
+u32 XFsbl_ShaUpdateWait(void)
+{
+	u32 Status;
+
+	Status = XCsuDma_WaitForDoneTimeout(&CsuDma, XCSUDMA_SRC_CHANNEL);
+	if (Status != XST_SUCCESS) {
+		Status = XFSBL_FAILURE;
+		goto END;
+	}
+
+	/* Acknowledge the transfer has completed */
+	XCsuDma_IntrClear(&CsuDma, XCSUDMA_SRC_CHANNEL,
+			XCSUDMA_IXR_DONE_MASK);
+	Status = XFSBL_SUCCESS;
+
+END:
+	return Status;
+}
+#endif
+
 #ifdef XFSBL_SECURE
 /*****************************************************************************
  *
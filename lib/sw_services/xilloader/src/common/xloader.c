@@ -139,6 +139,8 @@
 *       dc   07/27/2022 Added goto END in error case for header failures
 *       ma   08/08/2022 Check EAM errors between each image load
 *       ng   18/08/2022 Modified DelayedHandoffCpus condition to handle all possible values
+*       ant  10/18/2026 Added boot trace events for image loads
+*       ant  10/18/2026 Added flash read throughput statistics
 *
 * </pre>
 *
@@ -178,6 +180,9 @@
 #define XLOADER_IMAGE_INFO_TBL_MAX_NUM	(XPLMI_IMAGE_INFO_TBL_BUFFER_LEN / \
 		sizeof(XLoader_ImageInfo)) /**< Maximum number of image info
 					     tables in the available buffer */
+#define XLOADER_FLASH_STATS_KB_SHIFT	(10U)
+#define XLOADER_FLASH_STATS_US_PER_MS	(1000U)
+#define XLOADER_FLASH_STATS_US_PER_SEC	(1000000U)
 
 /************************** Function Prototypes ******************************/
 static int XLoader_ReadAndValidateHdrs(XilPdi* PdiPtr, u32 RegVal, u64 PdiAddr);
@@ -1255,7 +1260,13 @@ static int XLoader_LoadImage(XilPdi *PdiPtr)
 		goto END;
 	}
 
+	XPlmi_TraceEvent(XPLMI_TRACE_ID(XPLMI_MODULE_LOADER_ID,
+		XPLMI_TRACE_BEGIN, XLOADER_TRACE_EVT_IMAGE),
+		PdiPtr->MetaHdr.ImgHdr[PdiPtr->ImageNum].ImgID, 0U);
 	Status = XLoader_LoadImagePrtns(PdiPtr);
+	XPlmi_TraceEvent(XPLMI_TRACE_ID(XPLMI_MODULE_LOADER_ID,
+		XPLMI_TRACE_END, XLOADER_TRACE_EVT_IMAGE),
+		PdiPtr->MetaHdr.ImgHdr[PdiPtr->ImageNum].ImgID, (u32)Status);
 	if (Status != XST_SUCCESS) {
 		goto END;
 	}
@@ -1697,3 +1708,71 @@ static int XLoader_LoadAndStartSecPdi(XilPdi* PdiPtr)
 END:
 	return Status;
 }
+
+/*****************************************************************************/
+/**
+ * @brief	This function accounts a completed flash read in the flash
+ * statistics of the boot device.
+ *
+ * @param	Stats is pointer to the flash statistics of the boot device
+ * @param	TStart is the timer value when the read was started
+ * @param	Bytes is the number of bytes read
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+void XLoader_FlashStatsUpdate(XLoader_FlashStats *Stats, u64 TStart,
+	u32 Bytes)
+{
+	/* PIT counts down, so the elapsed cycles are start minus now */
+	Stats->ReadCycles += TStart - XPlmi_GetTimerValue();
+	Stats->ReadBytes += Bytes;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function prints the flash read throughput achieved since
+ * the boot device was initialized, logs it as a boot trace event and
+ * clears the statistics.
+ *
+ * @param	Stats is pointer to the flash statistics of the boot device
+ * @param	DevName is the name of the boot device
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+void XLoader_FlashStatsPrint(XLoader_FlashStats *Stats, const char *DevName)
+{
+	u64 TimeUs;
+	u32 RateKBps;
+	u32 ReadCycles = 0xFFFFFFFFU;
+	u32 IroFreqMHz = *XPlmi_GetPmcIroFreq() / XLOADER_FLASH_STATS_US_PER_SEC;
+
+	if ((Stats->ReadBytes == 0U) || (IroFreqMHz == 0U)) {
+		goto END;
+	}
+
+	TimeUs = Stats->ReadCycles / IroFreqMHz;
+	if (TimeUs == 0U) {
+		TimeUs = 1U;
+	}
+	RateKBps = (u32)((((u64)Stats->ReadBytes * XLOADER_FLASH_STATS_US_PER_SEC) /
+		TimeUs) >> XLOADER_FLASH_STATS_KB_SHIFT);
+
+	XPlmi_Printf(DEBUG_PRINT_PERF, "%u.%03u ms: %s read %u KB at %u KB/s\n\r",
+		(u32)(TimeUs / XLOADER_FLASH_STATS_US_PER_MS),
+		(u32)(TimeUs % XLOADER_FLASH_STATS_US_PER_MS), DevName,
+		Stats->ReadBytes >> XLOADER_FLASH_STATS_KB_SHIFT, RateKBps);
+
+	if (Stats->ReadCycles < 0xFFFFFFFFU) {
+		ReadCycles = (u32)Stats->ReadCycles;
+	}
+	XPlmi_TraceEvent(XPLMI_TRACE_ID(XPLMI_MODULE_LOADER_ID,
+		XPLMI_TRACE_INSTANT, XLOADER_TRACE_EVT_FLASH_READ),
+		Stats->ReadBytes, ReadCycles);
+
+END:
+	Stats->ReadCycles = 0U;
+	Stats->ReadStart = 0U;
+	Stats->ReadBytes = 0U;
+}
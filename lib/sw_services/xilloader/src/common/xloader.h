@@ -101,6 +101,8 @@
 *       bm   07/13/2022 Retain critical data structures after In-Place PLM Update
 *       ma   07/27/2022 Added support for CFrame data clear check which is
 *                        required during PL secure lockdown
+*       ant  10/18/2026 Added boot trace event IDs
+*       ant  10/18/2026 Added flash read throughput statistics
 *
 * </pre>
 *
@@ -158,6 +160,15 @@ extern "C" {
 #define XLOADER_PDISRC_FLAGS_MASK	(0xFU)
 #define XLOADER_PDISRC_FLAGS_SHIFT	(0x4U)
 
+/*
+ * Boot trace event IDs of XPLMI_MODULE_LOADER_ID
+ */
+#define XLOADER_TRACE_EVT_IMAGE		(0x1U) /* Arg1: Image ID */
+#define XLOADER_TRACE_EVT_PRTN		(0x2U) /* Arg1: Partition ID, Arg2: Length */
+#define XLOADER_TRACE_EVT_SIGN_VERIFY	(0x3U) /* Arg1: Authentication type */
+#define XLOADER_TRACE_EVT_AES_DECRYPT	(0x4U) /* Arg1: Length in bytes */
+#define XLOADER_TRACE_EVT_FLASH_READ	(0x5U) /* Arg1: Bytes, Arg2: Cycles */
+
 /*
  * PDI Loading status
  */
@@ -300,6 +311,16 @@ typedef struct {
 	int (*Release) (void);
 } XLoader_DeviceOps;
 
+/*
+ * Flash read statistics of a boot device, accumulated from device init
+ * till device release
+ */
+typedef struct {
+	u64 ReadCycles; /**< PIT cycles spent with a flash read in flight */
+	u64 ReadStart; /**< Start time of the outstanding non-blocking read */
+	u32 ReadBytes; /**< Number of bytes read from flash */
+} XLoader_FlashStats;
+
 /*
  * This is PDI instance pointer. This stores all the information
  * required for PDI
@@ -411,6 +432,9 @@ int XLoader_IntrInit(void);
 void XLoader_ClearIntrSbiDataRdy(void);
 XilPdi_ATFHandoffParams *XLoader_GetATFHandoffParamsAddr(void);
 int XLoader_IdCodeCheck(const XilPdi_ImgHdrTbl * ImgHdrTbl);
+void XLoader_FlashStatsUpdate(XLoader_FlashStats *Stats, u64 TStart,
+	u32 Bytes);
+void XLoader_FlashStatsPrint(XLoader_FlashStats *Stats, const char *DevName);
 
 /************************** Variable Definitions *****************************/
 extern XilPdi* BootPdiPtr;
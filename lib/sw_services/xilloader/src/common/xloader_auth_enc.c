@@ -88,6 +88,10 @@
 *       bsv  07/08/22 Changes related to Optional data in Image header table
 *       kpt  07/24/22 Added support to go into secure lockdown when KAT fails
 *       kpt  08/03/22 Added volatile keyword to avoid compiler optimization of loop redundancy checks
+*       ant  10/18/26 Added boot trace events for signature verification
+*                     and decryption
+*       ant  10/18/26 Start copy of second chunk once first chunk is processed
+*                     and account time spent in secure processing stages
 *
 * </pre>
 *
@@ -979,6 +983,7 @@ static int XLoader_VerifySignature(const XLoader_SecureParams *SecurePtr,
 {
 	volatile int Status = XST_FAILURE;
 	u32 AuthType;
+	u64 TStart = XPlmi_TraceTime();
 
 	if (SecurePtr->AuthJtagMessagePtr != NULL) {
 		AuthType = XLoader_GetAuthPubAlgo(&(SecurePtr->AuthJtagMessagePtr->AuthHdr));
@@ -1011,6 +1016,8 @@ static int XLoader_VerifySignature(const XLoader_SecureParams *SecurePtr,
 	}
 
 END:
+	XPlmi_TraceSpan(XPLMI_TRACE_ID(XPLMI_MODULE_LOADER_ID,
+		XPLMI_TRACE_SPAN, XLOADER_TRACE_EVT_SIGN_VERIFY), TStart, AuthType);
 	return Status;
 }
 
@@ -1975,6 +1982,7 @@ static int XLoader_AesDecryption(XLoader_SecureParams *SecurePtr,
 	volatile u8 DpaCmCfgTmp;
 	XLoader_AesKekInfo KeyDetails;
 	u64 SrcOffset = 0U;
+	u64 TStart = XPlmi_TraceTime();
 
 	SecurePtr->SecureDataLen = 0U;
 
@@ -2032,6 +2040,8 @@ static int XLoader_AesDecryption(XLoader_SecureParams *SecurePtr,
 	XPlmi_Printf(DEBUG_INFO, "AES Decryption is successful\r\n");
 
 END:
+	XPlmi_TraceSpan(XPLMI_TRACE_ID(XPLMI_MODULE_LOADER_ID,
+		XPLMI_TRACE_SPAN, XLOADER_TRACE_EVT_AES_DECRYPT), TStart, Size);
 	return Status;
 }
 
@@ -3319,6 +3329,7 @@ int XLoader_ProcessAuthEncPrtn(XLoader_SecureParams *SecurePtr, u64 DestAddr,
 	u32 TotalSize = BlockSize;
 	u64 SrcAddr;
 	u64 OutAddr;
+	u64 TStart;
 	XLoader_SecureTempParams *SecureTempParams = XLoader_GetTempParams();
 #ifdef PLM_PRINT_PERF_CDO_PROCESS
 	u64 ProcessTimeStart;
@@ -3379,14 +3390,18 @@ int XLoader_ProcessAuthEncPrtn(XLoader_SecureParams *SecurePtr, u64 DestAddr,
 	if ((SecurePtr->IsAuthenticated == (u8)TRUE) ||
 		(SecureTempParams->IsAuthenticated == (u8)TRUE)) {
 		/* Verify hash */
+		TStart = XPlmi_GetTimerValue();
 		XSECURE_TEMPORAL_CHECK(END, Status,
 					XLoader_VerifyAuthHashNUpdateNext,
 					SecurePtr, TotalSize, Last);
+		XLoader_SecureStageDone(SecurePtr, XLOADER_SECURE_STAGE_HASH,
+			TStart);
 
 		if (((SecurePtr->IsEncrypted != (u8)TRUE) &&
 			(SecureTempParams->IsEncrypted != (u8)TRUE)) &&
 			(SecurePtr->IsCdo != (u8)TRUE)) {
 			/* Copy to destination address */
+			TStart = XPlmi_GetTimerValue();
 			Status = XPlmi_DmaXfr((u64)SecurePtr->SecureData,
 					(u64)DestAddr,
 					SecurePtr->SecureDataLen >> XPLMI_WORD_LEN_SHIFT,
@@ -3396,6 +3411,8 @@ int XLoader_ProcessAuthEncPrtn(XLoader_SecureParams *SecurePtr, u64 DestAddr,
 						XLOADER_ERR_DMA_TRANSFER, Status);
 				goto END;
 			}
+			XLoader_SecureStageDone(SecurePtr, XLOADER_SECURE_STAGE_COPY,
+				TStart);
 		}
 	}
 
@@ -3414,6 +3431,7 @@ int XLoader_ProcessAuthEncPrtn(XLoader_SecureParams *SecurePtr, u64 DestAddr,
 		else {
 			OutAddr = SecurePtr->SecureData;
 		}
+		TStart = XPlmi_GetTimerValue();
 		Status = XLoader_AesDecryption(SecurePtr,
 					SecurePtr->SecureData,
 					OutAddr,
@@ -3423,14 +3441,25 @@ int XLoader_ProcessAuthEncPrtn(XLoader_SecureParams *SecurePtr, u64 DestAddr,
 					XLOADER_ERR_PRTN_DECRYPT_FAIL, Status);
 			goto END;
 		}
+		XLoader_SecureStageDone(SecurePtr, XLOADER_SECURE_STAGE_DECRYPT,
+			TStart);
 	}
 
 	XPlmi_Printf(DEBUG_INFO, "Authentication/Decryption of Block %u is "
 			"successful\r\n", SecurePtr->BlockNum);
 
+	Status = XLoader_SecureFirstChunkDone(SecurePtr, SrcAddr + TotalSize,
+		Last, BlockSize, TotalSize);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
 	SecurePtr->NextBlkAddr = SrcAddr + TotalSize;
 	SecurePtr->ProcessedLen = TotalSize;
 	SecurePtr->BlockNum++;
+	if (Last == (u8)TRUE) {
+		XLoader_SecurePrintStageTime(SecurePtr);
+	}
 
 END:
 #ifdef PLM_PRINT_PERF_CDO_PROCESS
@@ -48,6 +48,7 @@
 *       kpt  07/05/2022 Added support to update KAT status
 *       ma   07/08/22 Removed EFUSE_CACHE_MISC_CTRL as it is defined in xplmi_hw.h
 *       kpt  07/24/22 Added XLoader_RsaPssSignVerify to support KAT for versal net
+*       ant  10/18/26 Added per stage time of secure chunk processing
 *
 * </pre>
 *
@@ -437,6 +438,17 @@ typedef struct {
 } XLoader_AuthJtagMessage;
 #endif
 
+#define XLOADER_SECURE_STAGE_FETCH		(0U)
+			/**< Waiting for chunk data from boot device */
+#define XLOADER_SECURE_STAGE_HASH		(1U)
+			/**< SHA3 verification of chunk */
+#define XLOADER_SECURE_STAGE_DECRYPT		(2U)
+			/**< AES decryption of chunk */
+#define XLOADER_SECURE_STAGE_COPY		(3U)
+			/**< Copy of verified chunk to load address */
+#define XLOADER_SECURE_STAGE_MAX		(4U)
+			/**< Number of secure chunk processing stages */
+
 typedef struct XLoader_SecureParams {
 	volatile u8 SecureEn;	/**< Security enabled or disabled */
 	u8 IsNextChunkCopyStarted;	/**< Next chunk copy started or not */
@@ -461,6 +473,9 @@ typedef struct XLoader_SecureParams {
 				u32 BlockSize, u8 Last); /**< Function pointer to process
 				                          * partition chunk */
 	u16 DmaFlags;    /**< Flags indicate mode of copying */
+	u64 PrtnStartTime;	/**< Time when first chunk copy started */
+	u64 StageTime[XLOADER_SECURE_STAGE_MAX];
+				/**< Time spent in each processing stage */
 #ifndef PLM_SECURE_EXCLUDE
 	XLoader_AuthType SigType;	/**< Signature type */
 	XLoader_AuthCertificate *AcPtr;/**< Authentication certificate pointer */
@@ -33,6 +33,7 @@
 * 1.04  bsv  07/16/2021 Added Macronix flash support
 *       bsv  08/31/2021 Code clean up
 * 1.05  ma   01/17/2022 Enable SLVERR for OSPI registers
+*       ant  10/18/2026 Account flash read throughput
 *
 * </pre>
 *
@@ -69,6 +70,7 @@ static int XLoader_FlashSetDDRMode(XOspiPsv *OspiPsvPtr);
 static XOspiPsv OspiPsvInstance;
 static u8 OspiFlashMake;
 static u32 OspiFlashSize = 0U;
+static XLoader_FlashStats OspiStats;
 
 /*****************************************************************************/
 /**
@@ -225,6 +227,9 @@ int XLoader_OspiInit(u32 DeviceFlags)
 		goto END;
 	}
 
+	OspiStats.ReadCycles = 0U;
+	OspiStats.ReadBytes = 0U;
+
 	Status = (int)XOspiPsv_DeviceReset(XOSPIPSV_HWPIN_RESET);
 	if (Status != XST_SUCCESS) {
 		goto END;
@@ -433,6 +438,7 @@ int XLoader_OspiCopy(u64 SrcAddr, u64 DestAddr, u32 Length, u32 Flags)
 	u8 Proto;
 	u8 Dummy;
 	static u8 ChipSelect = XOSPIPSV_SELECT_FLASH_CS0;
+	u64 ReadStart = XPlmi_GetTimerValue();
 #ifdef PLM_PRINT_PERF_DMA
 	u64 OspiCopyTime = XPlmi_GetTimerValue();
 	XPlmi_PerfTime PerfTime = {0U};
@@ -448,6 +454,7 @@ int XLoader_OspiCopy(u64 SrcAddr, u64 DestAddr, u32 Length, u32 Flags)
 		do {
 			Status = (int)XOspiPsv_CheckDmaDone(&OspiPsvInstance);
 		} while (Status != XST_SUCCESS);
+		XLoader_FlashStatsUpdate(&OspiStats, OspiStats.ReadStart, 0U);
 		goto END1;
 	}
 	FlagsTmp = Flags;
@@ -561,7 +568,11 @@ int XLoader_OspiCopy(u64 SrcAddr, u64 DestAddr, u32 Length, u32 Flags)
 		Status = (int)XOspiPsv_StartDmaTransfer(&OspiPsvInstance, &FlashMsg);
 		if (Status != XST_SUCCESS) {
 			Status = XPlmi_UpdateStatus(XLOADER_ERR_OSPI_READ, Status);
+			goto END1;
 		}
+		/* Completion is accounted on WAIT_DONE */
+		OspiStats.ReadStart = ReadStart;
+		OspiStats.ReadBytes += Length;
 		goto END1;
 	}
 
@@ -620,7 +631,10 @@ int XLoader_OspiCopy(u64 SrcAddr, u64 DestAddr, u32 Length, u32 Flags)
 				Status = (int)XOspiPsv_StartDmaTransfer(&OspiPsvInstance, &FlashMsg);
 				if (Status != XST_SUCCESS) {
 					Status = XPlmi_UpdateStatus(XLOADER_ERR_OSPI_READ, Status);
+					goto END1;
 				}
+				OspiStats.ReadStart = ReadStart;
+				OspiStats.ReadBytes += Length;
 				goto END1;
 			}
 
@@ -633,6 +647,10 @@ int XLoader_OspiCopy(u64 SrcAddr, u64 DestAddr, u32 Length, u32 Flags)
 		}
 	}
 
+	if (Status == XST_SUCCESS) {
+		XLoader_FlashStatsUpdate(&OspiStats, ReadStart, Length);
+	}
+
 END1:
 #ifdef	PLM_PRINT_PERF_DMA
 	XPlmi_MeasurePerfTime(OspiCopyTime, &PerfTime);
@@ -896,6 +914,7 @@ int XLoader_OspiRelease(void)
 {
 	int Status = XST_FAILURE;
 
+	XLoader_FlashStatsPrint(&OspiStats, "OSPI");
 	Status = XPm_ReleaseDevice(PM_SUBSYS_PMC, PM_DEV_OSPI,
 		XPLMI_CMD_SECURE);
 
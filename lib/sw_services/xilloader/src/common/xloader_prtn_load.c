@@ -90,6 +90,7 @@
 *       bm   07/06/2022 Refactor versal and versal_net code
 *       dc   07/19/2022 Added support for data measurement in VersalNet
 *       bm   07/24/2022 Set PlmLiveStatus during boot time
+*       ant  10/18/2026 Added boot trace events for partition loads
 *
 * </pre>
 *
@@ -203,6 +204,10 @@ int XLoader_LoadImagePrtns(XilPdi* PdiPtr)
 		}
 
 		PrtnLoadTime = XPlmi_GetTimerValue();
+		XPlmi_TraceEvent(XPLMI_TRACE_ID(XPLMI_MODULE_LOADER_ID,
+			XPLMI_TRACE_BEGIN, XLOADER_TRACE_EVT_PRTN),
+			PdiPtr->MetaHdr.PrtnHdr[PdiPtr->PrtnNum].PrtnId,
+			PdiPtr->PrtnNum);
 		/* Prtn Hdr Validation */
 		Status = XLoader_PrtnHdrValidation(
 				&(PdiPtr->MetaHdr.PrtnHdr[PdiPtr->PrtnNum]), PdiPtr->PrtnNum);
@@ -219,6 +224,11 @@ int XLoader_LoadImagePrtns(XilPdi* PdiPtr)
 
 		/* Process Partition */
 		Status = XLoader_ProcessPrtn(PdiPtr);
+		XPlmi_TraceEvent(XPLMI_TRACE_ID(XPLMI_MODULE_LOADER_ID,
+			XPLMI_TRACE_END, XLOADER_TRACE_EVT_PRTN),
+			PdiPtr->MetaHdr.PrtnHdr[PdiPtr->PrtnNum].PrtnId,
+			PdiPtr->MetaHdr.PrtnHdr[PdiPtr->PrtnNum].TotalDataWordLen *
+			XPLMI_WORD_LEN);
 		if (XST_SUCCESS != Status) {
 			goto END;
 		}
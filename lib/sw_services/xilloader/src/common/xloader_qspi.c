@@ -35,6 +35,8 @@
 *       bsv  08/31/2021 Code clean up
 * 1.06  ma   01/17/2022 Enable SLVERR for QSPI registers
 * 1.07  bm   07/06/2022 Refactor versal and versal_net code
+*       ant  10/18/2026 Skip bank select when the bank is already selected
+*                       and account flash read throughput
 *
 * </pre>
 *
@@ -77,6 +79,8 @@ static u32 ReadCommand = 0U;
 static u8 QspiMode;
 static PdiSrc_t QspiBootMode;
 static u8 QspiBusWidth;
+static u32 QspiBankSel[XLOADER_QSPI_NUM_BANK_CS];
+static XLoader_FlashStats QspiStats;
 
 /*****************************************************************************/
 /**
@@ -234,6 +238,13 @@ int XLoader_QspiInit(u32 DeviceFlags)
 		goto END;
 	}
 	QspiBootMode = (PdiSrc_t)DeviceFlags;
+	/*
+	 * Bank register contents are unknown till the first bank select
+	 */
+	QspiBankSel[0U] = XLOADER_QSPI_BANK_SEL_INVALID;
+	QspiBankSel[XLOADER_QSPI_BANK_CS_UPPER] = XLOADER_QSPI_BANK_SEL_INVALID;
+	QspiStats.ReadCycles = 0U;
+	QspiStats.ReadBytes = 0U;
 	Status = XPlmi_MemSetBytes(&QspiPsuInstance, sizeof(QspiPsuInstance),
 				0U, sizeof(QspiPsuInstance));
 	if (Status != XST_SUCCESS) {
@@ -697,6 +708,7 @@ int XLoader_QspiCopy(u64 SrcAddr, u64 DestAddr, u32 Length, u32 Flags)
 	u32 QspiAddr;
 	u32 OrigAddr;
 	u32 BankSel;
+	u32 BankCs;
 	u32 RemainingBytes;
 	u32 TransferBytes;
 	u32 DiscardByteCnt;
@@ -707,6 +719,7 @@ int XLoader_QspiCopy(u64 SrcAddr, u64 DestAddr, u32 Length, u32 Flags)
 	u8 WriteBuffer[10U] __attribute__ ((aligned(32U))) = {0U};
 	u64 DestOffset = 0U;
 	u32 ParallelDmaFlags = Flags & XPLMI_DEVICE_COPY_STATE_MASK;
+	u64 ReadStart = XPlmi_GetTimerValue();
 
 #ifdef PLM_PRINT_PERF_DMA
 	u64 QspiCopyTime = XPlmi_GetTimerValue();
@@ -722,6 +735,7 @@ int XLoader_QspiCopy(u64 SrcAddr, u64 DestAddr, u32 Length, u32 Flags)
 		do {
 			Status = XQspiPsu_CheckDmaDone(&QspiPsuInstance);
 		} while (Status != XST_SUCCESS);
+		XLoader_FlashStatsUpdate(&QspiStats, QspiStats.ReadStart, 0U);
 		goto END;
 	}
 
@@ -817,13 +831,26 @@ int XLoader_QspiCopy(u64 SrcAddr, u64 DestAddr, u32 Length, u32 Flags)
 				else {
 					BankSel = QspiAddr / XLOADER_BANKSIZE;
 				}
-				Status = SendBankSelect(BankSel);
-				if (Status != XST_SUCCESS) {
-					Status = XPlmi_UpdateStatus(
-						XLOADER_ERR_QSPI_READ, Status);
-					XLoader_Printf(DEBUG_GENERAL,
-						"XLOADER_ERR_QSPI_READ\r\n");
-					goto END;
+				BankCs = 0U;
+				if (QspiPsuInstance.GenFifoCS ==
+					XQSPIPSU_GENFIFO_CS_UPPER) {
+					BankCs = XLOADER_QSPI_BANK_CS_UPPER;
+				}
+				/*
+				 * Bank select costs a write enable, a register write and
+				 * a read back, so skip it if the bank is already selected
+				 */
+				if (QspiBankSel[BankCs] != BankSel) {
+					QspiBankSel[BankCs] = XLOADER_QSPI_BANK_SEL_INVALID;
+					Status = SendBankSelect(BankSel);
+					if (Status != XST_SUCCESS) {
+						Status = XPlmi_UpdateStatus(
+							XLOADER_ERR_QSPI_READ, Status);
+						XLoader_Printf(DEBUG_GENERAL,
+							"XLOADER_ERR_QSPI_READ\r\n");
+						goto END;
+					}
+					QspiBankSel[BankCs] = BankSel;
 				}
 			}
 
@@ -880,7 +907,11 @@ int XLoader_QspiCopy(u64 SrcAddr, u64 DestAddr, u32 Length, u32 Flags)
 						XPLMI_ARRAY_SIZE(FlashMsg));
 			if (Status != XST_SUCCESS) {
 				Status = XPlmi_UpdateStatus(XLOADER_ERR_QSPI_READ, Status);
+				goto END;
 			}
+			/* Completion is accounted on WAIT_DONE */
+			QspiStats.ReadStart = ReadStart;
+			QspiStats.ReadBytes += Length;
 			goto END;
 		}
 
@@ -901,6 +932,7 @@ int XLoader_QspiCopy(u64 SrcAddr, u64 DestAddr, u32 Length, u32 Flags)
 		SrcAddrLow += TransferBytes;
 	}
 
+	XLoader_FlashStatsUpdate(&QspiStats, ReadStart, Length);
 	Status = XST_SUCCESS;
 
 END:
@@ -926,6 +958,7 @@ int XLoader_QspiRelease(void)
 {
 	int Status = XST_FAILURE;
 
+	XLoader_FlashStatsPrint(&QspiStats, "QSPI");
 	Status = XPm_ReleaseDevice(PM_SUBSYS_PMC, PM_DEV_QSPI, XPLMI_CMD_SECURE);
 
 	return Status;
@@ -30,6 +30,7 @@
 *       bsv  10/13/2020 Code clean up
 * 1.04  bsv  07/22/2021 Added support for Winbond flash part
 *       bsv  08/31/2021 Code clean up
+*       ant  10/18/2026 Added macros for caching the selected flash bank
 *
 * </pre>
 *
@@ -94,6 +95,13 @@ extern "C" {
  */
 #define XLOADER_BANKMASK		(~(XLOADER_BANKSIZE - 1U))
 #define XLOADER_WINBOND_BANKMASK		(~(XLOADER_WINBOND_BANKSIZE - 1U))
+/*
+ * Selected bank is cached per chip select, upper flash of a stacked
+ * configuration has its own bank register
+ */
+#define XLOADER_QSPI_NUM_BANK_CS		(2U)
+#define XLOADER_QSPI_BANK_CS_UPPER		(1U)
+#define XLOADER_QSPI_BANK_SEL_INVALID		(0xFFFFFFFFU)
 
 /*
  * Identification of Flash
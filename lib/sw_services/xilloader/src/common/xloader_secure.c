@@ -113,6 +113,8 @@
 *       bsv  02/14/22 Added comments for better readability
 *       kpt  02/18/22 Fixed copy to memory issue
 * 1.09  bm   07/06/22 Refactor versal and versal_net code
+*       ant  10/18/26 Start copy of second chunk once first chunk is processed
+*                     and account time spent in secure processing stages
 *
 * </pre>
 *
@@ -142,6 +144,8 @@
 					/**< SHA3 Reset register address */
 #define XLOADER_SHA3_RESET_VAL			(0x1U)
 					/**< SHA3 Reset value */
+#define XLOADER_SECURE_HZ_PER_MHZ		(1000000U)
+					/**< Used to convert cycles to us */
 
 /************************** Function Prototypes ******************************/
 static int XLoader_StartNextChunkCopy(XLoader_SecureParams *SecurePtr,
@@ -567,6 +571,7 @@ static int XLoader_ProcessChecksumPrtn(XLoader_SecureParams *SecurePtr,
 	u32 TotalSize = BlockSize;
 	u64 SrcAddr;
 	u64 DataAddr;
+	u64 TStart;
 #ifdef PLM_PRINT_PERF_CDO_PROCESS
 	u64 ProcessTimeStart;
 	u64 ProcessTimeEnd;
@@ -611,6 +616,7 @@ static int XLoader_ProcessChecksumPrtn(XLoader_SecureParams *SecurePtr,
 	}
 	else {
 		/* Copy to destination address */
+		TStart = XPlmi_GetTimerValue();
 		Status = XPlmi_DmaXfr((u64)SecurePtr->SecureData, DestAddr,
 				SecurePtr->SecureDataLen >> XPLMI_WORD_LEN_SHIFT,
 				XPLMI_PMCDMA_0);
@@ -619,15 +625,27 @@ static int XLoader_ProcessChecksumPrtn(XLoader_SecureParams *SecurePtr,
 					XLOADER_ERR_DMA_TRANSFER, Status);
 			goto END;
 		}
+		XLoader_SecureStageDone(SecurePtr, XLOADER_SECURE_STAGE_COPY, TStart);
 		DataAddr = DestAddr;
 	}
 	/* Verify hash on the data */
+	TStart = XPlmi_GetTimerValue();
 	XSECURE_TEMPORAL_CHECK(END, Status, XLoader_VerifyHashNUpdateNext,
 		SecurePtr, DataAddr, SecurePtr->SecureDataLen, Last);
+	XLoader_SecureStageDone(SecurePtr, XLOADER_SECURE_STAGE_HASH, TStart);
+
+	Status = XLoader_SecureFirstChunkDone(SecurePtr, SrcAddr + TotalSize,
+		Last, BlockSize, TotalSize);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
 
 	SecurePtr->NextBlkAddr = SrcAddr + TotalSize;
 	SecurePtr->ProcessedLen = TotalSize;
 	SecurePtr->BlockNum++;
+	if (Last == (u8)TRUE) {
+		XLoader_SecurePrintStageTime(SecurePtr);
+	}
 
 END:
 #ifdef PLM_PRINT_PERF_CDO_PROCESS
@@ -666,6 +684,11 @@ int XLoader_SecureChunkCopy(XLoader_SecureParams *SecurePtr, u64 SrcAddr,
 {
 	int Status = XST_FAILURE;
 	u8 Flags = XPLMI_DEVICE_COPY_STATE_BLK;
+	u64 TStart = XPlmi_GetTimerValue();
+
+	if (SecurePtr->BlockNum == 0U) {
+		SecurePtr->PrtnStartTime = TStart;
+	}
 
 	if (SecurePtr->IsNextChunkCopyStarted == (u8)TRUE) {
 		SecurePtr->IsNextChunkCopyStarted = (u8)FALSE;
@@ -698,10 +721,99 @@ int XLoader_SecureChunkCopy(XLoader_SecureParams *SecurePtr, u64 SrcAddr,
 					(SecurePtr->RemainingDataLen - TotalSize),
 					SrcAddr + TotalSize, BlockSize);
 	}
+	XLoader_SecureStageDone(SecurePtr, XLOADER_SECURE_STAGE_FETCH, TStart);
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* @brief	This function is called once the first chunk of a partition is
+* processed. Till then the second 32KB chunk of PMC RAM holds authentication
+* certificate, PUF data and RSA scratch buffers, so copy of second chunk
+* could not be started along with the first chunk. Starting it here lets the
+* copy overlap with processing of CDO commands of the first chunk instead of
+* waiting for it in blocking mode.
+*
+* @param	SecurePtr is pointer to the XLoader_SecureParams instance
+* @param	NextBlkAddr is the address of the second chunk
+* @param	Last notifies if the processed chunk is last or not
+* @param	BlockSize is size of the data block to be processed
+* @param	TotalSize is size of the first chunk including secure overhead
+*
+* @return	XST_SUCCESS on success and error code on failure
+*
+******************************************************************************/
+int XLoader_SecureFirstChunkDone(XLoader_SecureParams *SecurePtr,
+	u64 NextBlkAddr, u8 Last, u32 BlockSize, u32 TotalSize)
+{
+	int Status = XST_FAILURE;
+
+	if ((Last == (u8)TRUE) || (SecurePtr->BlockNum != 0U) ||
+		((SecurePtr->DmaFlags & XPLMI_PMCDMA_0) == XPLMI_PMCDMA_0)) {
+		Status = XST_SUCCESS;
+		goto END;
+	}
+
+	Status = XLoader_StartNextChunkCopy(SecurePtr,
+		(SecurePtr->RemainingDataLen - TotalSize), NextBlkAddr, BlockSize);
+
 END:
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+* @brief	This function adds the time elapsed since TStart to the given
+* processing stage of the partition.
+*
+* @param	SecurePtr is pointer to the XLoader_SecureParams instance
+* @param	Stage is the secure processing stage
+* @param	TStart is the timer value when the stage was started
+*
+* @return	None
+*
+******************************************************************************/
+void XLoader_SecureStageDone(XLoader_SecureParams *SecurePtr, u32 Stage,
+	u64 TStart)
+{
+	if (Stage < XLOADER_SECURE_STAGE_MAX) {
+		SecurePtr->StageTime[Stage] += TStart - XPlmi_GetTimerValue();
+	}
+}
+
+/*****************************************************************************/
+/**
+* @brief	This function prints the time spent in each secure processing
+* stage against the total time taken by the partition. Remaining time is
+* spent outside secure processing, such as in executing CDO commands.
+*
+* @param	SecurePtr is pointer to the XLoader_SecureParams instance
+*
+* @return	None
+*
+******************************************************************************/
+void XLoader_SecurePrintStageTime(const XLoader_SecureParams *SecurePtr)
+{
+#ifdef PLM_PRINT_PERF
+	u32 IroFreqMHz = *XPlmi_GetPmcIroFreq() / XLOADER_SECURE_HZ_PER_MHZ;
+	u64 TotalTime = SecurePtr->PrtnStartTime - XPlmi_GetTimerValue();
+
+	if (IroFreqMHz != 0U) {
+		XPlmi_Printf(DEBUG_PRINT_PERF, "%u us: Secure processing of %u chunks, "
+			"fetch wait %u us, hash %u us, decrypt %u us, copy %u us\n\r",
+			(u32)(TotalTime / IroFreqMHz), SecurePtr->BlockNum,
+			(u32)(SecurePtr->StageTime[XLOADER_SECURE_STAGE_FETCH] / IroFreqMHz),
+			(u32)(SecurePtr->StageTime[XLOADER_SECURE_STAGE_HASH] / IroFreqMHz),
+			(u32)(SecurePtr->StageTime[XLOADER_SECURE_STAGE_DECRYPT] / IroFreqMHz),
+			(u32)(SecurePtr->StageTime[XLOADER_SECURE_STAGE_COPY] / IroFreqMHz));
+	}
+#else
+	(void)SecurePtr;
+#endif
+}
+
 /*****************************************************************************/
 /**
 * @brief	This function checks if PPK is programmed.
@@ -58,6 +58,8 @@
 *       bsv  02/11/22 Code optimization to reduce text size
 *       kpt  02/18/22 Removed Flags param from XLoader_SecureInit function prototype
 * 1.08  dc   07/12/22 Moved error codes related to buffer clear to xplmi_status.h
+*       ant  10/18/26 Added APIs to prefetch second chunk and account time
+*                     spent in secure chunk processing stages
 *
 * </pre>
 *
@@ -112,6 +114,11 @@ int XLoader_SecureCopy(XLoader_SecureParams *SecurePtr, u64 DestAddr, u32 Size);
 int XLoader_SecureClear(void);
 int XLoader_SecureChunkCopy(XLoader_SecureParams *SecurePtr, u64 SrcAddr,
 			u8 Last, u32 BlockSize, u32 TotalSize);
+int XLoader_SecureFirstChunkDone(XLoader_SecureParams *SecurePtr,
+			u64 NextBlkAddr, u8 Last, u32 BlockSize, u32 TotalSize);
+void XLoader_SecureStageDone(XLoader_SecureParams *SecurePtr, u32 Stage,
+			u64 TStart);
+void XLoader_SecurePrintStageTime(const XLoader_SecureParams *SecurePtr);
 u32 XLoader_GetAHWRoT(const u32* AHWRoTPtr);
 u32 XLoader_GetSHWRoT(const u32* SHWRoTPtr);
 int XLoader_SetSecureState(void);
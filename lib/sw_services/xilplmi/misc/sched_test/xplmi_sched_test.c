@@ -0,0 +1,686 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xplmi_sched_test.c
+*
+* Host test of the deadline heap of the PLMI scheduler. The unmodified
+* xplmi_scheduler.c is built into this file against host replacements of
+* the PLM task, timer and interrupt interfaces, and driven by a fake tick.
+*
+* Every tick randomly adds periodic and non periodic tasks, removes tasks
+* (also with a wrong owner and for tasks that are not scheduled), lets the
+* queued PLM tasks run or stay queued, then calls XPlmi_SchedulerHandler().
+* A model of the expected trigger times is kept aside and checked that:
+* - the handler only triggers the root of the heap, never before its
+*   deadline, and in deadline order within a tick,
+* - a due task is queued if it was not, or reported missed once if it was,
+*   and no task that is not due is triggered,
+* - periodic tasks stay on multiples of their interval, non periodic tasks
+*   are released once triggered, removed tasks are never triggered again,
+* - the heap order, the heap positions of the tasks and the task count are
+*   consistent after every add, remove and tick.
+*
+* The test runs once from tick 0 and once across the wrap of the tick
+* counter, prints a summary of lines of
+*
+*	sched,<pass>,<metric>,<value>
+*
+* and exits with a non zero status if a check failed.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -----------------------------------------------
+* 1.00  ant  10/18/26 Initial release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "xil_types.h"
+#include "xstatus.h"
+
+/*
+ * Host replacements of xplmi_task.h and xplmi_debug.h. Their guards are
+ * defined so that the PLM headers included by xplmi_scheduler.c are
+ * skipped, the interfaces it uses are provided below instead.
+ */
+#define XPLMI_TASK_H
+#define XPLMI_DEBUG_H
+
+struct metal_list {
+	struct metal_list *next;
+	struct metal_list *prev;
+};
+
+static inline void metal_list_init(struct metal_list *list)
+{
+	list->next = list;
+	list->prev = list;
+}
+
+static inline int metal_list_is_empty(struct metal_list *list)
+{
+	return (list->next == list) ? 1 : 0;
+}
+
+static inline void metal_list_add_tail(struct metal_list *list,
+	struct metal_list *node)
+{
+	node->prev = list->prev;
+	node->next = list;
+	list->prev->next = node;
+	list->prev = node;
+}
+
+static inline void metal_list_del(struct metal_list *node)
+{
+	node->next->prev = node->prev;
+	node->prev->next = node->next;
+	metal_list_init(node);
+}
+
+#define XPLMI_INVALID_INTR_ID		(0xFFFFFFFFU)
+#define XPLMI_SCHED_TASK_MISSED		(0x1U)
+#define XPLM_TASK_PRIORITY_0		(0U)
+#define TaskPriority_t u8
+
+typedef struct XPlmi_TaskNode XPlmi_TaskNode;
+
+struct XPlmi_TaskNode {
+	u8 Priority;
+	u8 State;
+	u32 IntrId;
+	struct metal_list TaskNode;
+	int (*Handler)(void * PrivData);
+	void * PrivData;
+};
+
+typedef struct {
+	u64 TPerfMs;
+	u64 TPerfMsFrac;
+} XPlmi_PerfTime;
+
+typedef enum {
+	XPLMI_ERR_TASK_EXISTS = 0x131,
+	XPLMI_ERR_INVALID_TASK_TYPE,
+	XPLMI_ERR_INVALID_TASK_PERIOD,
+	XPLMI_ERR_SCHED_TASK_MISSED = 0x139,
+	XPLM_ERR_TASK_CREATE = 0x200,
+} XPlmiStatus_t;
+
+#define PMC_PMC_MB_IO_IRQ_ACK		(0xF028003CU)
+#define DEBUG_GENERAL			(0x1U)
+#define DEBUG_DETAILED			(0x4U)
+#define XPlmi_Printf(DebugType, ...)	((void)(DebugType))
+
+static inline int XPlmi_UpdateStatus(XPlmiStatus_t PlmiStatus,
+	int ModuleStatus)
+{
+	return (int)(((u32)PlmiStatus << 16U) | (u32)ModuleStatus);
+}
+
+XPlmi_TaskNode * XPlmi_TaskCreate(TaskPriority_t Priority,
+	int (*Handler)(void *Arg), void * PrivData);
+void XPlmi_TaskTriggerNow(XPlmi_TaskNode * Task);
+XPlmi_TaskNode* XPlmi_GetTaskInstance(int (*Handler)(void *Arg),
+	const void *PrivData, const u32 IntrId);
+u64 XPlmi_GetTimerValue(void);
+void XPlmi_MeasurePerfTime(u64 TCur, XPlmi_PerfTime *PerfTime);
+void XPlmi_UtilRMW(u32 RegAddr, u32 Mask, u32 Value);
+void microblaze_disable_interrupts(void);
+void microblaze_enable_interrupts(void);
+
+#include "xplmi_scheduler.c"
+
+/************************** Constant Definitions *****************************/
+#define NUM_CLIENTS		(16U)
+#define DEFAULT_TICKS		(1000000U)
+#define DEFAULT_SEED		(1U)
+#define WRAP_MARGIN		(1000U)
+
+/**************************** Type Definitions *******************************/
+/* One user of the scheduler, at most one task scheduled at a time */
+typedef struct {
+	u8 Active;	/**< Task scheduled */
+	u8 Type;	/**< XPLMI_PERIODIC_TASK or XPLMI_NON_PERIODIC_TASK */
+	u32 Ms;		/**< Period or delay given when added */
+	u32 Interval;	/**< Period in ticks */
+	u32 Next;	/**< Expected trigger time */
+	u8 WasQueued;	/**< PLM task queued before the tick */
+	u8 WasMissed;	/**< Missed execution already reported */
+	u32 Triggered;	/**< Times queued during the tick */
+	u32 Missed;	/**< Times reported missed during the tick */
+} Client;
+
+/************************** Function Prototypes ******************************/
+static u32 Rand(void);
+static int ClientHandler(void *Data);
+static void ClientError(int Status);
+static void Fail(const char *Msg, u32 ClientIdx);
+static void RecordDue(Client *C, u8 IsMissed);
+static XPlmi_TaskNode *FindNode(const Client *C);
+static u8 IsQueued(const Client *C);
+static u32 CountActive(void);
+static void CheckSched(void);
+static void DoAdd(void);
+static void DoRemove(void);
+static void DoTick(void);
+static void DrainQueue(void);
+static void RunPass(const char *Name, u32 StartTick, u32 Ticks);
+
+/************************** Variable Definitions *****************************/
+static Client Clients[NUM_CLIENTS];
+static XPlmi_TaskNode TaskPool[NUM_CLIENTS];
+static u32 TaskPoolCount;
+static struct metal_list TaskQueue = { &TaskQueue, &TaskQueue };
+static u64 FakeTimer;
+static u32 FakeElapsedMs;
+static u32 LastPopped;
+static u8 HasPopped;
+static u32 RandState = DEFAULT_SEED;
+static u64 Adds;
+static u64 Removes;
+static u64 Rejects;
+static u64 Triggers;
+static u64 Misses;
+static u64 Errors;
+
+/*
+ * Host replacements of the PLM task, timer and interrupt functions
+ */
+XPlmi_TaskNode * XPlmi_TaskCreate(TaskPriority_t Priority,
+	int (*Handler)(void *Arg), void * PrivData)
+{
+	XPlmi_TaskNode *Task = NULL;
+
+	if (TaskPoolCount < NUM_CLIENTS) {
+		Task = &TaskPool[TaskPoolCount++];
+		Task->Priority = Priority;
+		Task->State = 0U;
+		Task->Handler = Handler;
+		Task->PrivData = PrivData;
+		metal_list_init(&Task->TaskNode);
+	}
+
+	return Task;
+}
+
+void XPlmi_TaskTriggerNow(XPlmi_TaskNode * Task)
+{
+	metal_list_add_tail(&TaskQueue, &Task->TaskNode);
+	RecordDue((Client *)Task->PrivData, (u8)FALSE);
+}
+
+XPlmi_TaskNode* XPlmi_GetTaskInstance(int (*Handler)(void *Arg),
+	const void *PrivData, const u32 IntrId)
+{
+	u32 Idx;
+
+	for (Idx = 0U; Idx < TaskPoolCount; Idx++) {
+		if ((TaskPool[Idx].Handler == Handler) &&
+			(TaskPool[Idx].PrivData == PrivData) &&
+			((IntrId == XPLMI_INVALID_INTR_ID) ||
+			(TaskPool[Idx].IntrId == IntrId))) {
+			return &TaskPool[Idx];
+		}
+	}
+
+	return NULL;
+}
+
+u64 XPlmi_GetTimerValue(void)
+{
+	return FakeTimer;
+}
+
+void XPlmi_MeasurePerfTime(u64 TCur, XPlmi_PerfTime *PerfTime)
+{
+	(void)TCur;
+	PerfTime->TPerfMs = FakeElapsedMs;
+	PerfTime->TPerfMsFrac = 0U;
+}
+
+void XPlmi_UtilRMW(u32 RegAddr, u32 Mask, u32 Value)
+{
+	(void)RegAddr;
+	(void)Mask;
+	(void)Value;
+}
+
+void microblaze_disable_interrupts(void)
+{
+}
+
+void microblaze_enable_interrupts(void)
+{
+}
+
+void XPlmi_WdtHandler(void)
+{
+}
+
+static u32 Rand(void)
+{
+	/* xorshift32 */
+	RandState ^= RandState << 13;
+	RandState ^= RandState >> 17;
+	RandState ^= RandState << 5;
+	return RandState;
+}
+
+static int ClientHandler(void *Data)
+{
+	(void)Data;
+	return XST_SUCCESS;
+}
+
+static void ClientError(int Status)
+{
+	const void *Data = Sched.TaskList[Sched.Heap[0U]].Data;
+
+	if (Status != (int)XPLMI_ERR_SCHED_TASK_MISSED) {
+		Fail("unexpected error function status", NUM_CLIENTS);
+	}
+	RecordDue((Client *)Data, (u8)TRUE);
+}
+
+static void Fail(const char *Msg, u32 ClientIdx)
+{
+	fprintf(stderr, "tick 0x%08x client %u: %s\n", Sched.Tick, ClientIdx,
+		Msg);
+	Errors++;
+}
+
+/*
+ * Called when the handler queues a task or reports it missed: the task must
+ * be the root of the heap, due, and not due before the previous one.
+ */
+static void RecordDue(Client *C, u8 IsMissed)
+{
+	u32 ClientIdx = (u32)(C - Clients);
+	u8 Idx = Sched.Heap[0U];
+	u32 Time = Sched.TaskList[Idx].TriggerTime;
+
+	if ((Sched.TaskCount == 0U) || (Sched.TaskList[Idx].Data != C)) {
+		Fail("triggered task is not the heap root", ClientIdx);
+	}
+	if ((s32)(Time - Sched.Tick) > 0) {
+		Fail("triggered before its deadline", ClientIdx);
+	}
+	if ((HasPopped != 0U) && ((s32)(Time - LastPopped) < 0)) {
+		Fail("triggered out of deadline order", ClientIdx);
+	}
+	LastPopped = Time;
+	HasPopped = 1U;
+	if (IsMissed != 0U) {
+		C->Missed++;
+		Misses++;
+	} else {
+		C->Triggered++;
+		Triggers++;
+	}
+}
+
+static XPlmi_TaskNode *FindNode(const Client *C)
+{
+	return XPlmi_GetTaskInstance(ClientHandler, C, XPLMI_INVALID_INTR_ID);
+}
+
+static u8 IsQueued(const Client *C)
+{
+	XPlmi_TaskNode *Task = FindNode(C);
+	u8 Queued = 0U;
+
+	if ((Task != NULL) && (metal_list_is_empty(&Task->TaskNode) == 0)) {
+		Queued = 1U;
+	}
+
+	return Queued;
+}
+
+static u32 CountActive(void)
+{
+	u32 Count = 0U;
+	u32 Idx;
+
+	for (Idx = 0U; Idx < NUM_CLIENTS; Idx++) {
+		Count += Clients[Idx].Active;
+	}
+
+	return Count;
+}
+
+/*
+ * Checks the scheduler tables against the model and the heap invariants
+ */
+static void CheckSched(void)
+{
+	u32 Expected = 0U;
+	u32 Pos;
+	u32 Idx;
+	u32 ClientIdx;
+	u32 Found;
+	u8 SchedIdx = 0U;
+
+	for (Pos = 0U; Pos < Sched.TaskCount; Pos++) {
+		Idx = Sched.Heap[Pos];
+		if ((Idx >= XPLMI_SCHED_MAX_TASK) ||
+			(Sched.TaskList[Idx].HeapIdx != Pos) ||
+			(Sched.TaskList[Idx].CustomerFunc == NULL)) {
+			Fail("heap entry inconsistent", NUM_CLIENTS);
+			continue;
+		}
+		if ((Pos > 0U) && ((s32)(Sched.TaskList[Idx].TriggerTime -
+			Sched.TaskList[Sched.Heap[(Pos - 1U) >> 1U]].TriggerTime) <
+			0)) {
+			Fail("heap order violated", NUM_CLIENTS);
+		}
+	}
+	for (Idx = 0U; Idx < XPLMI_SCHED_MAX_TASK; Idx++) {
+		if ((Sched.TaskList[Idx].CustomerFunc == NULL) &&
+			(Sched.TaskList[Idx].HeapIdx != XPLMI_SCHED_INVALID_IDX)) {
+			Fail("free slot still in the heap", NUM_CLIENTS);
+		}
+	}
+
+	for (ClientIdx = 0U; ClientIdx < NUM_CLIENTS; ClientIdx++) {
+		Client *C = &Clients[ClientIdx];
+
+		Found = 0U;
+		for (Idx = 0U; Idx < XPLMI_SCHED_MAX_TASK; Idx++) {
+			if ((Sched.TaskList[Idx].CustomerFunc != NULL) &&
+				(Sched.TaskList[Idx].Data == C)) {
+				Found++;
+				SchedIdx = (u8)Idx;
+			}
+		}
+		if (C->Active == 0U) {
+			if (Found != 0U) {
+				Fail("released task still scheduled", ClientIdx);
+			}
+			continue;
+		}
+		if (Found != 1U) {
+			Fail("scheduled task not found once", ClientIdx);
+			continue;
+		}
+		if ((C->Type == XPLMI_PERIODIC_TASK) && (C->Interval == 0U)) {
+			if (Sched.TaskList[SchedIdx].HeapIdx !=
+				XPLMI_SCHED_INVALID_IDX) {
+				Fail("task below one tick in the heap", ClientIdx);
+			}
+			continue;
+		}
+		Expected++;
+		if (Sched.TaskList[SchedIdx].HeapIdx >= Sched.TaskCount) {
+			Fail("scheduled task not in the heap", ClientIdx);
+		} else if (Sched.TaskList[SchedIdx].TriggerTime != C->Next) {
+			Fail("wrong trigger time", ClientIdx);
+		}
+	}
+	if (Sched.TaskCount != Expected) {
+		Fail("wrong heap task count", NUM_CLIENTS);
+	}
+}
+
+/*
+ * Adds a task for a random client that has none, or checks the rejection of
+ * an invalid type, a null period or a task still queued.
+ */
+static void DoAdd(void)
+{
+	u32 ClientIdx = Rand() % NUM_CLIENTS;
+	Client *C = &Clients[ClientIdx];
+	u32 Pick = Rand() % 32U;
+	u8 Type = ((Pick & 1U) == 0U) ? (u8)XPLMI_PERIODIC_TASK :
+		(u8)XPLMI_NON_PERIODIC_TASK;
+	u32 Ms;
+	int Expected = XST_SUCCESS;
+	int Status;
+
+	if (C->Active != 0U) {
+		return;
+	}
+	if (Type == XPLMI_PERIODIC_TASK) {
+		/* Mostly multiples of the tick, some below one tick or null */
+		Ms = (1U + (Rand() % 20U)) * XPLMI_SCHED_TICK;
+		if (Pick == 2U) {
+			Ms = XPLMI_SCHED_TICK / 2U;
+		} else if (Pick == 4U) {
+			Ms = 0U;
+			Expected = XPlmi_UpdateStatus(
+				XPLMI_ERR_INVALID_TASK_PERIOD, 0);
+		}
+	} else {
+		Ms = Rand() % 300U;
+	}
+	if (Pick == 31U) {
+		Type = 2U;
+		Expected = XPlmi_UpdateStatus(XPLMI_ERR_INVALID_TASK_TYPE, 0);
+	} else if ((Expected == XST_SUCCESS) && (IsQueued(C) != 0U)) {
+		Expected = XPlmi_UpdateStatus(XPLMI_ERR_TASK_EXISTS, 0);
+	} else if ((Expected == XST_SUCCESS) &&
+		(CountActive() == XPLMI_SCHED_MAX_TASK)) {
+		Expected = XST_FAILURE;
+	}
+	FakeElapsedMs = Rand() % XPLMI_SCHED_TICK;
+
+	Status = XPlmi_SchedulerAddTask(ClientIdx + 1U, ClientHandler,
+		ClientError, Ms, XPLM_TASK_PRIORITY_0, C, Type);
+	if (Status != Expected) {
+		Fail("unexpected add status", ClientIdx);
+		return;
+	}
+	if (Status != XST_SUCCESS) {
+		Rejects++;
+		return;
+	}
+
+	Adds++;
+	C->Active = 1U;
+	C->Type = Type;
+	C->Ms = Ms;
+	C->Interval = Ms / XPLMI_SCHED_TICK;
+	if (Type == XPLMI_NON_PERIODIC_TASK) {
+		C->Next = Sched.Tick + ((((Sched.Tick == 0U) ?
+			(FakeElapsedMs % XPLMI_SCHED_TICK) : FakeElapsedMs) + Ms) /
+			XPLMI_SCHED_TICK);
+	} else if (C->Interval != 0U) {
+		C->Next = ((Sched.Tick / C->Interval) + 1U) * C->Interval;
+	} else {
+		C->Next = 0U;
+	}
+}
+
+/*
+ * Removes the task of a random client, checking that a wrong owner or an
+ * unscheduled task is rejected and that a queued PLM task is dequeued.
+ */
+static void DoRemove(void)
+{
+	u32 ClientIdx = Rand() % NUM_CLIENTS;
+	Client *C = &Clients[ClientIdx];
+	u32 Pick = Rand() % 8U;
+	u32 OwnerId = ClientIdx + 1U;
+	u32 Ms = C->Ms;
+	int Expected = XST_SUCCESS;
+	int Status;
+
+	if (Pick == 0U) {
+		OwnerId += NUM_CLIENTS;
+	} else if (Pick == 1U) {
+		Ms = 0U;
+	}
+	if ((C->Active == 0U) || (Pick == 0U)) {
+		Expected = XST_FAILURE;
+	}
+
+	Status = XPlmi_SchedulerRemoveTask(OwnerId, ClientHandler, Ms, C);
+	if (Status != Expected) {
+		Fail("unexpected remove status", ClientIdx);
+		return;
+	}
+	if (Status != XST_SUCCESS) {
+		Rejects++;
+		return;
+	}
+
+	Removes++;
+	C->Active = 0U;
+	if (IsQueued(C) != 0U) {
+		Fail("removed task still queued", ClientIdx);
+	}
+}
+
+/*
+ * Runs one scheduler tick and checks which tasks it triggered
+ */
+static void DoTick(void)
+{
+	u32 ClientIdx;
+	XPlmi_TaskNode *Task;
+
+	for (ClientIdx = 0U; ClientIdx < NUM_CLIENTS; ClientIdx++) {
+		Client *C = &Clients[ClientIdx];
+
+		Task = FindNode(C);
+		C->WasQueued = IsQueued(C);
+		C->WasMissed = ((Task != NULL) && ((Task->State &
+			XPLMI_SCHED_TASK_MISSED) != 0U)) ? 1U : 0U;
+		C->Triggered = 0U;
+		C->Missed = 0U;
+	}
+
+	HasPopped = 0U;
+	FakeTimer += 1000U;
+	XPlmi_SchedulerHandler(NULL);
+
+	for (ClientIdx = 0U; ClientIdx < NUM_CLIENTS; ClientIdx++) {
+		Client *C = &Clients[ClientIdx];
+		u8 IsDue = ((C->Active != 0U) &&
+			((C->Type == XPLMI_NON_PERIODIC_TASK) ||
+			(C->Interval != 0U)) &&
+			((s32)(C->Next - Sched.Tick) <= 0)) ? 1U : 0U;
+
+		if (IsDue == 0U) {
+			if ((C->Triggered != 0U) || (C->Missed != 0U)) {
+				Fail("triggered while not due", ClientIdx);
+			}
+			continue;
+		}
+		if (C->Triggered != ((C->WasQueued == 0U) ? 1U : 0U)) {
+			Fail("due task not queued once", ClientIdx);
+		}
+		if (C->Missed != (((C->WasQueued != 0U) &&
+			(C->WasMissed == 0U)) ? 1U : 0U)) {
+			Fail("missed execution not reported once", ClientIdx);
+		}
+		if (C->Type == XPLMI_NON_PERIODIC_TASK) {
+			C->Active = 0U;
+		} else {
+			do {
+				C->Next += C->Interval;
+			} while ((s32)(C->Next - Sched.Tick) <= 0);
+		}
+	}
+}
+
+/*
+ * Runs the queued PLM tasks, as the task dispatch loop does
+ */
+static void DrainQueue(void)
+{
+	struct metal_list *Node;
+
+	while (metal_list_is_empty(&TaskQueue) == 0) {
+		Node = TaskQueue.next;
+		metal_list_del(Node);
+	}
+}
+
+static void RunPass(const char *Name, u32 StartTick, u32 Ticks)
+{
+	u64 ErrorsBefore = Errors;
+	u32 ClientIdx;
+	u32 Tick;
+	u32 Op;
+
+	DrainQueue();
+	for (ClientIdx = 0U; ClientIdx < NUM_CLIENTS; ClientIdx++) {
+		Clients[ClientIdx].Active = 0U;
+	}
+	XPlmi_SchedulerInit();
+	Sched.Tick = StartTick;
+	Adds = 0U;
+	Removes = 0U;
+	Rejects = 0U;
+	Triggers = 0U;
+	Misses = 0U;
+
+	for (Tick = 0U; Tick < Ticks; Tick++) {
+		for (Op = Rand() % 4U; Op > 0U; Op--) {
+			if ((Rand() % 3U) == 0U) {
+				DoRemove();
+			} else {
+				DoAdd();
+			}
+			CheckSched();
+		}
+		/* Leave the PLM tasks queued now and then to miss deadlines */
+		if ((Rand() % 4U) != 0U) {
+			DrainQueue();
+		}
+		DoTick();
+		CheckSched();
+	}
+
+	printf("sched,%s,ticks,%u\n", Name, Ticks);
+	printf("sched,%s,adds,%llu\n", Name, (unsigned long long)Adds);
+	printf("sched,%s,removes,%llu\n", Name, (unsigned long long)Removes);
+	printf("sched,%s,rejects,%llu\n", Name, (unsigned long long)Rejects);
+	printf("sched,%s,triggers,%llu\n", Name, (unsigned long long)Triggers);
+	printf("sched,%s,misses,%llu\n", Name, (unsigned long long)Misses);
+	printf("sched,%s,errors,%llu\n", Name,
+	       (unsigned long long)(Errors - ErrorsBefore));
+}
+
+int main(int argc, char **argv)
+{
+	u32 Ticks = DEFAULT_TICKS;
+	int Opt;
+
+	while ((Opt = getopt(argc, argv, "n:s:")) != -1) {
+		switch (Opt) {
+		case 'n':
+			Ticks = (u32)strtoul(optarg, NULL, 0);
+			break;
+		case 's':
+			RandState = (u32)strtoul(optarg, NULL, 0);
+			break;
+		default:
+			fprintf(stderr, "usage: %s [-n ticks] [-s seed]\n",
+				argv[0]);
+			return 2;
+		}
+	}
+	if ((Ticks == 0U) || (RandState == 0U)) {
+		fprintf(stderr, "usage: %s [-n ticks] [-s seed]\n", argv[0]);
+		return 2;
+	}
+
+	RunPass("start", 0U, Ticks);
+	/* Cross the wrap of the tick counter half way through */
+	RunPass("wrap", 0U - (Ticks / 2U) - WRAP_MARGIN, Ticks);
+
+	return (Errors == 0U) ? 0 : 1;
+}
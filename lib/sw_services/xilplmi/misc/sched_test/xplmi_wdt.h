@@ -0,0 +1,36 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xplmi_wdt.h
+*
+* Host replacement of the PLMI watchdog interface for xplmi_sched_test.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -----------------------------------------------
+* 1.00  ant  10/18/26 Initial release
+* </pre>
+*
+******************************************************************************/
+
+#ifndef XPLMI_WDT_H
+#define XPLMI_WDT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void XPlmi_WdtHandler(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XPLMI_WDT_H */
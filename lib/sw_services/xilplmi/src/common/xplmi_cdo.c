@@ -50,6 +50,7 @@
 *       ma   07/25/2022 Enhancements to secure lockdown code
 *       bm   08/24/2022 Support Begin, Break and End commands across chunk
 *                       boundaries
+* 1.07  ant  10/18/2026 Added boot trace events for CDO chunks and commands
 *
 * </pre>
 *
@@ -289,6 +290,7 @@ static int XPlmi_CdoCmdExecute(XPlmiCdo *CdoPtr, u32 *BufPtr, u32 BufLen, u32 *S
 	XPlmi_Cmd *CmdPtr = &CdoPtr->Cmd;
 	u32 PrintLen;
 	u32 BufSize;
+	u64 TStart;
 
 	/*
 	 * Break if CMD says END of commands,
@@ -342,7 +344,10 @@ static int XPlmi_CdoCmdExecute(XPlmiCdo *CdoPtr, u32 *BufPtr, u32 BufLen, u32 *S
 	XPlmi_SetupCmd(CmdPtr, BufPtr, *Size);
 	CmdPtr->DeferredError = (u8)FALSE;
 	CmdPtr->ProcessedCdoLen = CdoPtr->ProcessedCdoLen;
+	TStart = XPlmi_TraceTime();
 	Status = XPlmi_CmdExecute(CmdPtr);
+	XPlmi_TraceSpan(XPLMI_TRACE_ID(XPLMI_MODULE_GENERIC_ID, XPLMI_TRACE_SPAN,
+		XPLMI_TRACE_EVT_CDO_CMD), TStart, CmdPtr->CmdId);
 	if (Status != XST_SUCCESS) {
 		XPlmi_Printf(DEBUG_GENERAL,
 			"CMD: 0x%08x execute failed, Processed Cdo Length 0x%0x\n\r",
@@ -385,6 +390,7 @@ int XPlmi_ProcessCdo(XPlmiCdo *CdoPtr)
 	u32 BufLen = CdoPtr->BufLen;
 	u32 RemainingLen;
 	u32 SldInitiated = XPlmi_IsSldInitiated();
+	u64 TStart = XPlmi_TraceTime();
 
 	/* Verify the header for the first chunk of CDO */
 	if (CdoPtr->Cdo1stChunk == (u8)TRUE) {
@@ -505,6 +511,8 @@ int XPlmi_ProcessCdo(XPlmiCdo *CdoPtr)
 	Status = XST_SUCCESS;
 
 END:
+	XPlmi_TraceSpan(XPLMI_TRACE_ID(XPLMI_MODULE_GENERIC_ID, XPLMI_TRACE_SPAN,
+		XPLMI_TRACE_EVT_CDO), TStart, CdoPtr->BufLen);
 	XPlmi_SetPlmLiveStatus();
 	return Status;
 }
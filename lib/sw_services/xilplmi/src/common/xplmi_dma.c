@@ -43,6 +43,7 @@
 *       bm   01/20/2022 Fix compilation warnings in Xil_SMemCpy
 *       skd  03/03/2022 Minor bug fix in XPlmi_MemCpy64
 * 1.07  bm   07/06/2022 Refactor versal and versal_net code
+*       ant  10/18/2026 Added boot trace events for DMA waits
 *
 * </pre>
 *
@@ -62,6 +63,8 @@
 
 /************************** Constant Definitions *****************************/
 #define XPLMI_XCSUDMA_DEST_CTRL_OFFSET		(0x80CU)
+#define XPLMI_TRACE_DMA_WAIT	XPLMI_TRACE_ID(XPLMI_MODULE_GENERIC_ID, \
+					XPLMI_TRACE_SPAN, XPLMI_TRACE_EVT_DMA_WAIT)
 
 /**************************** Type Definitions *******************************/
 
@@ -321,6 +324,7 @@ static int XPlmi_DmaChXfer(u64 Addr, u32 Len, XPmcDma_Channel Channel, u32 Flags
 	int Status = XST_FAILURE;
 	XPmcDma *DmaPtr;
 	XPlmi_WaitForDmaDone_t XPlmi_WaitForDmaDone;
+	u64 TStart;
 
 	/* Select DMA pointer */
 	if ((Flags & XPLMI_PMCDMA_0) == XPLMI_PMCDMA_0) {
@@ -353,7 +357,10 @@ static int XPlmi_DmaChXfer(u64 Addr, u32 Len, XPmcDma_Channel Channel, u32 Flags
 	if (XPlmi_WaitForDmaDone == NULL) {
 		goto END;
 	}
+	TStart = XPlmi_TraceTime();
 	Status = XPlmi_WaitForDmaDone(DmaPtr, Channel);
+	XPlmi_TraceSpan(XPLMI_TRACE_DMA_WAIT, TStart,
+		(u32)DmaPtr->Config.BaseAddress);
 	if (Status != XST_SUCCESS) {
 		Status = XPlmi_UpdateStatus(XPLMI_ERR_DMA_XFER_WAIT, 0);
 		goto END;
@@ -389,6 +396,7 @@ int XPlmi_WaitForNonBlkDma(u32 DmaFlags)
 {
 	int Status = XST_FAILURE;
 	XPmcDma* PmcDmaPtr = NULL;
+	u64 TStart = XPlmi_TraceTime();
 
 	if ((DmaFlags & XPLMI_PMCDMA_0) == XPLMI_PMCDMA_0) {
 		PmcDmaPtr = &PmcDma0;
@@ -411,6 +419,9 @@ int XPlmi_WaitForNonBlkDma(u32 DmaFlags)
 		goto END;
 	}
 
+	XPlmi_TraceSpan(XPLMI_TRACE_DMA_WAIT, TStart,
+		(u32)PmcDmaPtr->Config.BaseAddress);
+
 	/* To acknowledge the transfer has completed */
 	XPmcDma_IntrClear(PmcDmaPtr, XPMCDMA_SRC_CHANNEL,
 					XPMCDMA_IXR_DONE_MASK);
@@ -439,6 +450,7 @@ int XPlmi_WaitForNonBlkSrcDma(u32 DmaFlags)
 {
 	int Status = XST_FAILURE;
 	XPmcDma* PmcDmaPtr = NULL;
+	u64 TStart = XPlmi_TraceTime();
 
 	if ((DmaFlags & XPLMI_PMCDMA_0) == XPLMI_PMCDMA_0) {
 		PmcDmaPtr = &PmcDma0;
@@ -455,6 +467,9 @@ int XPlmi_WaitForNonBlkSrcDma(u32 DmaFlags)
 		goto END;
 	}
 
+	XPlmi_TraceSpan(XPLMI_TRACE_DMA_WAIT, TStart,
+		(u32)PmcDmaPtr->Config.BaseAddress);
+
 	/* To acknowledge the transfer has completed */
 	XPmcDma_IntrClear(PmcDmaPtr, XPMCDMA_SRC_CHANNEL,
 				XPMCDMA_IXR_DONE_MASK);
@@ -479,6 +494,7 @@ int XPlmi_WaitForNonBlkDestDma(u32 DmaFlags)
 {
 	int Status = XST_FAILURE;
 	XPmcDma* PmcDmaPtr = NULL;
+	u64 TStart = XPlmi_TraceTime();
 
 	if ((DmaFlags & XPLMI_PMCDMA_0) == XPLMI_PMCDMA_0) {
 		PmcDmaPtr = &PmcDma0;
@@ -494,6 +510,9 @@ int XPlmi_WaitForNonBlkDestDma(u32 DmaFlags)
 		goto END;
 	}
 
+	XPlmi_TraceSpan(XPLMI_TRACE_DMA_WAIT, TStart,
+		(u32)PmcDmaPtr->Config.BaseAddress);
+
 	/* To acknowledge the transfer has completed */
 	XPmcDma_IntrClear(PmcDmaPtr, XPMCDMA_DST_CHANNEL, XPMCDMA_IXR_DONE_MASK);
 	DmaCtrl.AxiBurstType = 0U;
@@ -47,6 +47,8 @@
 *                       XPlmi_InitDebugLogBuffer function
 * 1.06  bsv  06/03/2022 Add CommandInfo to a separate section in elf
 *       bm   07/06/2022 Refactor versal and versal_net code
+* 1.07  ant  10/18/2026 Added commands to retrieve task statistics
+*       ant  10/18/2026 Added fixed size boot trace event records
 *
 * </pre>
 *
@@ -65,6 +67,8 @@
 #include "xil_util.h"
 #include "xplmi_modules.h"
 #include "xplmi_plat.h"
+#include "xplmi_task.h"
+#include "xplmi_proc.h"
 
 /************************** Constant Definitions *****************************/
 
@@ -84,6 +88,9 @@
 #define XPLMI_TRACE_LOG_BUFFER	(0U)
 #define XPLMI_DEBUG_LOG_BUFFER	(1U)
 
+/* Number of words before the payload of a trace log record */
+#define XPLMI_TRACE_LOG_HDR_LEN	(3U)
+
 /**
  * @}
  * @endcond
@@ -217,6 +224,54 @@ static void XPlmi_RetrieveBufferInfo(XPlmi_Cmd *Cmd,
 	Cmd->Response[5U] = LogBuffer->IsBufferFull;
 }
 
+/*****************************************************************************/
+/**
+ * @brief	This function writes the statistics record of every task in use
+ * either to the given address or to the Trace Log buffer. Number of records
+ * and the PMC IRO frequency, which is needed to convert the PIT cycles to
+ * time, are returned in the command response.
+ *
+ * @param 	Cmd is the pointer to command structure
+ * @param 	DestAddr to which the records are to be written, ignored if
+ *		ToTraceLog is TRUE
+ * @param 	ToTraceLog is TRUE to write the records to Trace Log buffer
+ * @param 	Reset is non-zero to clear the statistics after reading them
+ *
+ *****************************************************************************/
+static void XPlmi_RetrieveTaskStats(XPlmi_Cmd *Cmd, u64 DestAddr,
+		u8 ToTraceLog, u32 Reset)
+{
+	u32 Record[XPLMI_TRACE_LOG_HDR_LEN + XPLMI_TASK_STATS_LEN];
+	u32 *Stats = &Record[XPLMI_TRACE_LOG_HDR_LEN];
+	u32 Index;
+	u32 Word;
+	u32 NumRecords = 0U;
+	u64 Addr = DestAddr;
+
+	for (Index = 0U; Index < XPLMI_TASK_MAX; Index++) {
+		if (XPlmi_GetTaskStats(Index, Stats) != XST_SUCCESS) {
+			continue;
+		}
+		if (ToTraceLog == (u8)TRUE) {
+			Record[0U] = XPLMI_TRACE_LOG_TASK_STATS;
+			XPlmi_StoreTraceLog(Record, XPLMI_ARRAY_SIZE(Record));
+		}
+		else {
+			for (Word = 0U; Word < XPLMI_TASK_STATS_LEN; Word++) {
+				XPlmi_Out64(Addr, Stats[Word]);
+				Addr += XPLMI_WORD_LEN;
+			}
+		}
+		NumRecords++;
+	}
+	if (Reset != 0U) {
+		XPlmi_ResetTaskStats();
+	}
+
+	Cmd->Response[1U] = NumRecords;
+	Cmd->Response[2U] = *XPlmi_GetPmcIroFreq();
+}
+
 /**
  * @}
  * @endcond
@@ -248,6 +303,12 @@ static void XPlmi_RetrieveBufferInfo(XPlmi_Cmd *Cmd,
  *		8 - Configure Uart
  *			Arg1 - Uart Select
  *			Arg2 - Uart Enable
+ *		9 - Retrieve task statistics
+ *			Arg1 - High Address
+ *			Arg2 - Low Address
+ *			Arg3 - Clear statistics if non-zero
+ *		10 - Write task statistics to Trace Log buffer
+ *			Arg3 - Clear statistics if non-zero
  *
  * @param	Cmd is pointer to the command structure
 
@@ -305,6 +366,15 @@ int XPlmi_EventLogging(XPlmi_Cmd * Cmd)
 		case XPLMI_LOGGING_CMD_CONFIG_UART:
 			Status = XPlmi_ConfigUart((u8)Arg1, (u8)Arg2);
 			break;
+		case XPLMI_LOGGING_CMD_RETRIEVE_TASK_STATS:
+			XPlmi_RetrieveTaskStats(Cmd, (Arg1 << 32U) | Arg2,
+				(u8)FALSE, Arg3);
+			Status = XST_SUCCESS;
+			break;
+		case XPLMI_LOGGING_CMD_LOG_TASK_STATS:
+			XPlmi_RetrieveTaskStats(Cmd, 0U, (u8)TRUE, Arg3);
+			Status = XST_SUCCESS;
+			break;
 		default:
 			XPlmi_Printf(DEBUG_GENERAL,
 				"Received invalid event logging command\n\r");
@@ -319,6 +389,33 @@ int XPlmi_EventLogging(XPlmi_Cmd * Cmd)
  * @{
  * @cond xplmi_internal
  */
+/*****************************************************************************/
+/**
+ * @brief	This function writes the words of a trace record to the Trace
+ * Log buffer, wrapping around at the end of the buffer.
+ *
+ * @param	TraceData to be stored to buffer
+ * @param	Len is number of words in TraceData
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+static void XPlmi_WriteTraceLog(const u32 *TraceData, u32 Len)
+{
+	u32 Index;
+	XPlmi_CircularBuffer *TraceLog = XPlmi_GetTraceLogInst();
+
+	for (Index = 0U; Index < Len; Index++) {
+		if (TraceLog->Offset >= TraceLog->Len) {
+			TraceLog->Offset = 0x0U;
+			TraceLog->IsBufferFull = (u32)TRUE;
+		}
+
+		XPlmi_Out64((TraceLog->StartAddr + TraceLog->Offset), TraceData[Index]);
+		TraceLog->Offset += XPLMI_WORD_LEN;
+	}
+}
+
 /*****************************************************************************/
 /**
  * @brief	This function stores the trace events to the Trace Log buffer.
@@ -331,9 +428,7 @@ int XPlmi_EventLogging(XPlmi_Cmd * Cmd)
  *****************************************************************************/
 void XPlmi_StoreTraceLog(u32 *TraceData, u32 Len)
 {
-	u32 Index;
 	XPlmi_PerfTime PerfTime;
-	XPlmi_CircularBuffer *TraceLog = XPlmi_GetTraceLogInst();
 
 	/* Get time stamp of PLM */
 	XPlmi_MeasurePerfTime((XPLMI_PIT1_CYCLE_VALUE << 32U) |
@@ -343,16 +438,79 @@ void XPlmi_StoreTraceLog(u32 *TraceData, u32 Len)
 	TraceData[1U] = (u32)PerfTime.TPerfMs;
 	TraceData[2U] = (u32)PerfTime.TPerfMsFrac;
 
-	for (Index = 0U; Index < Len; Index++) {
-		if (TraceLog->Offset >= TraceLog->Len) {
-			TraceLog->Offset = 0x0U;
-			TraceLog->IsBufferFull = (u32)TRUE;
-		}
+	XPlmi_WriteTraceLog(TraceData, Len);
+}
 
-		XPlmi_Out64((TraceLog->StartAddr + TraceLog->Offset), TraceData[Index]);
-		TraceLog->Offset += XPLMI_WORD_LEN;
+#ifndef PLM_BOOT_TRACE_EXCLUDE
+/*****************************************************************************/
+/**
+ * @brief	This function returns the boot trace time stamp, which is the
+ * number of PIT cycles elapsed since the PIT timers were started.
+ *
+ * @return	Time stamp in PIT cycles
+ *
+ *****************************************************************************/
+u64 XPlmi_TraceTime(void)
+{
+	return ((XPLMI_PIT1_CYCLE_VALUE << 32U) | XPLMI_PIT2_CYCLE_VALUE) -
+		XPlmi_GetTimerValue();
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function stores a boot trace event record with raw time
+ * stamp to the Trace Log buffer. Unlike XPlmi_StoreTraceLog, no time
+ * conversion is done so that it can be used in the boot path.
+ *
+ * @param	Event is built with XPLMI_TRACE_ID
+ * @param	Arg1 of the event
+ * @param	Arg2 of the event
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+void XPlmi_TraceEvent(u32 Event, u32 Arg1, u32 Arg2)
+{
+	u64 Time = XPlmi_TraceTime();
+	u32 Record[XPLMI_TRACE_EVENT_LEN];
+
+	Record[0U] = XPLMI_TRACE_LOG_EVENT |
+		(XPLMI_TRACE_EVENT_LEN << XPLMI_TRACE_LOG_LEN_SHIFT);
+	Record[1U] = (u32)(Time >> 32U);
+	Record[2U] = (u32)Time;
+	Record[3U] = Event;
+	Record[4U] = Arg1;
+	Record[5U] = Arg2;
+
+	XPlmi_WriteTraceLog(Record, XPLMI_TRACE_EVENT_LEN);
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function stores a boot trace event for an operation started
+ * at TStart, if it took at least XPLMI_TRACE_SPAN_MIN_CYCLES. The record
+ * time stamp is the end of the operation and Arg2 is its duration.
+ *
+ * @param	Event is built with XPLMI_TRACE_ID and XPLMI_TRACE_SPAN phase
+ * @param	TStart is the time stamp returned by XPlmi_TraceTime at the
+ *		start of the operation
+ * @param	Arg1 of the event
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+void XPlmi_TraceSpan(u32 Event, u64 TStart, u32 Arg1)
+{
+	u64 Duration = XPlmi_TraceTime() - TStart;
+
+	if (Duration >= XPLMI_TRACE_SPAN_MIN_CYCLES) {
+		if (Duration > 0xFFFFFFFFU) {
+			Duration = 0xFFFFFFFFU;
+		}
+		XPlmi_TraceEvent(Event, Arg1, (u32)Duration);
 	}
 }
+#endif
 
 /*****************************************************************************/
 /**
@@ -29,6 +29,8 @@
 *       bsv  07/19/2021 Disable UART prints when invalid header is encountered
 *                       in slave boot modes
 *       bm   08/12/2021 Added support to configure uart during run-time
+* 1.05  ant  10/18/2026 Added task statistics sub commands
+*       ant  10/18/2026 Added fixed size boot trace event records
 *
 *
 * </pre>
@@ -47,6 +49,7 @@ extern "C" {
 /***************************** Include Files *********************************/
 #include "xplmi_cmd.h"
 #include "xplmi_util.h"
+#include "xplmi_config.h"
 
 /************************** Constant Definitions *****************************/
 
@@ -75,6 +78,17 @@ typedef struct {
 int XPlmi_EventLogging(XPlmi_Cmd * Cmd);
 void XPlmi_StoreTraceLog(u32 *TraceData, u32 Len);
 void XPlmi_InitDebugLogBuffer(void);
+#ifndef PLM_BOOT_TRACE_EXCLUDE
+u64 XPlmi_TraceTime(void);
+void XPlmi_TraceEvent(u32 Event, u32 Arg1, u32 Arg2);
+void XPlmi_TraceSpan(u32 Event, u64 TStart, u32 Arg1);
+#else
+#define XPlmi_TraceTime()	(0U)
+#define XPlmi_TraceEvent(Event, Arg1, Arg2)	\
+	((void)(Event), (void)(Arg1), (void)(Arg2))
+#define XPlmi_TraceSpan(Event, TStart, Arg1)	\
+	((void)(Event), (void)(TStart), (void)(Arg1))
+#endif
 
 /***************** Macros (Inline Functions) Definitions *********************/
 /** Event Logging sub command IDs */
@@ -86,6 +100,8 @@ void XPlmi_InitDebugLogBuffer(void);
 #define XPLMI_LOGGING_CMD_RETRIEVE_TRACE_DATA	(0x6U)
 #define XPLMI_LOGGING_CMD_RETRIEVE_TRACE_BUFFER_INFO	(0x7U)
 #define XPLMI_LOGGING_CMD_CONFIG_UART			(0x8U)
+#define XPLMI_LOGGING_CMD_RETRIEVE_TASK_STATS	(0x9U)
+#define XPLMI_LOGGING_CMD_LOG_TASK_STATS		(0xAU)
 #define XPLMI_LOG_LEVEL_SHIFT		(0x4U)
 
 /* Trace log buffer length shift */
@@ -93,6 +109,45 @@ void XPlmi_InitDebugLogBuffer(void);
 
 /* Trace event IDs */
 #define XPLMI_TRACE_LOG_LOAD_IMAGE		(0x1U)
+#define XPLMI_TRACE_LOG_TASK_STATS		(0x2U)
+#define XPLMI_TRACE_LOG_EVENT			(0x3U)
+
+/*
+ * Boot trace event record, XPLMI_TRACE_EVENT_LEN words
+ * 		0U - Header with XPLMI_TRACE_LOG_EVENT ID
+ * 		1U - Time stamp in PIT cycles, higher 32 bits
+ * 		2U - Time stamp in PIT cycles, lower 32 bits
+ * 		3U - Event: Module ID[31:24], Phase[23:16], Event ID[15:0]
+ * 		4U - Arg1
+ * 		5U - Arg2, duration in PIT cycles for XPLMI_TRACE_SPAN events
+ * Time stamps are counted from PIT start and are converted to time by the
+ * host using the PMC IRO frequency logged with XPLMI_TRACE_EVT_CLOCK.
+ */
+#define XPLMI_TRACE_EVENT_LEN			(6U)
+
+/* Boot trace event phases */
+#define XPLMI_TRACE_INSTANT			(0x0U)
+#define XPLMI_TRACE_BEGIN			(0x1U)
+#define XPLMI_TRACE_END				(0x2U)
+#define XPLMI_TRACE_SPAN			(0x3U)
+
+/* Boot trace event word from module ID, phase and module specific event ID */
+#define XPLMI_TRACE_ID(ModuleId, Phase, EventId)	\
+	(((u32)(ModuleId) << 24U) | ((u32)(Phase) << 16U) | (u32)(EventId))
+
+/* Boot trace event IDs of XPLMI_MODULE_GENERIC_ID */
+#define XPLMI_TRACE_EVT_CLOCK			(0x1U) /**< Arg1: PMC IRO freq */
+#define XPLMI_TRACE_EVT_CDO			(0x2U) /**< Arg1: CDO chunk length */
+#define XPLMI_TRACE_EVT_CDO_CMD			(0x3U) /**< Arg1: Cmd ID */
+#define XPLMI_TRACE_EVT_DMA_WAIT		(0x4U) /**< Arg1: DMA base */
+
+/*
+ * SPAN events shorter than below PIT cycles are not logged, to keep frequent
+ * operations like CDO commands and DMA waits from flooding the buffer
+ */
+#ifndef XPLMI_TRACE_SPAN_MIN_CYCLES
+#define XPLMI_TRACE_SPAN_MIN_CYCLES		(4000U)
+#endif
 
 /*
  * Trace log functions
@@ -44,6 +44,7 @@
 *       bm   03/16/2022 Fix ROM time calculation
 * 1.07  skd  04/21/2022 Misra-C violation Rule 18.1 fixed
 * 1.08  bm   07/06/2022 Refactor versal and versal_net code
+*       ant  10/18/2026 Log PMC IRO frequency to boot trace
 *
 * </pre>
 *
@@ -326,6 +327,10 @@ int XPlmi_StartTimer(void)
 	XPlmi_InitPitTimer((u8)XPLMI_PIT1, Pit1ResetValue);
 	XPlmi_InitPitTimer((u8)XPLMI_PIT3, Pit3ResetValue);
 
+	/* Host needs the PIT frequency to convert boot trace time stamps */
+	XPlmi_TraceEvent(XPLMI_TRACE_ID(XPLMI_MODULE_GENERIC_ID,
+		XPLMI_TRACE_INSTANT, XPLMI_TRACE_EVT_CLOCK), PmcIroFreq, 0U);
+
 END:
 	return Status;
 }
@@ -43,6 +43,8 @@
 * 1.06  skg  06/20/2022 Misra-C violation Rule 10.4 fixed
 *       sk   06/27/2022 Updated logic in XPlmi_SchedulerAddTask to fix task
 *                       creation error
+* 1.07  ant  10/18/2026 Keep tasks in a heap ordered by deadline so that a
+*                       tick only handles the tasks that are due
 *
 * </pre>
 *
@@ -66,6 +68,7 @@
 /***************** Macros (Inline Functions) Definitions *********************/
 
 #define XPLMI_SCHED_TICK	(10U)
+#define XPLMI_SCHED_INVALID_IDX	(0xFFU)
 
 /**
  * @}
@@ -73,8 +76,8 @@
  */
 
 /************************** Function Prototypes ******************************/
-static u8 XPlmi_IsTaskNonPeriodic(const XPlmi_Scheduler_t *SchedPtr,
-	u32 TaskListIndex);
+static void XPlmi_SchedHeapInsert(XPlmi_Scheduler_t *SchedPtr, u8 TaskIdx);
+static void XPlmi_SchedHeapRemove(XPlmi_Scheduler_t *SchedPtr, u8 TaskIdx);
 
 /************************** Variable Definitions *****************************/
 static XPlmi_Scheduler_t Sched;
@@ -83,62 +86,206 @@ static XPlmi_Scheduler_t Sched;
 
 /******************************************************************************/
 /**
-* @brief	The function checks the specified task is active or not, returns
-* corresponding status of the task
+* @brief	The function checks if the deadline of a task in the heap is
+* before the deadline of another one. Deadlines are compared as a difference
+* so that the Tick counter can wrap.
 *
 * @param    	SchedPtr is Scheduler pointer
-* @param    	TaskListIndex is Task index
+* @param    	Pos1 is the heap position of the first task
+* @param    	Pos2 is the heap position of the second task
 *
-* @return	TRUE or FALSE based on the task active status
+* @return	TRUE if the first task is due before the second one, else FALSE
 *
 ****************************************************************************/
-static u8 XPlmi_IsTaskActive(XPlmi_Scheduler_t *SchedPtr, u32 TaskListIndex)
+static u8 XPlmi_SchedIsBefore(const XPlmi_Scheduler_t *SchedPtr, u32 Pos1,
+	u32 Pos2)
 {
+	u32 Time1 = SchedPtr->TaskList[SchedPtr->Heap[Pos1]].TriggerTime;
+	u32 Time2 = SchedPtr->TaskList[SchedPtr->Heap[Pos2]].TriggerTime;
 	u8 ReturnVal = (u8)FALSE;
 
-	if (NULL == SchedPtr->TaskList[TaskListIndex].CustomerFunc) {
-		goto END;
+	if ((s32)(Time1 - Time2) < 0) {
+		ReturnVal = (u8)TRUE;
+	}
+
+	return ReturnVal;
+}
+
+/******************************************************************************/
+/**
+* @brief	The function swaps two entries of the deadline heap.
+*
+* @param    	SchedPtr is Scheduler pointer
+* @param    	Pos1 is the first heap position
+* @param    	Pos2 is the second heap position
+*
+* @return	None
+*
+****************************************************************************/
+static void XPlmi_SchedHeapSwap(XPlmi_Scheduler_t *SchedPtr, u32 Pos1,
+	u32 Pos2)
+{
+	u8 TaskIdx = SchedPtr->Heap[Pos1];
+
+	SchedPtr->Heap[Pos1] = SchedPtr->Heap[Pos2];
+	SchedPtr->Heap[Pos2] = TaskIdx;
+	SchedPtr->TaskList[SchedPtr->Heap[Pos1]].HeapIdx = (u8)Pos1;
+	SchedPtr->TaskList[SchedPtr->Heap[Pos2]].HeapIdx = (u8)Pos2;
+}
+
+/******************************************************************************/
+/**
+* @brief	The function moves a heap entry towards the root until its parent
+* is not due after it.
+*
+* @param    	SchedPtr is Scheduler pointer
+* @param    	Pos is the heap position of the entry
+*
+* @return	None
+*
+****************************************************************************/
+static void XPlmi_SchedHeapUp(XPlmi_Scheduler_t *SchedPtr, u32 Pos)
+{
+	u32 Idx = Pos;
+	u32 Parent;
+
+	while (Idx > 0U) {
+		Parent = (Idx - 1U) >> 1U;
+		if (XPlmi_SchedIsBefore(SchedPtr, Idx, Parent) != (u8)TRUE) {
+			break;
+		}
+		XPlmi_SchedHeapSwap(SchedPtr, Idx, Parent);
+		Idx = Parent;
 	}
+}
 
-	if (XPlmi_IsTaskNonPeriodic(SchedPtr, TaskListIndex) == (u8)TRUE) {
-		if (SchedPtr->TaskList[TaskListIndex].TriggerTime <=
-			SchedPtr->Tick) {
-			ReturnVal = (u8)TRUE;
+/******************************************************************************/
+/**
+* @brief	The function moves a heap entry towards the leaves until none of
+* its children is due before it.
+*
+* @param    	SchedPtr is Scheduler pointer
+* @param    	Pos is the heap position of the entry
+*
+* @return	None
+*
+****************************************************************************/
+static void XPlmi_SchedHeapDown(XPlmi_Scheduler_t *SchedPtr, u32 Pos)
+{
+	u32 Idx = Pos;
+	u32 Child;
+
+	while (1) {
+		Child = (Idx << 1U) + 1U;
+		if (Child >= SchedPtr->TaskCount) {
+			break;
 		}
-	} else {
-		if ((0U != SchedPtr->TaskList[TaskListIndex].Interval)
-		&& (0U == (SchedPtr->Tick
-		% SchedPtr->TaskList[TaskListIndex].Interval))) {
-			/* Periodic */
-			ReturnVal = (u8)TRUE;
+		if (((Child + 1U) < SchedPtr->TaskCount) &&
+			(XPlmi_SchedIsBefore(SchedPtr, Child + 1U, Child) ==
+			(u8)TRUE)) {
+			Child++;
 		}
+		if (XPlmi_SchedIsBefore(SchedPtr, Child, Idx) != (u8)TRUE) {
+			break;
+		}
+		XPlmi_SchedHeapSwap(SchedPtr, Idx, Child);
+		Idx = Child;
 	}
+}
 
-END:
-	return ReturnVal;
+/******************************************************************************/
+/**
+* @brief	The function adds a task to the deadline heap. TriggerTime of the
+* task must be set before calling this function.
+*
+* @param    	SchedPtr is Scheduler pointer
+* @param    	TaskIdx is the Task index
+*
+* @return	None
+*
+****************************************************************************/
+static void XPlmi_SchedHeapInsert(XPlmi_Scheduler_t *SchedPtr, u8 TaskIdx)
+{
+	u32 Pos = SchedPtr->TaskCount;
+
+	SchedPtr->Heap[Pos] = TaskIdx;
+	SchedPtr->TaskList[TaskIdx].HeapIdx = (u8)Pos;
+	SchedPtr->TaskCount++;
+	XPlmi_SchedHeapUp(SchedPtr, Pos);
 }
 
 /******************************************************************************/
 /**
-* @brief	The function checks the specified task is periodic or not, returns
-* corresponding periodicity status.
+* @brief	The function removes a task from the deadline heap, if present.
 *
-* @param    SchedPtr is the Scheduler pointer
-* @param    TaskListIndex is the Task index
+* @param    	SchedPtr is Scheduler pointer
+* @param    	TaskIdx is the Task index
 *
-* @return	TRUE or FALSE based on the task peridocity status
+* @return	None
 *
 ****************************************************************************/
-static u8 XPlmi_IsTaskNonPeriodic(const XPlmi_Scheduler_t *SchedPtr,
-	u32 TaskListIndex)
+static void XPlmi_SchedHeapRemove(XPlmi_Scheduler_t *SchedPtr, u8 TaskIdx)
 {
-	u8 ReturnVal = (u8)FALSE;
+	u32 Pos = SchedPtr->TaskList[TaskIdx].HeapIdx;
+	u32 Last;
 
-	if (SchedPtr->TaskList[TaskListIndex].Type == XPLMI_NON_PERIODIC_TASK) {
-		ReturnVal = (u8)TRUE;
+	if (Pos == XPLMI_SCHED_INVALID_IDX) {
+		goto END;
 	}
 
-	return ReturnVal;
+	SchedPtr->TaskList[TaskIdx].HeapIdx = XPLMI_SCHED_INVALID_IDX;
+	SchedPtr->TaskCount--;
+	Last = SchedPtr->TaskCount;
+	if (Pos != Last) {
+		/* Move the last entry to the hole and restore the heap order */
+		SchedPtr->Heap[Pos] = SchedPtr->Heap[Last];
+		SchedPtr->TaskList[SchedPtr->Heap[Pos]].HeapIdx = (u8)Pos;
+		XPlmi_SchedHeapUp(SchedPtr, Pos);
+		XPlmi_SchedHeapDown(SchedPtr, SchedPtr->TaskList[
+			SchedPtr->Heap[Pos]].HeapIdx);
+	}
+
+END:
+	return;
+}
+
+/******************************************************************************/
+/**
+* @brief	The function queues the PLM task of a scheduler task which is due,
+* or reports a missed execution if the previous one is still queued.
+*
+* @param    	SchedPtr is Scheduler pointer
+* @param    	TaskIdx is the Task index
+*
+* @return	None
+*
+****************************************************************************/
+static void XPlmi_SchedTriggerTask(XPlmi_Scheduler_t *SchedPtr, u8 TaskIdx)
+{
+	XPlmi_TaskNode *Task = SchedPtr->TaskList[TaskIdx].Task;
+
+	/* Skip the task, if its already present in the queue */
+	if (metal_list_is_empty(&Task->TaskNode) == (int)TRUE) {
+		Task->State &= (u8)(~XPLMI_SCHED_TASK_MISSED);
+		XPlmi_TaskTriggerNow(Task);
+	} else {
+		/*
+		 * Check if a module has registered ErrorFunc for the task and
+		 * the previously scheduled task is executed or not
+		 */
+		if ((SchedPtr->TaskList[TaskIdx].ErrorFunc != NULL) &&
+			((Task->State & (u8)(XPLMI_SCHED_TASK_MISSED)) ==
+					(u8)0x0U)) {
+			/* Update scheduler task state with task missed flag */
+			Task->State |= (u8)XPLMI_SCHED_TASK_MISSED;
+			/*
+			 * Call the task specific ErrorFunc if
+			 * previously scheduled task is not executed
+			 */
+			SchedPtr->TaskList[TaskIdx].ErrorFunc(
+				XPLMI_ERR_SCHED_TASK_MISSED);
+		}
+	}
 }
 
 /******************************************************************************/
@@ -157,8 +304,10 @@ void XPlmi_SchedulerInit(void)
 	for (Idx = 0U; Idx < XPLMI_SCHED_MAX_TASK; Idx++) {
 		Sched.TaskList[Idx].Interval = 0U;
 		Sched.TaskList[Idx].CustomerFunc = NULL;
+		Sched.TaskList[Idx].HeapIdx = XPLMI_SCHED_INVALID_IDX;
 	}
 
+	Sched.TaskCount = 0U;
 	Sched.LastTimerTick = XPlmi_GetTimerValue();
 	Sched.Tick = 0U;
 }
@@ -168,6 +317,10 @@ void XPlmi_SchedulerInit(void)
 * @brief	The function is scheduler handler and it is called at regular
 * intervals based on configured interval. Scheduler handler checks and adds the
 * user periodic task to PLM task queue.
+* Tasks are kept in a heap ordered by their next trigger time, so a tick with
+* no task due only looks at the root of the heap. Periodic tasks are moved
+* by their interval from their previous trigger time, which keeps them on
+* multiples of their interval.
 *
 * @param	Data - Not used currently. Added as a part of generic interrupt
 *               handler
@@ -179,42 +332,31 @@ void XPlmi_SchedulerHandler(void *Data)
 {
 	u8 Idx;
 	(void)Data;
-	XPlmi_TaskNode *Task = NULL;
 
 	Sched.LastTimerTick = XPlmi_GetTimerValue();
 	Sched.Tick++;
 	XPlmi_UtilRMW(PMC_PMC_MB_IO_IRQ_ACK, PMC_PMC_MB_IO_IRQ_ACK, 0x20U);
-	for (Idx = 0U; Idx < XPLMI_SCHED_MAX_TASK; Idx++) {
-		/* Check if the task is active and has a valid Callback */
-		if (XPlmi_IsTaskActive(&Sched, Idx) == (u8)TRUE) {
-			Task = Sched.TaskList[Idx].Task;
-			/* Skip the task, if its already present in the queue */
-			if (metal_list_is_empty(&Task->TaskNode) == (int)TRUE) {
-				Task->State &= (u8)(~XPLMI_SCHED_TASK_MISSED);
-				XPlmi_TaskTriggerNow(Task);
-			} else {
-				/*
-				 * Check if a module has registered ErrorFunc for the task and
-				 * the previously scheduled task is executed or not
-				 */
-				if ((Sched.TaskList[Idx].ErrorFunc != NULL) &&
-					((Task->State & (u8)(XPLMI_SCHED_TASK_MISSED)) ==
-							(u8)0x0U)) {
-					/* Update scheduler task state with task missed flag */
-					Task->State |= (u8)XPLMI_SCHED_TASK_MISSED;
-					/*
-					 * Call the task specific ErrorFunc if
-					 * previously scheduled task is not executed
-					 */
-					Sched.TaskList[Idx].ErrorFunc(XPLMI_ERR_SCHED_TASK_MISSED);
-				}
-			}
-			/* Remove the task from scheduler if it is non-periodic*/
-			if (Sched.TaskList[Idx].Type == XPLMI_NON_PERIODIC_TASK) {
-				Sched.TaskList[Idx].OwnerId = 0U;
-				Sched.TaskList[Idx].CustomerFunc = NULL;
-				Sched.TaskList[Idx].ErrorFunc = NULL;
-			}
+	while (Sched.TaskCount > 0U) {
+		Idx = Sched.Heap[0U];
+		/* Earliest deadline is in the future, nothing more is due */
+		if ((s32)(Sched.TaskList[Idx].TriggerTime - Sched.Tick) > 0) {
+			break;
+		}
+		XPlmi_SchedTriggerTask(&Sched, Idx);
+		/* Remove the task from scheduler if it is non-periodic*/
+		if (Sched.TaskList[Idx].Type == XPLMI_NON_PERIODIC_TASK) {
+			XPlmi_SchedHeapRemove(&Sched, Idx);
+			Sched.TaskList[Idx].OwnerId = 0U;
+			Sched.TaskList[Idx].CustomerFunc = NULL;
+			Sched.TaskList[Idx].ErrorFunc = NULL;
+		} else {
+			/* Skip the periods that have already elapsed, if any */
+			do {
+				Sched.TaskList[Idx].TriggerTime +=
+					Sched.TaskList[Idx].Interval;
+			} while ((s32)(Sched.TaskList[Idx].TriggerTime -
+					Sched.Tick) <= 0);
+			XPlmi_SchedHeapDown(&Sched, 0U);
 		}
 	}
 	XPlmi_WdtHandler();
@@ -290,6 +432,7 @@ int XPlmi_SchedulerAddTask(u32 OwnerId, XPlmi_Callback_t CallbackFn,
 			}
 
 			if (Task == NULL) {
+				Sched.TaskList[Idx].CustomerFunc = NULL;
 				Status = XPlmi_UpdateStatus(XPLM_ERR_TASK_CREATE, 0);
 				XPlmi_Printf(DEBUG_GENERAL, "Task Creation "
 						"Err:0x%x\n\r", Status);
@@ -297,8 +440,8 @@ int XPlmi_SchedulerAddTask(u32 OwnerId, XPlmi_Callback_t CallbackFn,
 			}
 			Task->IntrId = XPLMI_INVALID_INTR_ID;
 			Sched.TaskList[Idx].Task = Task;
+			microblaze_disable_interrupts();
 			if (TaskType != XPLMI_PERIODIC_TASK) {
-				microblaze_disable_interrupts();
 				XPlmi_MeasurePerfTime(Sched.LastTimerTick, &ExtraTime);
 				if (Sched.Tick == 0U) {
 					ExtraTime.TPerfMs %= XPLMI_SCHED_TICK;
@@ -306,9 +449,21 @@ int XPlmi_SchedulerAddTask(u32 OwnerId, XPlmi_Callback_t CallbackFn,
 				TriggerTime = Sched.Tick +
 					   (((u32)ExtraTime.TPerfMs + MilliSeconds) /
 					   XPLMI_SCHED_TICK);
-				microblaze_enable_interrupts();
+			} else if (Sched.TaskList[Idx].Interval != 0U) {
+				/* First multiple of the interval after this tick */
+				TriggerTime = ((Sched.Tick /
+					Sched.TaskList[Idx].Interval) + 1U) *
+					Sched.TaskList[Idx].Interval;
+			} else {
+				/* Periods below one tick are never triggered */
+				TriggerTime = 0U;
 			}
 			Sched.TaskList[Idx].TriggerTime = TriggerTime;
+			if ((TaskType != XPLMI_PERIODIC_TASK) ||
+				(Sched.TaskList[Idx].Interval != 0U)) {
+				XPlmi_SchedHeapInsert(&Sched, Idx);
+			}
+			microblaze_enable_interrupts();
 			Status = XST_SUCCESS;
 			break;
 		}
@@ -352,6 +507,7 @@ int XPlmi_SchedulerRemoveTask(u32 OwnerId, XPlmi_Callback_t CallbackFn,
 			Sched.TaskList[Idx].CustomerFunc = NULL;
 			Sched.TaskList[Idx].Data = NULL;
 			microblaze_disable_interrupts();
+			XPlmi_SchedHeapRemove(&Sched, Idx);
 			if (metal_list_is_empty(&Sched.TaskList[Idx].Task->TaskNode) ==
 				(int)FALSE) {
 				metal_list_del(&Sched.TaskList[Idx].Task->TaskNode);
@@ -30,6 +30,7 @@
 *       bsv  07/16/2021 Fix doxygen warnings
 *       bsv  08/15/2021 Removed redundant element in structure
 * 1.04  bm   07/06/2022 Refactor versal and versal_net code
+* 1.05  ant  10/18/2026 Added deadline heap to the scheduler structure
 *
 * </pre>
 *
@@ -68,12 +69,15 @@ struct XPlmi_Task_t{
 	XPlmi_TaskNode *Task;
 	const void *Data;
 	u8 Type;
+	u8 HeapIdx;	/**< Position in the deadline heap */
 };
 
 typedef struct {
 	struct XPlmi_Task_t TaskList[XPLMI_SCHED_MAX_TASK];
+	u8 Heap[XPLMI_SCHED_MAX_TASK]; /**< TaskList indices, earliest
+					  TriggerTime first */
 	u64 LastTimerTick;
-	u32 TaskCount;
+	u32 TaskCount;	/**< Number of tasks in the heap */
 	u32 Tick;
 } XPlmi_Scheduler_t ;
 
@@ -41,6 +41,8 @@
 *                       same priority
 *       bsv  03/11/2022 Restore race condition fix that got disturbed by
 *                       previous patch
+* 1.08  ant  10/18/2026 Find the highest priority ready queue from a bitmap
+*                       and collect run time statistics of every task
 *
 * </pre>
 *
@@ -60,11 +62,15 @@
 /**************************** Type Definitions *******************************/
 
 /***************** Macros (Inline Functions) Definitions *********************/
+#define XPLMI_TASK_PRIORITY_MASK(Priority)	((u32)1U << (Priority))
 
 /************************** Function Prototypes ******************************/
 
 /************************** Variable Definitions *****************************/
 static struct metal_list TaskQueue[XPLMI_TASK_PRIORITIES];
+/* Bit N is set if TaskQueue[N] may have pending tasks */
+static volatile u32 TaskReadyMask;
+static XPlmi_TaskNode Tasks[XPLMI_TASK_MAX];
 
 /*****************************************************************************/
 
@@ -101,6 +107,12 @@ XPlmi_TaskNode* XPlmi_TaskCreate(TaskPriority_t Priority,
 	Task->Handler = Handler;
 	Task->PrivData = PrivData;
 	Task->State = (u8)0x0U;
+	Task->QueuedTime = 0U;
+	Task->Stats.Count = 0U;
+	Task->Stats.MaxTime = 0U;
+	Task->Stats.TotalTime = 0U;
+	Task->Stats.MaxLatency = 0U;
+	Task->Stats.TotalLatency = 0U;
 
 END:
 	return Task;
@@ -122,7 +134,6 @@ XPlmi_TaskNode* XPlmi_GetTaskInstance(int (*Handler)(void *Arg),
 		const void *PrivData, const u32 IntrId)
 {
 	XPlmi_TaskNode *Task = NULL;
-	static XPlmi_TaskNode Tasks[XPLMI_TASK_MAX];
 	u8 Index;
 
 	for (Index = 0U; Index < XPLMI_TASK_MAX; Index++) {
@@ -161,8 +172,10 @@ void XPlmi_TaskTriggerNow(XPlmi_TaskNode *Task)
 {
 	Xil_AssertVoid(Task->Handler != NULL);
 	if (metal_list_is_empty(&Task->TaskNode) != (int)FALSE) {
+		Task->QueuedTime = XPlmi_GetTimerValue();
 		metal_list_add_tail(&TaskQueue[Task->Priority],
 			&Task->TaskNode);
+		TaskReadyMask |= XPLMI_TASK_PRIORITY_MASK(Task->Priority);
 	}
 }
 
@@ -182,13 +195,199 @@ void XPlmi_TaskInit(void)
 	for (Index = 0U; Index < XPLMI_TASK_PRIORITIES; Index++) {
 		metal_list_init(&TaskQueue[Index]);
 	}
+	TaskReadyMask = 0U;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function returns the elapsed PIT cycles between two timer
+ * values. PIT counts down, so the start value is the larger one.
+ *
+ * @param	TStart is the timer value at the start
+ * @param	TEnd is the timer value at the end
+ *
+ * @return	Elapsed cycles, saturated to 32 bits
+ *
+ *****************************************************************************/
+static u32 XPlmi_TaskElapsed(u64 TStart, u64 TEnd)
+{
+	u64 Elapsed = 0U;
+
+	if (TStart > TEnd) {
+		Elapsed = TStart - TEnd;
+	}
+	if (Elapsed > (u64)0xFFFFFFFFU) {
+		Elapsed = (u64)0xFFFFFFFFU;
+	}
+
+	return (u32)Elapsed;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function updates the statistics of a task after its handler
+ * has run.
+ *
+ * @param	Task Pointer to the task node
+ * @param	TStart is the timer value when the task is dequeued
+ * @param	TEnd is the timer value when the handler returns
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+static void XPlmi_TaskUpdateStats(XPlmi_TaskNode *Task, u64 TStart, u64 TEnd)
+{
+	u32 Time = XPlmi_TaskElapsed(TStart, TEnd);
+	u32 Latency = XPlmi_TaskElapsed(Task->QueuedTime, TStart);
+
+	Task->Stats.Count++;
+	Task->Stats.TotalTime += Time;
+	if (Time > Task->Stats.MaxTime) {
+		Task->Stats.MaxTime = Time;
+	}
+	Task->Stats.TotalLatency += Latency;
+	if (Latency > Task->Stats.MaxLatency) {
+		Task->Stats.MaxLatency = Latency;
+	}
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function fills the statistics record of a task. Record
+ * format is
+ *		0 - Handler address
+ *		1 - Private data address
+ *		2 - Priority
+ *		3 - Number of times the handler is called
+ *		4 - Longest handler run time
+ *		5 - Cumulative handler run time (high word)
+ *		6 - Cumulative handler run time (low word)
+ *		7 - Longest time spent in the task queue
+ *		8 - Cumulative time spent in the task queue (high word)
+ *		9 - Cumulative time spent in the task queue (low word)
+ *		Times are in PIT cycles.
+ *
+ * @param	Index is the index of the task node
+ * @param	Record is the buffer of XPLMI_TASK_STATS_LEN words to be filled
+ *
+ * @return	XST_SUCCESS if the task node is in use, XST_FAILURE otherwise
+ *
+ *****************************************************************************/
+int XPlmi_GetTaskStats(u32 Index, u32 *Record)
+{
+	int Status = XST_FAILURE;
+	const XPlmi_TaskNode *Task;
+
+	if (Index >= XPLMI_TASK_MAX) {
+		goto END;
+	}
+	Task = &Tasks[Index];
+	if (Task->Handler == NULL) {
+		goto END;
+	}
+
+	microblaze_disable_interrupts();
+	Record[0U] = (u32)(UINTPTR)Task->Handler;
+	Record[1U] = (u32)(UINTPTR)Task->PrivData;
+	Record[2U] = Task->Priority;
+	Record[3U] = Task->Stats.Count;
+	Record[4U] = Task->Stats.MaxTime;
+	Record[5U] = (u32)(Task->Stats.TotalTime >> 32U);
+	Record[6U] = (u32)(Task->Stats.TotalTime & 0xFFFFFFFFU);
+	Record[7U] = Task->Stats.MaxLatency;
+	Record[8U] = (u32)(Task->Stats.TotalLatency >> 32U);
+	Record[9U] = (u32)(Task->Stats.TotalLatency & 0xFFFFFFFFU);
+	microblaze_enable_interrupts();
+	Status = XST_SUCCESS;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function clears the statistics of all the tasks.
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+void XPlmi_ResetTaskStats(void)
+{
+	u32 Index;
+
+	microblaze_disable_interrupts();
+	for (Index = 0U; Index < XPLMI_TASK_MAX; Index++) {
+		Tasks[Index].Stats.Count = 0U;
+		Tasks[Index].Stats.MaxTime = 0U;
+		Tasks[Index].Stats.TotalTime = 0U;
+		Tasks[Index].Stats.MaxLatency = 0U;
+		Tasks[Index].Stats.TotalLatency = 0U;
+	}
+	microblaze_enable_interrupts();
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function removes the first task from the highest priority
+ * queue which is not empty. It must be called with interrupts disabled.
+ * Queues can also be emptied without going through the dispatcher, so a
+ * ready bit whose queue is empty is cleared and the next one is checked.
+ *
+ * @return	Pointer to the task node, NULL if all queues are empty
+ *
+ *****************************************************************************/
+static XPlmi_TaskNode *XPlmi_TaskDequeue(void)
+{
+	XPlmi_TaskNode *Task = NULL;
+	u32 Mask = TaskReadyMask;
+	u32 Index;
+
+	while (Mask != 0U) {
+		/* Lowest set bit is the highest priority */
+		Index = (u32)__builtin_ctz(Mask);
+		if (metal_list_is_empty(&TaskQueue[Index]) == (int)FALSE) {
+			Task = metal_container_of(TaskQueue[Index].next,
+				XPlmi_TaskNode, TaskNode);
+			metal_list_del(&Task->TaskNode);
+			if (metal_list_is_empty(&TaskQueue[Index]) != (int)FALSE) {
+				Mask &= ~XPLMI_TASK_PRIORITY_MASK(Index);
+			}
+			break;
+		}
+		Mask &= ~XPLMI_TASK_PRIORITY_MASK(Index);
+	}
+	TaskReadyMask = Mask;
+
+	return Task;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function rebuilds the ready bitmap from the task queues. It
+ * must be called with interrupts disabled.
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+static void XPlmi_TaskSyncReadyMask(void)
+{
+	u32 Index;
+	u32 Mask = 0U;
+
+	for (Index = 0U; Index < XPLMI_TASK_PRIORITIES; Index++) {
+		if (metal_list_is_empty(&TaskQueue[Index]) == (int)FALSE) {
+			Mask |= XPLMI_TASK_PRIORITY_MASK(Index);
+		}
+	}
+	TaskReadyMask = Mask;
 }
 
 /*****************************************************************************/
 /**
  * @brief	This function will be checking for tasks in the queue based on the
  * priority. After calling every task handlers, next high priority task will
- * be called.
+ * be called. Tasks of the same priority are called in the order they are
+ * queued. Interrupts are disabled only while a task is removed from its queue.
  *
  * @return	None
  *
@@ -196,56 +395,32 @@ void XPlmi_TaskInit(void)
 void XPlmi_TaskDispatchLoop(void)
 {
 	int Status = XST_FAILURE;
-	struct metal_list *Node[XPLMI_TASK_PRIORITIES];
 	XPlmi_TaskNode *Task;
-	u32 Index;
-#ifdef PLM_DEBUG_DETAILED
 	u64 TaskStartTime;
+#ifdef PLM_DEBUG_DETAILED
 	XPlmi_PerfTime PerfTime = {0U};
 #endif
 
 	XPlmi_Printf(DEBUG_DETAILED, "%s\n\r", __func__);
-	for (Index = 0U; Index < XPLMI_TASK_PRIORITIES; Index++) {
-		Node[Index] = &TaskQueue[Index];
-	}
 
 	while (TRUE) {
-		Task = NULL;
 		XPlmi_SetPlmLiveStatus();
 
 		microblaze_disable_interrupts();
-		/* Priority based task handling */
-		for (Index = 0U; Index < XPLMI_TASK_PRIORITIES; Index++) {
-			/* If no pending tasks are present, go to sleep */
-			if (metal_list_is_empty(&TaskQueue[Index]) != (int)FALSE) {
-				XPlmi_Printf(DEBUG_DETAILED,
-				 "No pending tasks in Priority%d Queue\n\r",
-				 Index);
-				continue;
-			} else {
-				/* Skip the first element as it
-				 * is not proper task
-				 */
-				if ((metal_list_is_empty(Node[Index]) != (int)FALSE) ||
-					(Node[Index] == &TaskQueue[Index])) {
-					Node[Index] = TaskQueue[Index].next;
-				}
-				/* Get the next task in round robin */
-				Task = metal_container_of(Node[Index],
-					XPlmi_TaskNode, TaskNode);
-				Node[Index] = Node[Index]->next;
-				break;
-			}
+		Task = XPlmi_TaskDequeue();
+		if (Task == NULL) {
+			/* Ready bits can be lost if a queue is updated outside */
+			XPlmi_TaskSyncReadyMask();
+			Task = XPlmi_TaskDequeue();
 		}
 		if (Task != NULL) {
-#ifdef PLM_DEBUG_DETAILED
+			microblaze_enable_interrupts();
+			Xil_AssertVoid(Task->Handler != NULL);
 			/* Call the task handler */
 			TaskStartTime = XPlmi_GetTimerValue();
-#endif
-			Xil_AssertVoid(Task->Handler != NULL);
-			metal_list_del(&Task->TaskNode);
-			microblaze_enable_interrupts();
 			Status = Task->Handler(Task->PrivData);
+			XPlmi_TaskUpdateStats(Task, TaskStartTime,
+				XPlmi_GetTimerValue());
 #ifdef PLM_DEBUG_DETAILED
 			XPlmi_MeasurePerfTime(TaskStartTime, &PerfTime);
 			XPlmi_Printf(DEBUG_PRINT_PERF, "%u.%03u ms: Task Time\n\r",
@@ -30,6 +30,7 @@
 *       bsv  08/15/2021 Replaced enums with macros
 * 1.05  bsv  03/05/2022 Fix exception while deleting two consecutive tasks of
 *                       same priority
+* 1.06  ant  10/18/2026 Added task run time and queueing latency statistics
 *
 * </pre>
 *
@@ -66,9 +67,21 @@ extern "C" {
 #define XPLM_TASK_PRIORITY_1		(1U)
 #define TaskPriority_t u8
 
+/* Number of words in a task statistics record */
+#define XPLMI_TASK_STATS_LEN		(10U)
+
 /**************************** Type Definitions *******************************/
 typedef struct XPlmi_TaskNode XPlmi_TaskNode;
 
+/* Task statistics, times are in PIT cycles */
+typedef struct {
+    u32 Count;		/**< Number of times the handler is called */
+    u32 MaxTime;	/**< Longest handler run time */
+    u64 TotalTime;	/**< Cumulative handler run time */
+    u32 MaxLatency;	/**< Longest time spent in the task queue */
+    u64 TotalLatency;	/**< Cumulative time spent in the task queue */
+} XPlmi_TaskStats;
+
 struct XPlmi_TaskNode {
     u8 Priority;
     u8 State;
@@ -77,6 +90,8 @@ struct XPlmi_TaskNode {
     struct metal_list TaskNode;
     int (*Handler)(void * PrivData);
     void * PrivData;
+    u64 QueuedTime;	/**< Timer value when the task is queued */
+    XPlmi_TaskStats Stats;	/**< Run time statistics of the task */
 };
 
 /***************** Macros (Inline Functions) Definitions *********************/
@@ -96,6 +111,8 @@ void XPlmi_TaskInit(void);
 void XPlmi_TaskDispatchLoop(void);
 XPlmi_TaskNode* XPlmi_GetTaskInstance(int (*Handler)(void *Arg),
 	const void *PrivData, const u32 IntrId);
+int XPlmi_GetTaskStats(u32 Index, u32 *Record);
+void XPlmi_ResetTaskStats(void);
 
 /************************** Variable Definitions *****************************/
 
@@ -40,6 +40,7 @@
 *       bsv  09/05/2021 Disable prints in slave boot modes in case of error
 * 1.06  bm   07/06/2022 Refactor versal and versal_net code
 *       bm   07/24/2022 Set PlmLiveStatus during boot time
+*       ant  10/18/2026 Spin for a few reads before sleeping in UtilPoll APIs
 *
 * </pre>
 *
@@ -65,6 +66,7 @@
 
 /***************** Macros (Inline Functions) Definitions *********************/
 #define XPLMI_MASK_PRINT_PERIOD		(1000000U)
+#define XPLMI_POLL_SPIN_COUNT		(32U) /**< Reads before the first sleep */
 
 /**
  * @}
@@ -115,6 +117,7 @@ int XPlmi_UtilPoll(u32 RegAddr, u32 Mask, u32 ExpectedValue, u32 TimeOutInUs)
 	u32 RegValue;
 	u32 TimeLapsed = 0U;
 	u32 TimeOut = TimeOutInUs;
+	u32 SpinCount = 0U;
 
 	/*
 	 * If timeout value is zero, max time out value is taken
@@ -126,6 +129,14 @@ int XPlmi_UtilPoll(u32 RegAddr, u32 Mask, u32 ExpectedValue, u32 TimeOutInUs)
 	 * Read the Register value
 	 */
 	RegValue = XPlmi_In32(RegAddr);
+	/*
+	 * Most polls complete within a few reads, spin before sleeping
+	 */
+	while (((RegValue & Mask) != ExpectedValue) &&
+		(SpinCount < XPLMI_POLL_SPIN_COUNT)) {
+		RegValue = XPlmi_In32(RegAddr);
+		SpinCount++;
+	}
 	/*
 	 * Loop while the MAsk is not set or we timeout
 	 */
@@ -171,6 +182,7 @@ int XPlmi_UtilPoll64(u64 RegAddr, u32 Mask, u32 ExpectedValue, u32 TimeOutInUs)
 	u32 ReadValue;
 	u32 TimeLapsed = 0U;
 	u32 TimeOut = TimeOutInUs;
+	u32 SpinCount = 0U;
 
 	/*
 	 * If timeout value is zero, max time out value is taken
@@ -182,6 +194,14 @@ int XPlmi_UtilPoll64(u64 RegAddr, u32 Mask, u32 ExpectedValue, u32 TimeOutInUs)
 	 * Read the Register value
 	 */
 	ReadValue = XPlmi_In64(RegAddr);
+	/*
+	 * Most polls complete within a few reads, spin before sleeping
+	 */
+	while (((ReadValue & Mask) != ExpectedValue) &&
+		(SpinCount < XPLMI_POLL_SPIN_COUNT)) {
+		ReadValue = XPlmi_In64(RegAddr);
+		SpinCount++;
+	}
 	/*
 	 * Loop while the Mask is not set or we timeout
 	 */
@@ -274,11 +294,20 @@ int XPlmi_UtilPollForMask64(u32 HighAddr, u32 LowAddr, u32 Mask, u32 TimeOutInUs
 	u64 Addr = (((u64)HighAddr << 32U) | LowAddr);
 	u32 ReadValue;
 	u32 TimeOut = TimeOutInUs;
+	u32 SpinCount = 0U;
 
 	/*
 	 * Read the Register value
 	 */
 	ReadValue = lwea(Addr);
+	/*
+	 * Most polls complete within a few reads, spin before sleeping
+	 */
+	while (((ReadValue & Mask) != Mask) &&
+		(SpinCount < XPLMI_POLL_SPIN_COUNT)) {
+		ReadValue = lwea(Addr);
+		SpinCount++;
+	}
 	 /*
 	 * Loop while the Mask is not set or we timeout
 	 */
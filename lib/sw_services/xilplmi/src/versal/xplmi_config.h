@@ -44,6 +44,7 @@
 *       ssc  03/05/2022 Moved default config definitions to xparameters.h
 *       ma   05/24/2022 Added PLM_ENABLE_PLM_TO_PLM_COMM macro for SSIT
 *                       PLM to PLM communication
+* 1.09  ant  10/18/2026 Added PLM_BOOT_TRACE_EXCLUDE macro
 *
 * </pre>
 *
@@ -194,6 +195,14 @@ extern "C" {
 //#define PLM_PRINT_PERF_KEYHOLE
 //#define PLM_PRINT_PERF_PL
 
+/**
+ * Boot trace events of partition loads, CDO processing, DMA waits, secure
+ * operations and PM node state changes are stored as fixed size records in
+ * the Trace Log buffer, see XPlmi_TraceEvent. Enable the below define to
+ * exclude them.
+ */
+//#define PLM_BOOT_TRACE_EXCLUDE
+
 #define XPLMI_MJTAG_WA_GASKET_TOGGLE_CNT 10U /**< Number of clock cyles required
 					to change tap state to RESET */
 #define XPLMI_MJTAG_WA_DELAY_USED_IN_GASKET_TOGGLE 1U /**< Delay in usec in
@@ -24,6 +24,7 @@
 * ----- ---- -------- -------------------------------------------------------
 * 1.00  bm   07/06/2022 Initial release
 *       dc   07/17/2022 Added PLM_OCP configuration
+*       ant  10/18/2026 Added PLM_BOOT_TRACE_EXCLUDE macro
 *
 * </pre>
 *
@@ -166,6 +167,14 @@ extern "C" {
 //#define PLM_PRINT_PERF_KEYHOLE
 //#define PLM_PRINT_PERF_PL
 
+/**
+ * Boot trace events of partition loads, CDO processing, DMA waits, secure
+ * operations and PM node state changes are stored as fixed size records in
+ * the Trace Log buffer, see XPlmi_TraceEvent. Enable the below define to
+ * exclude them.
+ */
+//#define PLM_BOOT_TRACE_EXCLUDE
+
 /************************** Function Prototypes ******************************/
 
 /************************** Variable Definitions *****************************/
@@ -0,0 +1,32 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xparameters.h
+*
+* Hardware description for xpm_reqm_bench. Only the instance counts needed
+* by the driver headers included through the PLMI headers are defined, no
+* driver is used by the benchmark.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -----------------------------------------------
+* 1.00  ant  10/18/26 Initial release
+* </pre>
+*
+******************************************************************************/
+
+#ifndef XPARAMETERS_H
+#define XPARAMETERS_H
+
+#define STDOUT_BASEADDRESS			0U
+#define XPAR_XCSUDMA_NUM_INSTANCES		1U
+#define XPAR_IOMODULE_INTC_MAX_INTR_SIZE	32U
+
+#endif /* XPARAMETERS_H */
@@ -0,0 +1,856 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xpm_reqm_bench.c
+*
+* Host benchmark of the requirement and permission lookups of the Versal PM
+* server. The unmodified xpm_device.c, xpm_requirement.c, xpm_subsystem.c
+* and xpm_node.c are linked against host replacements of the power, clock,
+* reset, notifier and PLMI interfaces below, so no register is accessed.
+*
+* Subsystems and peripheral devices are added through XPmSubsystem_Add(),
+* XPmDevice_Init() and XPmRequirement_Add(). A random trace of
+* XPmDevice_Request(), XPmDevice_Release() and XPmDevice_SetRequirement()
+* calls is then replayed, with one subsystem going offline and being added
+* again half way through, so that an offline instance shares its index
+* with the current one.
+*
+* After every call of the trace, XPmSubsystem_GetById(),
+* XPmDevice_CheckPermissions(), XPmDevice_GetPermissions() and
+* XPmDevice_GetSubsystemIdOfCore() are checked against the list walks they
+* replaced, which are kept below as the Old* functions. Once the trace is
+* done, every lookup is timed for every subsystem and device with both
+* implementations. A summary of lines of
+*
+*	reqm,<phase>,<metric>,<value>
+*
+* is printed and the exit status is non zero if a check failed.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -----------------------------------------------
+* 1.00  ant  10/18/26 Initial release
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <getopt.h>
+#include "xpm_common.h"
+#include "xpm_device.h"
+#include "xpm_device_idle.h"
+#include "xpm_power.h"
+#include "xpm_requirement.h"
+#include "xpm_subsystem.h"
+#include "xpm_notifier.h"
+#include "xpm_rpucore.h"
+#include "xpm_api.h"
+#include "xpm_pin.h"
+#include "xplmi.h"
+#include "xplmi_dma.h"
+#include "xplmi_scheduler.h"
+
+/************************** Constant Definitions *****************************/
+#define NUM_SUBSYSTEMS		(10U)
+#define NUM_DEVICES		(160U)
+#define FIRST_DEVICE_IDX	(1U)
+#define READD_SUBSYS_IDX	(5U)
+#define DEFAULT_OPS		(200000U)
+#define DEFAULT_ITERS		(200U)
+#define DEFAULT_SEED		(1U)
+#define FULL_CHECK_INTERVAL	(4096U)
+#define BYTE_POOL_SIZE		(1024U * 1024U)
+
+#define SUBSYS_ID(Idx)		NODEID((u32)XPM_NODECLASS_SUBSYSTEM, \
+				       (u32)XPM_NODESUBCL_SUBSYSTEM, \
+				       (u32)XPM_NODETYPE_SUBSYSTEM, (Idx))
+#define DEVICE_ID(Idx)		NODEID((u32)XPM_NODECLASS_DEVICE, \
+				       (u32)XPM_NODESUBCL_DEV_PERIPH, \
+				       (u32)XPM_NODETYPE_DEV_PERIPH, (Idx))
+
+/**************************** Type Definitions *******************************/
+/* Time of one lookup with the list walk and with the index */
+typedef struct {
+	const char *Name;
+	u64 Calls;
+	u64 OldNs;
+	u64 NewNs;
+} LookupTime;
+
+/************************** Function Prototypes ******************************/
+static u32 Rand(void);
+static u64 NowNs(void);
+static void Fail(const char *Msg, u32 SubsysIdx, u32 DevIdx);
+static XPm_Subsystem *OldGetById(u32 SubsystemId);
+static XPm_Subsystem *OldGetByIndex(u32 SubSysIdx);
+static const XPm_Requirement *OldFindReqm(const XPm_Device *Device,
+	const XPm_Subsystem *Subsystem);
+static XStatus OldCheckPermissions(const XPm_Subsystem *Subsystem,
+	u32 DeviceId);
+static u32 OldGetPermissions(const XPm_Device *Device);
+static u32 OldGetSubsystemIdOfCore(const XPm_Device *Device);
+static XStatus PowerHandleEvent(XPm_Node *Node, u32 Event);
+static void AddSubsystem(u32 SubsysIdx);
+static void AddRequirements(u32 SubsysIdx);
+static void Setup(void);
+static void CheckPair(u32 SubsysIdx, u32 DevIdx);
+static void CheckAll(void);
+static void DoOp(void);
+static void RunTrace(u32 Ops);
+static void PrintLookup(const LookupTime *Time);
+static void RunLookups(u32 Iters);
+
+/************************** Variable Definitions *****************************/
+static u64 BytePool[BYTE_POOL_SIZE / sizeof(u64)];
+static u32 BytePoolUsed;
+static XPm_Power Power;
+static XPm_Device Devices[NUM_DEVICES];
+/* Head of the subsystem list of xpm_subsystem.c, the latest added one */
+static XPm_Subsystem *SubsysHead;
+static u32 RandState = DEFAULT_SEED;
+static u64 Requests;
+static u64 Releases;
+static u64 SetReqs;
+static u64 Rejects;
+static u64 Checks;
+static u64 Errors;
+static volatile u32 Sink;
+
+/*
+ * Host replacements of the PM and PLMI interfaces used by the PM sources
+ * under test. Power, clock and reset nodes are not modelled: the devices
+ * have no clocks or resets and share one power node which only counts its
+ * users.
+ */
+void *XPm_AllocBytes(u32 SizeInBytes)
+{
+	void *Bytes = NULL;
+	u32 Size = (SizeInBytes + 7U) & ~7U;
+
+	if (Size <= (BYTE_POOL_SIZE - BytePoolUsed)) {
+		Bytes = (u8 *)BytePool + BytePoolUsed;
+		BytePoolUsed += Size;
+		(void)memset(Bytes, 0, Size);
+	}
+
+	return Bytes;
+}
+
+XStatus HandleDeviceAttr(struct XPm_Reqm *Reqm, u32 ReqCaps,
+			 u32 PrevState, u32 Enable)
+{
+	(void)Reqm;
+	(void)ReqCaps;
+	(void)PrevState;
+	(void)Enable;
+	return XST_SUCCESS;
+}
+
+void PlatDevRequest(const XPm_Device *Device, const XPm_Subsystem *Subsystem,
+		    const u32 QoS, XStatus *Status)
+{
+	(void)Device;
+	(void)Subsystem;
+	(void)QoS;
+	(void)Status;
+}
+
+struct XPm_Reqm *XPmDevice_GetAieReqm(XPm_Device *Device,
+				      XPm_Subsystem *Subsystem)
+{
+	(void)Device;
+	(void)Subsystem;
+	return NULL;
+}
+
+XStatus XPmDevice_PlatAddParent(const u32 Id, const u32 ParentId)
+{
+	(void)Id;
+	(void)ParentId;
+	return XST_FAILURE;
+}
+
+XStatus XPmDevice_ConfigureADMA(const u32 Id)
+{
+	(void)Id;
+	return XST_SUCCESS;
+}
+
+XStatus XPmDevice_SdResetWorkaround(const XPm_Device *Device)
+{
+	(void)Device;
+	return XST_SUCCESS;
+}
+
+XStatus XPmDevice_SoftResetIdle(const XPm_Device *Device, const u32 IdleReq)
+{
+	(void)Device;
+	(void)IdleReq;
+	return XST_SUCCESS;
+}
+
+XStatus XPmRpuCore_Halt(const XPm_Device *Device)
+{
+	(void)Device;
+	return XST_SUCCESS;
+}
+
+XStatus XPmCore_ForcePwrDwn(u32 DeviceId)
+{
+	(void)DeviceId;
+	return XST_FAILURE;
+}
+
+XPm_Power *XPmPower_GetById(u32 Id)
+{
+	(void)Id;
+	return &Power;
+}
+
+XStatus XPmPower_GetWakeupLatency(const u32 DeviceId, u32 *Latency)
+{
+	(void)DeviceId;
+	*Latency = 0U;
+	return XST_SUCCESS;
+}
+
+XPm_ClockNode *XPmClock_GetById(u32 ClockId)
+{
+	(void)ClockId;
+	return NULL;
+}
+
+XStatus XPmClock_GetClockData(const XPm_OutClockNode *Clk, u32 Nodetype,
+			      u32 *Value)
+{
+	(void)Clk;
+	(void)Nodetype;
+	*Value = 1U;
+	return XST_SUCCESS;
+}
+
+XStatus XPmClock_Request(const XPm_ClockHandle *ClkHandle)
+{
+	(void)ClkHandle;
+	return XST_SUCCESS;
+}
+
+XStatus XPmClock_Release(const XPm_ClockHandle *ClkHandle)
+{
+	(void)ClkHandle;
+	return XST_SUCCESS;
+}
+
+XStatus XPmClock_CheckPermissions(u32 SubsystemIdx, u32 ClockId)
+{
+	(void)SubsystemIdx;
+	(void)ClockId;
+	return XST_FAILURE;
+}
+
+XPm_ResetNode *XPmReset_GetById(u32 ResetId)
+{
+	(void)ResetId;
+	return NULL;
+}
+
+XStatus XPmReset_CheckPermissions(const XPm_Subsystem *Subsystem, u32 ResetId)
+{
+	(void)Subsystem;
+	(void)ResetId;
+	return XST_FAILURE;
+}
+
+XStatus XPm_PinCheckPermission(const XPm_Subsystem *Subsystem, u32 NodeId)
+{
+	(void)Subsystem;
+	(void)NodeId;
+	return XST_FAILURE;
+}
+
+void XPmNotifier_Event(const u32 NodeId, const u32 Event)
+{
+	(void)NodeId;
+	(void)Event;
+}
+
+XStatus XPmNotifier_UnregisterAll(const XPm_Subsystem* const Subsystem)
+{
+	(void)Subsystem;
+	return XST_SUCCESS;
+}
+
+XStatus XPmSubsystem_IsOperationAllowed(const u32 HostId, const u32 TargetId,
+					const u32 Operation, const u32 CmdType)
+{
+	(void)HostId;
+	(void)TargetId;
+	(void)Operation;
+	(void)CmdType;
+	return XST_FAILURE;
+}
+
+XStatus XPmSubsystem_NotifyHealthyBoot(const u32 SubsystemId)
+{
+	(void)SubsystemId;
+	return XST_SUCCESS;
+}
+
+XStatus XPm_RequestDevice(const u32 SubsystemId, const u32 DeviceId,
+			  const u32 Capabilities, const u32 QoS, const u32 Ack,
+			  const u32 CmdType)
+{
+	(void)Ack;
+	return XPmDevice_Request(SubsystemId, DeviceId, Capabilities, QoS,
+				 CmdType);
+}
+
+int XPm_ForcePwrDwnCb(void *Data)
+{
+	(void)Data;
+	return XST_SUCCESS;
+}
+
+void XPm_ProcessAckReq(const u32 Ack, const u32 IpiMask, const int Status,
+		       const u32 NodeId, const u32 NodeState)
+{
+	(void)Ack;
+	(void)IpiMask;
+	(void)Status;
+	(void)NodeId;
+	(void)NodeState;
+}
+
+u32 XPm_GetPlatform(void)
+{
+	return PLATFORM_VERSION_SILICON;
+}
+
+u32 XPm_GetPlatformVersion(void)
+{
+	return PLATFORM_VERSION_SILICON_ES2;
+}
+
+int XPlmi_EccInit(u64 Addr, u32 Len)
+{
+	(void)Addr;
+	(void)Len;
+	return XST_SUCCESS;
+}
+
+int XPlmi_SchedulerRemoveTask(u32 OwnerId, XPlmi_Callback_t CallbackFn,
+	u32 MilliSeconds, const void *Data)
+{
+	(void)OwnerId;
+	(void)CallbackFn;
+	(void)MilliSeconds;
+	(void)Data;
+	return XST_FAILURE;
+}
+
+static u32 Rand(void)
+{
+	/* xorshift32 */
+	RandState ^= RandState << 13;
+	RandState ^= RandState >> 17;
+	RandState ^= RandState << 5;
+	return RandState;
+}
+
+static u64 NowNs(void)
+{
+	struct timespec Ts;
+
+	(void)clock_gettime(CLOCK_MONOTONIC, &Ts);
+	return ((u64)Ts.tv_sec * 1000000000ULL) + (u64)Ts.tv_nsec;
+}
+
+static void Fail(const char *Msg, u32 SubsysIdx, u32 DevIdx)
+{
+	fprintf(stderr, "subsystem %u device %u: %s\n", SubsysIdx, DevIdx, Msg);
+	Errors++;
+}
+
+/*
+ * Lookups as done before the requirement index, by walking the subsystem
+ * list and the requirement list of the device
+ */
+static XPm_Subsystem *OldGetById(u32 SubsystemId)
+{
+	XPm_Subsystem *SubSystem = NULL;
+
+	if ((INVALID_SUBSYSID == SubsystemId) ||
+	    (MAX_NUM_SUBSYSTEMS <= NODEINDEX(SubsystemId))) {
+		goto done;
+	}
+
+	SubSystem = SubsysHead;
+	while (NULL != SubSystem) {
+		if (SubSystem->Id == SubsystemId) {
+			break;
+		}
+		SubSystem = SubSystem->NextSubsystem;
+	}
+
+done:
+	return SubSystem;
+}
+
+static XPm_Subsystem *OldGetByIndex(u32 SubSysIdx)
+{
+	XPm_Subsystem *Subsystem = SubsysHead;
+
+	while (NULL != Subsystem) {
+		if (SubSysIdx == NODEINDEX(Subsystem->Id)) {
+			break;
+		}
+		Subsystem = Subsystem->NextSubsystem;
+	}
+
+	return Subsystem;
+}
+
+static const XPm_Requirement *OldFindReqm(const XPm_Device *Device,
+	const XPm_Subsystem *Subsystem)
+{
+	const XPm_Requirement *Reqm = Device->Requirements;
+
+	while (NULL != Reqm) {
+		if (Reqm->Subsystem == Subsystem) {
+			break;
+		}
+		Reqm = Reqm->NextSubsystem;
+	}
+
+	return Reqm;
+}
+
+static XStatus OldCheckPermissions(const XPm_Subsystem *Subsystem,
+	u32 DeviceId)
+{
+	XStatus Status = XPM_PM_NO_ACCESS;
+	const XPm_Requirement *Reqm;
+	const XPm_Device *Device = XPmDevice_GetById(DeviceId);
+
+	if (NULL == Device) {
+		Status = XST_INVALID_PARAM;
+		goto done;
+	}
+
+	Reqm = OldFindReqm(Device, Subsystem);
+	if ((NULL != Reqm) && (1U == Reqm->Allocated)) {
+		Status = XST_SUCCESS;
+	}
+
+done:
+	return Status;
+}
+
+static u32 OldGetPermissions(const XPm_Device *Device)
+{
+	const XPm_Requirement *Reqm = Device->Requirements;
+	u32 SubsysIdx = XPmSubsystem_GetMaxSubsysIdx();
+	u32 PermissionMask = 0U;
+	u32 Idx;
+
+	while (NULL != Reqm) {
+		if (1U == Reqm->Allocated) {
+			for (Idx = 0U; Idx <= SubsysIdx; Idx++) {
+				if (Reqm->Subsystem == OldGetByIndex(Idx)) {
+					PermissionMask |= ((u32)1U << Idx);
+				}
+			}
+		}
+		Reqm = Reqm->NextSubsystem;
+	}
+
+	return PermissionMask;
+}
+
+static u32 OldGetSubsystemIdOfCore(const XPm_Device *Device)
+{
+	const XPm_Requirement *Reqm;
+	const XPm_Subsystem *Subsystem = NULL;
+	u32 SubsysIdx = XPmSubsystem_GetMaxSubsysIdx();
+	u32 Idx;
+
+	for (Idx = 0U; Idx <= SubsysIdx; Idx++) {
+		Subsystem = OldGetByIndex(Idx);
+		if (NULL != Subsystem) {
+			Reqm = OldFindReqm(Device, Subsystem);
+			if ((NULL != Reqm) && (1U == Reqm->Allocated)) {
+				break;
+			}
+		}
+	}
+
+	return (SubsysIdx < Idx) ? INVALID_SUBSYSID : Subsystem->Id;
+}
+
+/* Shared power node of the devices, counts its users */
+static XStatus PowerHandleEvent(XPm_Node *Node, u32 Event)
+{
+	XPm_Power *Pwr = (XPm_Power *)Node;
+
+	if ((u32)XPM_POWER_EVENT_PWR_UP == Event) {
+		Pwr->UseCount++;
+		Node->State = (u8)XPM_POWER_STATE_ON;
+	} else if ((u32)XPM_POWER_EVENT_PWR_DOWN == Event) {
+		Pwr->UseCount--;
+	} else {
+		/* Latency updates need no action */
+	}
+
+	return XST_SUCCESS;
+}
+
+static void AddSubsystem(u32 SubsysIdx)
+{
+	u32 Id = SUBSYS_ID(SubsysIdx);
+
+	if (XST_SUCCESS != XPmSubsystem_Add(Id)) {
+		Fail("XPmSubsystem_Add failed", SubsysIdx, 0U);
+		exit(1);
+	}
+	SubsysHead = XPmSubsystem_GetById(Id);
+}
+
+/*
+ * Gives the subsystem a requirement on about half of the devices, some of
+ * them non shared. The default subsystem has a requirement on every device.
+ */
+static void AddRequirements(u32 SubsysIdx)
+{
+	XPm_Subsystem *Subsystem = XPmSubsystem_GetById(SUBSYS_ID(SubsysIdx));
+	u32 DevIdx;
+	u32 Usage;
+	u32 Flags;
+
+	for (DevIdx = 0U; DevIdx < NUM_DEVICES; DevIdx++) {
+		if (((u32)XPM_NODEIDX_SUBSYS_DEFAULT != SubsysIdx) &&
+		    (0U != (Rand() & 1U))) {
+			continue;
+		}
+		Usage = (0U == (Rand() % 8U)) ? (u32)REQ_NONSHARED :
+			(u32)REQ_SHARED;
+		Flags = REQUIREMENT_FLAGS(0U,
+			(u32)REQ_ACCESS_SECURE_NONSECURE, Usage);
+		if (XST_SUCCESS != XPmRequirement_Add(Subsystem,
+				&Devices[DevIdx], Flags, 0U, XPM_DEF_QOS)) {
+			Fail("XPmRequirement_Add failed", SubsysIdx, DevIdx);
+			exit(1);
+		}
+	}
+}
+
+static void Setup(void)
+{
+	u32 Idx;
+
+	Power.Node.Id = PM_POWER_LPD;
+	Power.Node.State = (u8)XPM_POWER_STATE_OFF;
+	Power.HandleEvent = PowerHandleEvent;
+
+	/* PMC subsystem first, every device gets a requirement for it */
+	AddSubsystem((u32)XPM_NODEIDX_SUBSYS_PMC);
+	for (Idx = 0U; Idx < NUM_SUBSYSTEMS; Idx++) {
+		if ((u32)XPM_NODEIDX_SUBSYS_PMC != Idx) {
+			AddSubsystem(Idx);
+		}
+	}
+
+	for (Idx = 0U; Idx < NUM_DEVICES; Idx++) {
+		if (XST_SUCCESS != XPmDevice_Init(&Devices[Idx],
+				DEVICE_ID(FIRST_DEVICE_IDX + Idx), 0U, &Power,
+				NULL, NULL)) {
+			Fail("XPmDevice_Init failed", 0U, Idx);
+			exit(1);
+		}
+	}
+
+	for (Idx = 0U; Idx < NUM_SUBSYSTEMS; Idx++) {
+		if ((u32)XPM_NODEIDX_SUBSYS_PMC != Idx) {
+			AddRequirements(Idx);
+		}
+	}
+}
+
+/* Compares every lookup of the index with its list walk */
+static void CheckPair(u32 SubsysIdx, u32 DevIdx)
+{
+	u32 SubsysId = SUBSYS_ID(SubsysIdx);
+	const XPm_Device *Device = &Devices[DevIdx];
+	const XPm_Subsystem *Subsystem = XPmSubsystem_GetById(SubsysId);
+	u32 Mask = 0U;
+
+	Checks++;
+	if (Subsystem != OldGetById(SubsysId)) {
+		Fail("XPmSubsystem_GetById differs", SubsysIdx, DevIdx);
+	}
+	if (XPmSubsystem_GetByIndex(SubsysIdx) != OldGetByIndex(SubsysIdx)) {
+		Fail("XPmSubsystem_GetByIndex differs", SubsysIdx, DevIdx);
+	}
+	if (XPmDevice_CheckPermissions(Subsystem, Device->Node.Id) !=
+	    OldCheckPermissions(Subsystem, Device->Node.Id)) {
+		Fail("XPmDevice_CheckPermissions differs", SubsysIdx, DevIdx);
+	}
+	if ((XST_SUCCESS != XPmDevice_GetPermissions(Device, &Mask)) ||
+	    (Mask != OldGetPermissions(Device))) {
+		Fail("XPmDevice_GetPermissions differs", SubsysIdx, DevIdx);
+	}
+	if (XPmDevice_GetSubsystemIdOfCore(Device) !=
+	    OldGetSubsystemIdOfCore(Device)) {
+		Fail("XPmDevice_GetSubsystemIdOfCore differs", SubsysIdx,
+		     DevIdx);
+	}
+}
+
+static void CheckAll(void)
+{
+	u32 SubsysIdx;
+	u32 DevIdx;
+
+	for (SubsysIdx = 0U; SubsysIdx < NUM_SUBSYSTEMS; SubsysIdx++) {
+		for (DevIdx = 0U; DevIdx < NUM_DEVICES; DevIdx++) {
+			CheckPair(SubsysIdx, DevIdx);
+		}
+	}
+}
+
+/* One request, release or set requirement of a random subsystem */
+static void DoOp(void)
+{
+	u32 SubsysIdx = Rand() % NUM_SUBSYSTEMS;
+	u32 DevIdx = Rand() % NUM_DEVICES;
+	u32 SubsysId = SUBSYS_ID(SubsysIdx);
+	u32 DeviceId = DEVICE_ID(FIRST_DEVICE_IDX + DevIdx);
+	u32 Op = Rand() % 8U;
+	XStatus Status;
+
+	if (Op < 4U) {
+		Requests++;
+		Status = XPmDevice_Request(SubsysId, DeviceId, PM_CAP_ACCESS,
+					   XPM_DEF_QOS, XPLMI_CMD_SECURE);
+	} else if (Op < 7U) {
+		Releases++;
+		Status = XPmDevice_Release(SubsysId, DeviceId,
+					   XPLMI_CMD_SECURE);
+	} else {
+		SetReqs++;
+		Status = XPmDevice_SetRequirement(SubsysId, DeviceId,
+			(0U != (Rand() & 1U)) ? (u32)PM_CAP_ACCESS :
+			(u32)PM_CAP_CONTEXT, XPM_DEF_QOS);
+	}
+	if (XST_SUCCESS != Status) {
+		Rejects++;
+	}
+
+	CheckPair(SubsysIdx, DevIdx);
+}
+
+static void RunTrace(u32 Ops)
+{
+	u64 Start = NowNs();
+	const XPm_Requirement *Reqm;
+	u32 Allocated = 0U;
+	u32 Idx;
+
+	for (Idx = 0U; Idx < Ops; Idx++) {
+		if (Idx == (Ops / 2U)) {
+			/*
+			 * Subsystem goes offline with its devices still
+			 * allocated and is added again with new requirements
+			 */
+			(void)XPmSubsystem_SetState(SUBSYS_ID(READD_SUBSYS_IDX),
+						    (u32)OFFLINE);
+			AddSubsystem(READD_SUBSYS_IDX);
+			AddRequirements(READD_SUBSYS_IDX);
+			CheckAll();
+		}
+		DoOp();
+		if (0U == (Idx % FULL_CHECK_INTERVAL)) {
+			CheckAll();
+		}
+	}
+	CheckAll();
+
+	for (Idx = 0U; Idx < NUM_DEVICES; Idx++) {
+		Reqm = Devices[Idx].Requirements;
+		while (NULL != Reqm) {
+			Allocated += Reqm->Allocated;
+			Reqm = Reqm->NextSubsystem;
+		}
+	}
+
+	printf("reqm,trace,ops,%u\n", Ops);
+	printf("reqm,trace,requests,%llu\n", (unsigned long long)Requests);
+	printf("reqm,trace,releases,%llu\n", (unsigned long long)Releases);
+	printf("reqm,trace,set_requirements,%llu\n",
+	       (unsigned long long)SetReqs);
+	printf("reqm,trace,rejects,%llu\n", (unsigned long long)Rejects);
+	printf("reqm,trace,checks,%llu\n", (unsigned long long)Checks);
+	printf("reqm,trace,allocated,%u\n", Allocated);
+	printf("reqm,trace,byte_pool_used,%u\n", BytePoolUsed);
+	printf("reqm,trace,ms,%llu\n",
+	       (unsigned long long)((NowNs() - Start) / 1000000ULL));
+	printf("reqm,trace,errors,%llu\n", (unsigned long long)Errors);
+}
+
+static void PrintLookup(const LookupTime *Time)
+{
+	printf("reqm,%s,calls,%llu\n", Time->Name,
+	       (unsigned long long)Time->Calls);
+	printf("reqm,%s,old_ns_per_call,%.2f\n", Time->Name,
+	       (double)Time->OldNs / (double)Time->Calls);
+	printf("reqm,%s,new_ns_per_call,%.2f\n", Time->Name,
+	       (double)Time->NewNs / (double)Time->Calls);
+	printf("reqm,%s,speedup,%.2f\n", Time->Name,
+	       (double)Time->OldNs / (double)Time->NewNs);
+}
+
+/* Times each lookup over every subsystem and device, list walk first */
+static void RunLookups(u32 Iters)
+{
+	LookupTime GetById = { "get_by_id", 0U, 0U, 0U };
+	LookupTime Check = { "check_permissions", 0U, 0U, 0U };
+	LookupTime GetPerms = { "get_permissions", 0U, 0U, 0U };
+	LookupTime CoreId = { "subsystem_id_of_core", 0U, 0U, 0U };
+	XPm_Subsystem *Subsystems[NUM_SUBSYSTEMS];
+	u32 Iter, SubsysIdx, DevIdx;
+	u32 Acc = 0U;
+	u32 Mask;
+	u64 Start;
+
+	for (SubsysIdx = 0U; SubsysIdx < NUM_SUBSYSTEMS; SubsysIdx++) {
+		Subsystems[SubsysIdx] =
+			XPmSubsystem_GetById(SUBSYS_ID(SubsysIdx));
+	}
+
+	Start = NowNs();
+	for (Iter = 0U; Iter < Iters; Iter++) {
+		for (SubsysIdx = 0U; SubsysIdx < NUM_SUBSYSTEMS; SubsysIdx++) {
+			Acc += (u32)(UINTPTR)OldGetById(SUBSYS_ID(SubsysIdx));
+		}
+	}
+	GetById.OldNs = NowNs() - Start;
+	Start = NowNs();
+	for (Iter = 0U; Iter < Iters; Iter++) {
+		for (SubsysIdx = 0U; SubsysIdx < NUM_SUBSYSTEMS; SubsysIdx++) {
+			Acc += (u32)(UINTPTR)XPmSubsystem_GetById(
+				SUBSYS_ID(SubsysIdx));
+		}
+	}
+	GetById.NewNs = NowNs() - Start;
+	GetById.Calls = (u64)Iters * NUM_SUBSYSTEMS;
+
+	Start = NowNs();
+	for (Iter = 0U; Iter < Iters; Iter++) {
+		for (SubsysIdx = 0U; SubsysIdx < NUM_SUBSYSTEMS; SubsysIdx++) {
+			for (DevIdx = 0U; DevIdx < NUM_DEVICES; DevIdx++) {
+				Acc += (u32)OldCheckPermissions(
+					Subsystems[SubsysIdx],
+					Devices[DevIdx].Node.Id);
+			}
+		}
+	}
+	Check.OldNs = NowNs() - Start;
+	Start = NowNs();
+	for (Iter = 0U; Iter < Iters; Iter++) {
+		for (SubsysIdx = 0U; SubsysIdx < NUM_SUBSYSTEMS; SubsysIdx++) {
+			for (DevIdx = 0U; DevIdx < NUM_DEVICES; DevIdx++) {
+				Acc += (u32)XPmDevice_CheckPermissions(
+					Subsystems[SubsysIdx],
+					Devices[DevIdx].Node.Id);
+			}
+		}
+	}
+	Check.NewNs = NowNs() - Start;
+	Check.Calls = (u64)Iters * NUM_SUBSYSTEMS * NUM_DEVICES;
+
+	Start = NowNs();
+	for (Iter = 0U; Iter < Iters; Iter++) {
+		for (DevIdx = 0U; DevIdx < NUM_DEVICES; DevIdx++) {
+			Acc += OldGetPermissions(&Devices[DevIdx]);
+		}
+	}
+	GetPerms.OldNs = NowNs() - Start;
+	Start = NowNs();
+	for (Iter = 0U; Iter < Iters; Iter++) {
+		for (DevIdx = 0U; DevIdx < NUM_DEVICES; DevIdx++) {
+			Mask = 0U;
+			(void)XPmDevice_GetPermissions(&Devices[DevIdx], &Mask);
+			Acc += Mask;
+		}
+	}
+	GetPerms.NewNs = NowNs() - Start;
+	GetPerms.Calls = (u64)Iters * NUM_DEVICES;
+
+	Start = NowNs();
+	for (Iter = 0U; Iter < Iters; Iter++) {
+		for (DevIdx = 0U; DevIdx < NUM_DEVICES; DevIdx++) {
+			Acc += OldGetSubsystemIdOfCore(&Devices[DevIdx]);
+		}
+	}
+	CoreId.OldNs = NowNs() - Start;
+	Start = NowNs();
+	for (Iter = 0U; Iter < Iters; Iter++) {
+		for (DevIdx = 0U; DevIdx < NUM_DEVICES; DevIdx++) {
+			Acc += XPmDevice_GetSubsystemIdOfCore(&Devices[DevIdx]);
+		}
+	}
+	CoreId.NewNs = NowNs() - Start;
+	CoreId.Calls = (u64)Iters * NUM_DEVICES;
+
+	Sink = Acc;
+	PrintLookup(&GetById);
+	PrintLookup(&Check);
+	PrintLookup(&GetPerms);
+	PrintLookup(&CoreId);
+}
+
+int main(int argc, char **argv)
+{
+	u32 Ops = DEFAULT_OPS;
+	u32 Iters = DEFAULT_ITERS;
+	int Opt;
+
+	while ((Opt = getopt(argc, argv, "n:i:s:")) != -1) {
+		switch (Opt) {
+		case 'n':
+			Ops = (u32)strtoul(optarg, NULL, 0);
+			break;
+		case 'i':
+			Iters = (u32)strtoul(optarg, NULL, 0);
+			break;
+		case 's':
+			RandState = (u32)strtoul(optarg, NULL, 0);
+			break;
+		default:
+			fprintf(stderr, "usage: %s [-n ops] [-i iters] "
+				"[-s seed]\n", argv[0]);
+			return 2;
+		}
+	}
+	if ((Ops == 0U) || (Iters == 0U) || (RandState == 0U)) {
+		fprintf(stderr, "usage: %s [-n ops] [-i iters] [-s seed]\n",
+			argv[0]);
+		return 2;
+	}
+
+	Setup();
+	RunTrace(Ops);
+	RunLookups(Iters);
+
+	return (Errors == 0U) ? 0 : 1;
+}
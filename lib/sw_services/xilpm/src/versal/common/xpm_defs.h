@@ -674,9 +674,27 @@ typedef enum {
 	PM_SET_NODE_ACCESS,				/**< 0x42 */
 	PM_NOC_CLOCK_ENABLE = 0x45,			/**< 0x45 */
 	PM_IF_NOC_CLOCK_ENABLE,				/**< 0x46 */
-	PM_API_MAX					/**< 0x47 */
+	PM_BATCH,					/**< 0x47 */
+	PM_API_MAX					/**< 0x48 */
 } XPm_ApiId;
 
+/**
+ * @name PM_BATCH command list
+ * @{
+ */
+/**
+ * PM_BATCH passes the address of a word aligned list of PM commands in a
+ * memory device requested by the caller. Each entry is XPM_BATCH_ENTRY_WORDS
+ * words: IPI header and up to XPM_BATCH_MAX_ARGS arguments, followed by
+ * status and first return value which are written back by the server.
+ */
+#define XPM_BATCH_ENTRY_WORDS		(8U)
+#define XPM_BATCH_MAX_ARGS		(5U)
+#define XPM_BATCH_STATUS_OFFSET		(6U)
+#define XPM_BATCH_VALUE_OFFSET		(7U)
+#define XPM_BATCH_MAX_CMDS		(32U)
+/** @} */
+
 /**
  * @name Run time AIE Operations
  * @{
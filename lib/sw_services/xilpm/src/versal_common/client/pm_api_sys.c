@@ -13,6 +13,7 @@
 #include "pm_api_sys.h"
 #include "pm_callbacks.h"
 #include "pm_client.h"
+#include "xil_cache.h"
 
 /** @cond INTERNAL */
 
@@ -2230,3 +2231,180 @@ XStatus XPm_FeatureCheck(const u32 FeatureId, u32 *Version)
 done:
 	return Status;
 }
+
+/****************************************************************************/
+/**
+ * @brief  This function initializes a list of PM commands to be sent with
+ * XPm_BatchSend()
+ *
+ * @param  Batch	Pointer to batch instance
+ * @param  Buffer	Command list storage of MaxCmds * XPM_BATCH_ENTRY_WORDS
+ *			words. It must be word aligned, lie in a memory
+ *			device (OCM, TCM, DDR...) requested by this subsystem
+ *			and must not be modified until XPm_BatchSend() returns
+ * @param  MaxCmds	Number of commands the buffer can hold
+ *
+ * @return XST_SUCCESS if successful else XST_INVALID_PARAM
+ *
+ ****************************************************************************/
+XStatus XPm_BatchStart(XPm_Batch *const Batch, u32 *const Buffer,
+		       const u32 MaxCmds)
+{
+	XStatus Status = (s32)XST_INVALID_PARAM;
+
+	if ((NULL == Batch) || (NULL == Buffer)) {
+		XPm_Err("Passing NULL pointer to %s\r\n", __func__);
+		goto done;
+	}
+
+	if ((0U == MaxCmds) || (XPM_BATCH_MAX_CMDS < MaxCmds)) {
+		XPm_Err("Invalid number of commands %d\r\n", MaxCmds);
+		goto done;
+	}
+
+	Batch->Buffer = Buffer;
+	Batch->MaxCmds = MaxCmds;
+	Batch->NumCmds = 0U;
+	Status = XST_SUCCESS;
+
+done:
+	return Status;
+}
+
+/****************************************************************************/
+/**
+ * @brief  This function appends a PM command to the list
+ *
+ * @param  Batch	Pointer to batch instance
+ * @param  ApiId	PM API ID of the command
+ * @param  NumArgs	Number of arguments, maximum XPM_BATCH_MAX_ARGS
+ * @param  Args		Command arguments, can be NULL if NumArgs is 0
+ *
+ * @return XST_SUCCESS if successful else XST_INVALID_PARAM
+ *
+ * @note   Only commands which do not block and return at most one value
+ *	   are accepted by PLM: request/release/set requirement and latency
+ *	   of devices, reset assert and status, clock enable/disable/state,
+ *	   divider and parent settings and PLL parameter and mode settings.
+ *
+ ****************************************************************************/
+XStatus XPm_BatchAdd(XPm_Batch *const Batch, const u32 ApiId,
+		     const u32 NumArgs, const u32 *const Args)
+{
+	XStatus Status = (s32)XST_INVALID_PARAM;
+	u32 *Entry;
+	u32 Idx;
+
+	if ((NULL == Batch) || (NULL == Batch->Buffer) ||
+	    ((0U != NumArgs) && (NULL == Args))) {
+		XPm_Err("Passing NULL pointer to %s\r\n", __func__);
+		goto done;
+	}
+
+	if ((XPM_BATCH_MAX_ARGS < NumArgs) ||
+	    (Batch->NumCmds >= Batch->MaxCmds)) {
+		XPm_Err("Can not add API %d to the batch\r\n", ApiId);
+		goto done;
+	}
+
+	Entry = &Batch->Buffer[Batch->NumCmds * XPM_BATCH_ENTRY_WORDS];
+	Entry[0] = HEADER(NumArgs, ApiId);
+	for (Idx = 0U; Idx < XPM_BATCH_MAX_ARGS; Idx++) {
+		Entry[Idx + 1U] = (Idx < NumArgs) ? Args[Idx] : 0U;
+	}
+	Entry[XPM_BATCH_STATUS_OFFSET] = (u32)XST_FAILURE;
+	Entry[XPM_BATCH_VALUE_OFFSET] = 0U;
+	Batch->NumCmds++;
+	Status = XST_SUCCESS;
+
+done:
+	return Status;
+}
+
+/****************************************************************************/
+/**
+ * @brief  This function sends the list of PM commands to PLM with a single
+ * IPI request
+ *
+ * @param  Batch	Pointer to batch instance
+ * @param  NumDone	Returns number of commands executed successfully
+ *			(optional)
+ *
+ * @return XST_SUCCESS if all commands are successful else XST_FAILURE or
+ * status of the first failed command
+ *
+ * @note   PLM executes the commands in order without handling any other
+ *	   request in between and stops at the first failure. Commands already
+ *	   executed are not reverted. Use XPm_BatchGetStatus() to read the
+ *	   status of each command. The list is emptied once sent.
+ *
+ ****************************************************************************/
+XStatus XPm_BatchSend(XPm_Batch *const Batch, u32 *const NumDone)
+{
+	XStatus Status = (s32)XST_FAILURE;
+	u32 Payload[PAYLOAD_ARG_CNT];
+	UINTPTR Address;
+	u32 Size;
+
+	if ((NULL == Batch) || (NULL == Batch->Buffer) ||
+	    (0U == Batch->NumCmds)) {
+		XPm_Err("Empty batch passed to %s\r\n", __func__);
+		goto done;
+	}
+
+	Address = (UINTPTR)Batch->Buffer;
+	Size = Batch->NumCmds * XPM_BATCH_ENTRY_WORDS * 4U;
+	Xil_DCacheFlushRange(Address, Size);
+
+	PACK_PAYLOAD3(Payload, PM_BATCH, (u32)Address,
+		      (u32)((u64)Address >> 32U), Batch->NumCmds);
+
+	/* Send request to the target module */
+	Status = XPm_IpiSend(PrimaryProc, Payload);
+	if (XST_SUCCESS != Status) {
+		goto done;
+	}
+
+	/* Return result from IPI return buffer */
+	Status = Xpm_IpiReadBuff32(PrimaryProc, NumDone, NULL, NULL);
+
+	/* Per command status is written back by PLM */
+	Xil_DCacheInvalidateRange(Address, Size);
+	Batch->NumCmds = 0U;
+
+done:
+	return Status;
+}
+
+/****************************************************************************/
+/**
+ * @brief  This function returns status of a command of a sent list
+ *
+ * @param  Batch	Pointer to batch instance
+ * @param  Index	Index of the command in the list
+ * @param  Value	Returns first value returned by the command (optional)
+ *
+ * @return Status of the command, XST_FAILURE if it was not executed
+ *
+ ****************************************************************************/
+XStatus XPm_BatchGetStatus(const XPm_Batch *const Batch, const u32 Index,
+			   u32 *const Value)
+{
+	XStatus Status = (s32)XST_FAILURE;
+	const u32 *Entry;
+
+	if ((NULL == Batch) || (NULL == Batch->Buffer) ||
+	    (Index >= Batch->MaxCmds)) {
+		XPm_Err("Invalid argument passed to %s\r\n", __func__);
+		goto done;
+	}
+
+	Entry = &Batch->Buffer[Index * XPM_BATCH_ENTRY_WORDS];
+	if (NULL != Value) {
+		*Value = Entry[XPM_BATCH_VALUE_OFFSET];
+	}
+	Status = (s32)Entry[XPM_BATCH_STATUS_OFFSET];
+
+done:
+	return Status;
+}
@@ -86,6 +86,16 @@ typedef struct XPm_Ntfier {
 	struct XPm_Ntfier* next;
 } XPm_Notifier;
 
+/**
+ * XPm_Batch - list of PM commands sent to PLM with a single PM_BATCH request
+ */
+typedef struct XPm_Batch {
+	u32 *Buffer;	/**< Command list, XPM_BATCH_ENTRY_WORDS words per command.
+			  Must be accessible by PMC */
+	u32 MaxCmds;	/**< Number of commands the buffer can hold */
+	u32 NumCmds;	/**< Number of commands added to the list */
+} XPm_Batch;
+
 /* Global data declarations */
 extern struct pm_init_suspend pm_susp;
 extern struct pm_acknowledge pm_ack;
@@ -158,6 +168,13 @@ void XPm_AcknowledgeCb(const u32 Node, const XStatus Status, const u32 Oppoint);
 XStatus XPm_ClockSetRate(const u32 ClockId, const u32 Rate);
 XStatus XPm_ClockGetRate(const u32 ClockId, u32 *const Rate);
 XStatus XPm_FeatureCheck(const u32 FeatureId, u32 *Version);
+XStatus XPm_BatchStart(XPm_Batch *const Batch, u32 *const Buffer,
+		       const u32 MaxCmds);
+XStatus XPm_BatchAdd(XPm_Batch *const Batch, const u32 ApiId,
+		     const u32 NumArgs, const u32 *const Args);
+XStatus XPm_BatchSend(XPm_Batch *const Batch, u32 *const NumDone);
+XStatus XPm_BatchGetStatus(const XPm_Batch *const Batch, const u32 Index,
+			   u32 *const Value);
 
 /** @cond INTERNAL */
 XStatus XPm_SetConfiguration(const u32 Address);
@@ -297,6 +297,11 @@ done:
 	return Status;
 }
 
+static int XPm_ProcessBatch(const XPlmi_Cmd *Cmd, u32 AddrLow, u32 AddrHigh,
+			    u32 NumCmds, u32 *ApiResponse);
+static XStatus XPm_IsMemRangeOwned(u32 SubsystemId, u64 StartAddr,
+				   u64 EndAddr);
+
 static int XPm_ProcessCmd(XPlmi_Cmd * Cmd)
 {
 	int Status = XST_FAILURE;
@@ -480,6 +485,10 @@ static int XPm_ProcessCmd(XPlmi_Cmd * Cmd)
 				      Pload[2], Pload[3], Pload[4],
 				      ApiResponse, Cmd->IpiReqType);
 		break;
+	case PM_API(PM_BATCH):
+		Status = XPm_ProcessBatch(Cmd, Pload[0], Pload[1], Pload[2],
+					  ApiResponse);
+		break;
 	default:
 		Status = XPm_PlatProcessCmd(Cmd, ApiResponse);
 		break;
@@ -513,6 +522,210 @@ done:
 	return Status;
 }
 
+/****************************************************************************/
+/**
+ * @brief  This function checks if a command can be part of a PM_BATCH list
+ *
+ * @param  Header	IPI header of the command
+ *
+ * @return XST_SUCCESS if command can be batched else XST_INVALID_PARAM
+ *
+ * @note   Only commands which complete in the handler and return at most
+ *	   one value are allowed
+ *
+ ****************************************************************************/
+static int XPm_IsBatchCmd(u32 Header)
+{
+	int Status = XST_INVALID_PARAM;
+
+	if (XPLMI_MODULE_XILPM_ID != ((Header >> 8U) & 0xFFU)) {
+		goto done;
+	}
+
+	switch (Header & 0xFFU) {
+	case PM_API(PM_REQUEST_NODE):
+	case PM_API(PM_RELEASE_NODE):
+	case PM_API(PM_SET_REQUIREMENT):
+	case PM_API(PM_SET_MAX_LATENCY):
+	case PM_API(PM_RESET_ASSERT):
+	case PM_API(PM_RESET_GET_STATUS):
+	case PM_API(PM_CLOCK_ENABLE):
+	case PM_API(PM_CLOCK_DISABLE):
+	case PM_API(PM_CLOCK_GETSTATE):
+	case PM_API(PM_CLOCK_SETDIVIDER):
+	case PM_API(PM_CLOCK_SETPARENT):
+	case PM_API(PM_PLL_SET_PARAMETER):
+	case PM_API(PM_PLL_SET_MODE):
+		Status = XST_SUCCESS;
+		break;
+	default:
+		Status = XST_INVALID_PARAM;
+		break;
+	}
+
+done:
+	return Status;
+}
+
+/****************************************************************************/
+/**
+ * @brief  This function executes a list of PM commands in a single request
+ *
+ * @param  Cmd		PM_BATCH command, its subsystem and IPI details are
+ *			used for every command of the list
+ * @param  AddrLow	Lower 32 bits of the command list address
+ * @param  AddrHigh	Higher 32 bits of the command list address
+ * @param  NumCmds	Number of commands in the list
+ * @param  ApiResponse	Returns number of commands executed successfully
+ *
+ * @return XST_SUCCESS if all commands are successful else status of the
+ *	   first failed command
+ *
+ * @note   The list must be word aligned and lie in a memory device
+ *	   requested by the subsystem of the caller. Commands are executed in
+ *	   order without handling any other request in between. Execution
+ *	   stops at the first failure, the remaining commands keep their
+ *	   status. Status and first return value of each executed command are
+ *	   written back to its list entry.
+ *
+ ****************************************************************************/
+static int XPm_ProcessBatch(const XPlmi_Cmd *Cmd, u32 AddrLow, u32 AddrHigh,
+			    u32 NumCmds, u32 *ApiResponse)
+{
+	int Status = XST_FAILURE;
+	static XPlmi_Cmd BatchCmd;
+	u32 Entry[XPM_BATCH_STATUS_OFFSET];
+	u64 Address = (u64)AddrLow + ((u64)AddrHigh << 32ULL);
+	u64 EndAddress;
+	u32 Idx = 0U;
+	u32 Word;
+
+	if ((0U == NumCmds) || (XPM_BATCH_MAX_CMDS < NumCmds) ||
+	    (0U != (Address & 0x3U))) {
+		Status = XST_INVALID_PARAM;
+		goto done;
+	}
+
+	/* Whole list must be valid memory owned by the caller */
+	EndAddress = Address +
+		(((u64)NumCmds * XPM_BATCH_ENTRY_WORDS * 4U) - 1U);
+	Status = XPlmi_VerifyAddrRange(Address, EndAddress);
+	if (XST_SUCCESS != Status) {
+		PmErr("Invalid command list address 0x%x%08x\r\n", AddrHigh,
+		      AddrLow);
+		Status = XST_INVALID_PARAM;
+		goto done;
+	}
+	Status = XPm_IsMemRangeOwned(Cmd->SubsystemId, Address, EndAddress);
+	if (XST_SUCCESS != Status) {
+		PmErr("Command list not owned by subsystem 0x%x\r\n",
+		      Cmd->SubsystemId);
+		goto done;
+	}
+
+	for (Idx = 0U; Idx < NumCmds; Idx++) {
+		for (Word = 0U; Word < XPM_BATCH_STATUS_OFFSET; Word++) {
+			Entry[Word] = XPlmi_In64(Address + ((u64)Word * 4U));
+		}
+
+		/* Arguments are read from the entry, up to its status word */
+		if ((XPM_BATCH_STATUS_OFFSET - 1U) < (Entry[0U] >> 16U)) {
+			Status = XST_INVALID_PARAM;
+		} else {
+			Status = XPm_IsBatchCmd(Entry[0U]);
+		}
+		if (XST_SUCCESS != Status) {
+			PmErr("Command 0x%x can not be batched\r\n", Entry[0U]);
+			XPlmi_Out64(Address + (XPM_BATCH_STATUS_OFFSET * 4U),
+				    (u32)Status);
+			break;
+		}
+
+		/* Nothing of the previous command must be returned */
+		Status = Xil_SMemSet(&BatchCmd, sizeof(BatchCmd), 0,
+				     sizeof(BatchCmd));
+		if (XST_SUCCESS != Status) {
+			break;
+		}
+		BatchCmd.SubsystemId = Cmd->SubsystemId;
+		BatchCmd.IpiMask = Cmd->IpiMask;
+		BatchCmd.IpiReqType = Cmd->IpiReqType;
+		BatchCmd.CmdId = Entry[0U] & 0xFFFFU;
+		BatchCmd.Len = Entry[0U] >> 16U;
+		BatchCmd.Payload = &Entry[1U];
+
+		Status = XPm_ProcessCmd(&BatchCmd);
+		XPlmi_Out64(Address + (XPM_BATCH_STATUS_OFFSET * 4U),
+			    (u32)Status);
+		XPlmi_Out64(Address + (XPM_BATCH_VALUE_OFFSET * 4U),
+			    BatchCmd.Response[1U]);
+		if (XST_SUCCESS != Status) {
+			break;
+		}
+
+		Address += (u64)XPM_BATCH_ENTRY_WORDS * 4U;
+	}
+
+done:
+	ApiResponse[0] = Idx;
+
+	return Status;
+}
+
+/****************************************************************************/
+/**
+ * @brief  This function checks if a memory range lies in a memory device
+ *	   requested by a subsystem
+ *
+ * @param  SubsystemId	Subsystem ID
+ * @param  StartAddr	First address of the range
+ * @param  EndAddr	Last address of the range
+ *
+ * @return XST_SUCCESS if the subsystem owns the range else XPM_PM_NO_ACCESS
+ *
+ * @note   PMC subsystem owns all memory
+ *
+ ****************************************************************************/
+static XStatus XPm_IsMemRangeOwned(u32 SubsystemId, u64 StartAddr,
+				   u64 EndAddr)
+{
+	XStatus Status = XPM_PM_NO_ACCESS;
+	const XPm_Device *Device;
+	const XPm_MemDevice *MemDev;
+	u32 Idx;
+
+	if (PM_SUBSYS_PMC == SubsystemId) {
+		Status = XST_SUCCESS;
+		goto done;
+	}
+
+	for (Idx = (u32)XPM_NODEIDX_DEV_MIN + 1U;
+	     Idx < (u32)XPM_NODEIDX_DEV_MAX; Idx++) {
+		Device = XPmDevice_GetByIndex(Idx);
+		if ((NULL == Device) ||
+		    ((u32)XPM_NODESUBCL_DEV_MEM !=
+		     NODESUBCLASS(Device->Node.Id)) ||
+		    (!IS_MEM_DEV_TYPE(NODETYPE(Device->Node.Id)))) {
+			continue;
+		}
+
+		MemDev = (const XPm_MemDevice *)Device;
+		if ((StartAddr < (u64)MemDev->StartAddress) ||
+		    (EndAddr >= (u64)MemDev->EndAddress)) {
+			continue;
+		}
+
+		if (XST_SUCCESS == XPmDevice_IsRequested(Device->Node.Id,
+							 SubsystemId)) {
+			Status = XST_SUCCESS;
+			break;
+		}
+	}
+
+done:
+	return Status;
+}
+
 /****************************************************************************/
 /**
  * @brief  This function restarts the given subsystem.
@@ -2755,6 +2968,7 @@ XStatus XPm_FeatureCheck(const u32 ApiId, u32 *const Version)
 	case PM_API(PM_ADD_NODE_NAME):
 	case PM_API(PM_ADD_REQUIREMENT):
 	case PM_API(PM_INIT_NODE):
+	case PM_API(PM_BATCH):
 		*Version = XST_API_BASE_VERSION;
 		Status = XST_SUCCESS;
 		break;
@@ -179,6 +179,12 @@ static XPm_Requirement *FindReqm(const XPm_Device *Device, const XPm_Subsystem *
 {
 	XPm_Requirement *Reqm = NULL;
 
+	/* Subsystem has no requirement on this device */
+	if ((NULL == Subsystem) ||
+	    (0U == (Device->ReqmMask & BIT16(NODEINDEX(Subsystem->Id))))) {
+		goto done;
+	}
+
 	Reqm = Device->Requirements;
 	while (NULL != Reqm) {
 		if (Reqm->Subsystem == Subsystem) {
@@ -187,6 +193,7 @@ static XPm_Requirement *FindReqm(const XPm_Device *Device, const XPm_Subsystem *
 		Reqm = Reqm->NextSubsystem;
 	}
 
+done:
 	return Reqm;
 }
 
@@ -242,25 +249,23 @@ u32 XPmDevice_GetSubsystemIdOfCore(const XPm_Device *Device)
 {
 	const XPm_Requirement *Reqm;
 	const XPm_Subsystem *Subsystem = NULL;
-	u32 Idx, SubSystemId;
-	u32 SubsysIdx = XPmSubsystem_GetMaxSubsysIdx();
+	u32 Idx, SubSystemId = INVALID_SUBSYSID;
+	u32 Mask = Device->AllocMask;
 
-	for (Idx = 0; Idx <= SubsysIdx; Idx++) {
+	/* Only subsystems which have allocated the device are checked */
+	while (0U != Mask) {
+		Idx = (u32)__builtin_ctz(Mask);
+		Mask &= Mask - 1U;
 		Subsystem = XPmSubsystem_GetByIndex(Idx);
 		if (NULL != Subsystem) {
 			Reqm = FindReqm(Device, Subsystem);
 			if ((NULL != Reqm) && (1U == Reqm->Allocated)) {
+				SubSystemId = Subsystem->Id;
 				break;
 			}
 		}
 	}
 
-	if (SubsysIdx < Idx) {
-		SubSystemId = INVALID_SUBSYSID;
-	} else {
-		SubSystemId = Subsystem->Id;
-	}
-
 	return SubSystemId;
 }
 
@@ -329,6 +334,11 @@ static u32 IsRunning(const XPm_Device *Device)
 	u32 Running = 0;
 	const XPm_Requirement *Reqm = Device->Requirements;
 
+	/* Device is not allocated to any subsystem */
+	if (0U == Device->AllocMask) {
+		Reqm = NULL;
+	}
+
 	while (NULL != Reqm) {
 		if (Reqm->Allocated > 0U) {
 			if (Reqm->Curr.Capabilities > 0U) {
@@ -411,6 +421,7 @@ static XStatus HandleDeviceEvent(XPm_Node *Node, u32 Event)
 	XPm_Device *Device = (XPm_Device *)Node;
 	XPm_Core *Core;
 	u16 DbgErr = XPM_INT_ERR_UNDEFINED;
+	u8 OldState = Node->State;
 
 	PmDbg("ID=0x%x State=%s, Event=%s\n\r", Node->Id, PmDevStates[Node->State], PmDevEvents[Event]);
 
@@ -607,7 +618,7 @@ static XStatus HandleDeviceEvent(XPm_Node *Node, u32 Event)
 				Device->Node.Flags &= (u8)(~NODE_IDLE_DONE);
 				if (Device->WfPwrUseCnt == Device->Power->UseCount) {
 					if (1U == Device->WfDealloc) {
-						Device->PendingReqm->Allocated = 0;
+						XPmRequirement_SetAllocated(Device->PendingReqm, 0U);
 						Device->WfDealloc = 0;
 					}
 					if(Device->PendingReqm != NULL) {
@@ -669,6 +680,7 @@ static XStatus HandleDeviceEvent(XPm_Node *Node, u32 Event)
 		PmErr("ID=0x%x State=%s Event=%s Err=%x\r\n", Node->Id,
 		      Node->State, Event, DbgErr);
 	}
+	XPmNode_TraceState(Node, OldState);
 
 	return Status;
 }
@@ -812,7 +824,7 @@ static XStatus DevRequest(XPm_Device *Device, XPm_Subsystem *Subsystem,
 	}
 
 	/* Allocated device for the subsystem */
-	Reqm->Allocated = 1U;
+	XPmRequirement_SetAllocated(Reqm, 1U);
 
 	Status = Device->DeviceOps->SetRequirement(Device, Subsystem,
 						   Capabilities, QoS);
@@ -1252,6 +1264,12 @@ XStatus XPmDevice_CheckPermissions(const XPm_Subsystem *Subsystem, u32 DeviceId)
 		goto done;
 	}
 
+	/* Device is not allocated to any subsystem with this index */
+	if ((NULL == Subsystem) ||
+	    (0U == (Device->AllocMask & BIT16(NODEINDEX(Subsystem->Id))))) {
+		goto done;
+	}
+
 	Reqm = FindReqm(Device, Subsystem);
 	if (NULL == Reqm) {
 		goto done;
@@ -1719,23 +1737,25 @@ XStatus XPmDevice_GetPermissions(const XPm_Device *Device, u32 *PermissionMask)
 	XStatus Status = XST_FAILURE;
 	const XPm_Requirement *Reqm;
 	u32 Idx;
-	u32 SubsysIdx = XPmSubsystem_GetMaxSubsysIdx();
+	u32 Mask;
 
 	if ((NULL == Device) || (NULL == PermissionMask)) {
 		Status = XST_INVALID_PARAM;
 		goto done;
 	}
 
-	Reqm = Device->Requirements;
-	while (NULL != Reqm) {
-		if (1U == Reqm->Allocated) {
-			for (Idx = 0; Idx <= SubsysIdx; Idx++) {
-				if (Reqm->Subsystem == XPmSubsystem_GetByIndex(Idx)) {
-					*PermissionMask |= ((u32)1U << Idx);
-				}
-			}
+	/*
+	 * Only the current subsystem of each index is given permission,
+	 * an offline instance with the same index is not.
+	 */
+	Mask = Device->AllocMask;
+	while (0U != Mask) {
+		Idx = (u32)__builtin_ctz(Mask);
+		Mask &= Mask - 1U;
+		Reqm = FindReqm(Device, XPmSubsystem_GetByIndex(Idx));
+		if ((NULL != Reqm) && (1U == Reqm->Allocated)) {
+			*PermissionMask |= ((u32)1U << Idx);
 		}
-		Reqm = Reqm->NextSubsystem;
 	}
 
 	Status = XST_SUCCESS;
@@ -1838,6 +1858,7 @@ XStatus XPmDevice_ChangeState(XPm_Device *Device, const u32 NextState)
 
 	if ((OldState != NextState) && (XST_SUCCESS == Status)) {
 		Device->Node.State = (u8)NextState;
+		XPmNode_TraceState(&Device->Node, (u8)OldState);
 
 		/* Send notification about device state change */
 		XPmNotifier_Event(Device->Node.Id, (u32)EVENT_STATE_CHANGE);
@@ -2102,6 +2123,11 @@ u32 XPmDevice_GetUsageStatus(const XPm_Subsystem *Subsystem, const XPm_Device *D
 	u32 UsageStatus = 0;
 	const XPm_Requirement *Reqm = Device->Requirements;
 
+	/* Device is not allocated to any subsystem */
+	if (0U == Device->AllocMask) {
+		Reqm = NULL;
+	}
+
 	while (NULL != Reqm) {
 		if (1U == Reqm->Allocated) {
 			/* This subsystem is currently using this device */
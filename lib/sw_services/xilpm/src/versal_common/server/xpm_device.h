@@ -109,6 +109,8 @@ struct XPm_DeviceNode {
 	struct XPm_Reqm *PendingReqm; /**< Requirement being updated */
 	u8 WfDealloc; /**< Deallocation is pending */
 	u8 WfPwrUseCnt; /**< Pending power use count */
+	u16 ReqmMask; /**< Subsystem indexes having a requirement on the device */
+	u16 AllocMask; /**< Subsystem indexes which have allocated the device */
 	XPm_DeviceOps *DeviceOps; /**< Device operations */
 	XPm_DeviceAttr *DevAttr;  /**< Device attributes */
 	const XPm_DeviceFsm* DeviceFsm; /**< Device finite state machine */
@@ -7,6 +7,7 @@
 #include "xpm_defs.h"
 #include "xpm_common.h"
 #include "xpm_node.h"
+#include "xplmi_modules.h"
 
 void XPmNode_Init(XPm_Node *Node, u32 Id, u8 State, u32 BaseAddress)
 {
@@ -19,3 +20,12 @@ void XPmNode_Init(XPm_Node *Node, u32 Id, u8 State, u32 BaseAddress)
 	Node->Flags = 0;
 	Node->LatencyMarg = XPM_MAX_LATENCY;
 }
+
+void XPmNode_TraceState(const XPm_Node *Node, u8 OldState)
+{
+	if (OldState != Node->State) {
+		XPlmi_TraceEvent(XPLMI_TRACE_ID(XPLMI_MODULE_XILPM_ID,
+			XPLMI_TRACE_INSTANT, XPM_TRACE_EVT_NODE_STATE), Node->Id,
+			((u32)OldState << 8U) | (u32)Node->State);
+	}
+}
@@ -36,6 +36,10 @@ struct XPm_Node {
 
 /************************** Function Prototypes ******************************/
 void XPmNode_Init(XPm_Node *Node, u32 Id, u8 State, u32 BaseAddress);
+void XPmNode_TraceState(const XPm_Node *Node, u8 OldState);
+
+/* Boot trace event IDs of XPLMI_MODULE_XILPM_ID */
+#define XPM_TRACE_EVT_NODE_STATE	(0x1U) /* Arg1: Node ID, Arg2: Old state << 8 | New state */
 
 
 #define NODE_CLASS_SHIFT	26U
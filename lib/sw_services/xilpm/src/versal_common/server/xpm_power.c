@@ -370,6 +370,7 @@ static XStatus PowerEvent(XPm_Node *Node, u32 Event)
 	XStatus Status = XST_FAILURE;
 	const XPm_Power *Power = (XPm_Power *)Node;
 	u16 DbgErr = XPM_INT_ERR_UNDEFINED;
+	u8 OldState = Node->State;
 
 	PmDbg("[IN] Id:0x%x, UseCount:%d, State=%x, Event=%x\r\n",
 			Node->Id, Power->UseCount, Node->State, Event);
@@ -403,6 +404,7 @@ static XStatus PowerEvent(XPm_Node *Node, u32 Event)
 	PmDbg("[OUT] Id:0x%x, UseCount:%d, State=%x, Event=%x\r\n",
 			Node->Id, Power->UseCount, Node->State, Event);
 
+	XPmNode_TraceState(Node, OldState);
 	XPm_PrintDbgErr(Status, DbgErr);
 	return Status;
 }
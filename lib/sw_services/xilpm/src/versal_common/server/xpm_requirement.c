@@ -22,6 +22,7 @@ static void XPmRequirement_Init(XPm_Requirement *Reqm, XPm_Subsystem *Subsystem,
 	Reqm->NextSubsystem = Device->Requirements;
 	Device->Requirements = Reqm;
 	Reqm->Device = Device;
+	Device->ReqmMask |= BIT16(NODEINDEX(Subsystem->Id));
 
 	Reqm->Allocated = 0;
 	Reqm->SetLatReq = 0;
@@ -56,6 +57,46 @@ done:
 	return Status;
 }
 
+/****************************************************************************/
+/**
+ * @brief	Update allocation status of the requirement
+ *
+ * @param Reqm		Requirement to be updated
+ * @param Allocated	1 if device is allocated to the subsystem, 0 otherwise
+ *
+ * @note	AllocMask of the device is kept in sync with the Allocated
+ *		flags of its requirements. A re-added subsystem shares its
+ *		index with the offline instance, so the bit is recomputed
+ *		from the list when cleared.
+ *
+ ****************************************************************************/
+void XPmRequirement_SetAllocated(XPm_Requirement *Reqm, u8 Allocated)
+{
+	XPm_Device *Device = Reqm->Device;
+	const XPm_Requirement *NextReqm;
+	u32 SubsysIdx = NODEINDEX(Reqm->Subsystem->Id);
+
+	Reqm->Allocated = Allocated;
+	if (1U == Allocated) {
+		Device->AllocMask |= BIT16(SubsysIdx);
+		goto done;
+	}
+
+	Device->AllocMask &= (u16)(~BIT16(SubsysIdx));
+	NextReqm = Device->Requirements;
+	while (NULL != NextReqm) {
+		if ((1U == NextReqm->Allocated) &&
+		    (SubsysIdx == NODEINDEX(NextReqm->Subsystem->Id))) {
+			Device->AllocMask |= BIT16(SubsysIdx);
+			break;
+		}
+		NextReqm = NextReqm->NextSubsystem;
+	}
+
+done:
+	return;
+}
+
 void XPm_RequiremntUpdate(XPm_Requirement *Reqm)
 {
 	if(NULL != Reqm)
@@ -70,7 +111,7 @@ void XPmRequirement_Clear(XPm_Requirement* Reqm)
 {
 	if(NULL != Reqm) {
 		/* Clear flag - master is not using slave anymore */
-		Reqm->Allocated = 0;
+		XPmRequirement_SetAllocated(Reqm, 0U);
 		/* Release current and next requirements */
 		Reqm->Curr.Capabilities = XPM_MIN_CAPABILITY;
 		Reqm->Curr.Latency = XPM_MAX_LATENCY;
@@ -680,9 +680,27 @@ typedef enum {
 	PM_ACTIVATE_SUBSYSTEM,				/**< 0x41 */
 	PM_BISR = 0x43,					/**< 0x43 */
 	PM_APPLY_TRIM,					/**< 0x44 */
-	PM_API_MAX					/**< 0x45 */
+	PM_BATCH = 0x47,				/**< 0x47 */
+	PM_API_MAX					/**< 0x48 */
 } XPm_ApiId;
 
+/**
+ * @name PM_BATCH command list
+ * @{
+ */
+/**
+ * PM_BATCH passes the address of a word aligned list of PM commands in a
+ * memory device requested by the caller. Each entry is XPM_BATCH_ENTRY_WORDS
+ * words: IPI header and up to XPM_BATCH_MAX_ARGS arguments, followed by
+ * status and first return value which are written back by the server.
+ */
+#define XPM_BATCH_ENTRY_WORDS		(8U)
+#define XPM_BATCH_MAX_ARGS		(5U)
+#define XPM_BATCH_STATUS_OFFSET		(6U)
+#define XPM_BATCH_VALUE_OFFSET		(7U)
+#define XPM_BATCH_MAX_CMDS		(32U)
+/** @} */
+
 #define CRP_RESET_REASON_ERR_POR_MASK				(0x00000008U)
 #define CRP_RESET_REASON_SLR_POR_MASK				(0x00000004U)
 #define CRP_RESET_REASON_SW_POR_MASK				(0x00000002U)